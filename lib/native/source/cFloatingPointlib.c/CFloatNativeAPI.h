@@ -41,6 +41,32 @@ extern "C" {
 #define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_TYPE_ULONG 11L
 #undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_TYPE_ULONG_LONG
 #define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_TYPE_ULONG_LONG 12L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ADD
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ADD 0L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SUBTRACT
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SUBTRACT 1L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_MULTIPLY
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_MULTIPLY 2L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_DIVIDE
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_DIVIDE 3L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_POW
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_POW 4L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_COPYSIGN
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_COPYSIGN 5L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SQRT
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SQRT 6L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ROUND
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ROUND 7L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_TRUNC
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_TRUNC 8L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CEIL
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CEIL 9L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_FLOOR
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_FLOOR 10L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ABS
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ABS 11L
+#undef org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CAST
+#define org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CAST 12L
 /*
  * Class:     org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI
  * Method:    createFp
@@ -241,6 +267,14 @@ JNIEXPORT jobject JNICALL Java_org_sosy_1lab_cpachecker_util_floatingpoint_CFloa
 JNIEXPORT jobject JNICALL Java_org_sosy_1lab_cpachecker_util_floatingpoint_CFloatNativeAPI_castFpToOther
   (JNIEnv *, jclass, jobject, jint, jint);
 
+/*
+ * Class:     org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI
+ * Method:    evaluateFp
+ * Signature: ([I[J[J[I)V
+ */
+JNIEXPORT void JNICALL Java_org_sosy_1lab_cpachecker_util_floatingpoint_CFloatNativeAPI_evaluateFp
+  (JNIEnv *, jclass, jintArray, jlongArray, jlongArray, jintArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,17 +40,9 @@ void throwNativeException(JNIEnv* env, const char* message) {
 
 /**
  * Utility function to get the floating point
- * representation of the java wrapper object.
+ * representation of the given bit-masks.
  */
-t_ld transformWrapperFromJava(JNIEnv* env, jobject wrapper, jint type) {
-	jobject cls = (*env)->FindClass(env, WRAPPER);
-	
-	jmethodID getE = (*env)->GetMethodID(env, cls, "getExponent", "()J");
-	jmethodID getM = (*env)->GetMethodID(env, cls, "getMantissa", "()J");
-
-	jlong exponent = (*env)->CallLongMethod(env, wrapper, getE);
-	jlong mantissa = (*env)->CallLongMethod(env, wrapper, getM);
-
+t_ld transformBitsFromJava(JNIEnv* env, jlong exponent, jlong mantissa, jint type) {
 	t_ld fp_obj = { .ld_value = 0.0L };
 	switch (type) {
 		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
@@ -70,6 +62,45 @@ t_ld transformWrapperFromJava(JNIEnv* env, jobject wrapper, jint type) {
 	return fp_obj;
 }
 
+/**
+ * Utility function to split a floating point
+ * number into the bit-masks used on the java side.
+ */
+void transformBitsToJava(JNIEnv* env, t_ld fp_obj, jint type, jlong* exponent, jlong* mantissa) {
+	switch (type) {
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
+			*exponent = (jlong)((fp_obj.bitmask.mantissa & (511L << 23)) >> 23);
+			*mantissa = (jlong)fp_obj.bitmask.mantissa & 8388607L;
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_DOUBLE:
+			*exponent = (jlong)((fp_obj.bitmask.mantissa & (4095L << 52)) >> 52);
+			*mantissa = (jlong)fp_obj.bitmask.mantissa & 4503599627370495L;
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE:
+			*exponent = (jlong)fp_obj.bitmask.exp_sig_pad;
+			*mantissa = (jlong)fp_obj.bitmask.mantissa;
+			break;
+		default:
+			throwNativeException(env, EX_TEXT);
+	}
+}
+
+/**
+ * Utility function to get the floating point
+ * representation of the java wrapper object.
+ */
+t_ld transformWrapperFromJava(JNIEnv* env, jobject wrapper, jint type) {
+	jobject cls = (*env)->FindClass(env, WRAPPER);
+	
+	jmethodID getE = (*env)->GetMethodID(env, cls, "getExponent", "()J");
+	jmethodID getM = (*env)->GetMethodID(env, cls, "getMantissa", "()J");
+
+	jlong exponent = (*env)->CallLongMethod(env, wrapper, getE);
+	jlong mantissa = (*env)->CallLongMethod(env, wrapper, getM);
+
+	return transformBitsFromJava(env, exponent, mantissa, type);
+}
+
 /**
  * Utility function to encapsulate a
  * floating point number into a java wrapper.
@@ -83,22 +114,11 @@ jobject transformWrapperToJava(JNIEnv* env, t_ld fp_obj, jint type) {
 	jmethodID setE = (*env)->GetMethodID(env, cls, "setExponent", "(J)V");
 	jmethodID setM = (*env)->GetMethodID(env, cls, "setMantissa", "(J)V");
 
-	switch (type) {
-		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
-			(*env)->CallVoidMethod(env, wrapper, setE, ((jlong)((fp_obj.bitmask.mantissa & (511L << 23)) >> 23)));
-			(*env)->CallVoidMethod(env, wrapper, setM, ((jlong)fp_obj.bitmask.mantissa & 8388607L));
-			break;
-		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_DOUBLE:
-			(*env)->CallVoidMethod(env, wrapper, setE, ((jlong)((fp_obj.bitmask.mantissa & (4095L << 52)) >> 52)));
-			(*env)->CallVoidMethod(env, wrapper, setM, ((jlong)fp_obj.bitmask.mantissa & 4503599627370495L));
-			break;
-		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE:
-			(*env)->CallVoidMethod(env, wrapper, setE, ((jlong)fp_obj.bitmask.exp_sig_pad));
-			(*env)->CallVoidMethod(env, wrapper, setM, ((jlong)fp_obj.bitmask.mantissa));
-			break;
-		default:
-			throwNativeException(env, EX_TEXT);
-	}
+	jlong exponent = 0;
+	jlong mantissa = 0;
+	transformBitsToJava(env, fp_obj, type, &exponent, &mantissa);
+	(*env)->CallVoidMethod(env, wrapper, setE, exponent);
+	(*env)->CallVoidMethod(env, wrapper, setM, mantissa);
 
 	return wrapper;
 }
@@ -902,3 +922,167 @@ JNIEXPORT jobject JNICALL Java_org_sosy_1lab_cpachecker_util_floatingpoint_CFloa
 
 	return number_obj;
 }
+
+/*
+ * Batched evaluation: the operations are computed exactly like
+ * the single operations above, but on values given as bit-masks
+ * in primitive arrays, such that a whole sequence of operations
+ * needs only one call from java and no wrapper objects.
+ */
+
+#define BINARY_OP(op, r, x, y, S) \
+	switch(op) { \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ADD: r = x + y; break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SUBTRACT: r = x - y; break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_MULTIPLY: r = x * y; break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_DIVIDE: r = x / y; break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_POW: r = pow##S(x, y); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_COPYSIGN: r = copysign##S(x, y); break; \
+		default: return 0; \
+	}
+
+#define UNARY_OP(op, r, x, S) \
+	switch(op) { \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_SQRT: r = sqrt##S(x); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ROUND: r = round##S(x); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_TRUNC: r = trunc##S(x); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CEIL: r = ceil##S(x); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_FLOOR: r = floor##S(x); break; \
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_ABS: r = fabs##S(x); break; \
+		default: return 0; \
+	}
+
+static int isFpType(jint type) {
+	return type >= org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE && type <= org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE;
+}
+
+/**
+ * Evaluates a binary operation, the result has the bigger one of both types.
+ * Returns 0 if the operation is not supported.
+ */
+static int evaluateBinary(jint op, t_ld fp_1, jint type1, t_ld fp_2, jint type2, t_ld* result, jint* resultType) {
+	jint maxType = max(type1, type2);
+	result->ld_value = 0.0L;
+	switch(maxType) {
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
+			BINARY_OP(op, result->f_value, fp_1.f_value, fp_2.f_value, f);
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_DOUBLE:
+			BINARY_OP(op, result->d_value, chooseOf2(type1, fp_1), chooseOf2(type2, fp_2), );
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE:
+			BINARY_OP(op, result->ld_value, chooseOf3(type1, fp_1), chooseOf3(type2, fp_2), l);
+			break;
+		default:
+			return 0;
+	}
+	*resultType = maxType;
+	return 1;
+}
+
+/**
+ * Evaluates a unary operation or a cast to 'to_type'.
+ * Returns 0 if the operation is not supported.
+ */
+static int evaluateUnary(jint op, t_ld fp, jint type, jint to_type, t_ld* result, jint* resultType) {
+	result->ld_value = 0.0L;
+	if (op == org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_CAST) {
+		switch(to_type) {
+			case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
+				result->f_value = (float)(chooseOf3(type, fp));
+				break;
+			case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_DOUBLE:
+				result->d_value = (double)(chooseOf3(type, fp));
+				break;
+			case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE:
+				result->ld_value = (long double)(chooseOf3(type, fp));
+				break;
+			default:
+				return 0;
+		}
+		*resultType = to_type;
+		return 1;
+	}
+
+	switch(type) {
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_SINGLE:
+			UNARY_OP(op, result->f_value, fp.f_value, f);
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_DOUBLE:
+			UNARY_OP(op, result->d_value, fp.d_value, );
+			break;
+		case org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_FP_TYPE_LONG_DOUBLE:
+			UNARY_OP(op, result->ld_value, fp.ld_value, l);
+			break;
+		default:
+			return 0;
+	}
+	*resultType = type;
+	return 1;
+}
+
+/**
+ * Function to evaluate a sequence of operations with one call.
+ *
+ * The values are kept in slots: slot i holds the bit-masks
+ * 'exponents[i]' and 'mantissas[i]' of a number with type 'types[i]'.
+ * Each operation is given by four entries of 'program':
+ * the operation, the slot of the first operand, the slot of the second
+ * operand (the target type for casts, ignored for unary operations),
+ * and the slot for the result. Results are written back into the arrays,
+ * so later operations can use the results of earlier ones.
+ */
+JNIEXPORT void JNICALL Java_org_sosy_1lab_cpachecker_util_floatingpoint_CFloatNativeAPI_evaluateFp(JNIEnv* env, jclass cl, jintArray program, jlongArray exponents, jlongArray mantissas, jintArray types) {
+	jsize size = (*env)->GetArrayLength(env, exponents);
+	jsize length = (*env)->GetArrayLength(env, program);
+	if ((*env)->GetArrayLength(env, mantissas) != size || (*env)->GetArrayLength(env, types) != size || length % 4 != 0) {
+		throwNativeException(env, "Invalid batch of operations.");
+		return;
+	}
+
+	jint* ops = (*env)->GetIntArrayElements(env, program, NULL);
+	jlong* exps = (*env)->GetLongArrayElements(env, exponents, NULL);
+	jlong* mans = (*env)->GetLongArrayElements(env, mantissas, NULL);
+	jint* tps = (*env)->GetIntArrayElements(env, types, NULL);
+	int valid = 1;
+
+	for (jsize i = 0; valid && i < length; i += 4) {
+		jint op = ops[i];
+		jint arg1 = ops[i + 1];
+		jint arg2 = ops[i + 2];
+		jint target = ops[i + 3];
+		t_ld result;
+		jint resultType;
+
+		if (arg1 < 0 || arg1 >= size || target < 0 || target >= size || !isFpType(tps[arg1])) {
+			valid = 0;
+			break;
+		}
+		t_ld fp_1 = transformBitsFromJava(env, exps[arg1], mans[arg1], tps[arg1]);
+
+		if (op <= org_sosy_lab_cpachecker_util_floatingpoint_CFloatNativeAPI_OP_COPYSIGN) {
+			if (arg2 < 0 || arg2 >= size || !isFpType(tps[arg2])) {
+				valid = 0;
+				break;
+			}
+			t_ld fp_2 = transformBitsFromJava(env, exps[arg2], mans[arg2], tps[arg2]);
+			valid = evaluateBinary(op, fp_1, tps[arg1], fp_2, tps[arg2], &result, &resultType);
+		} else {
+			valid = evaluateUnary(op, fp_1, tps[arg1], arg2, &result, &resultType);
+		}
+
+		if (valid) {
+			transformBitsToJava(env, result, resultType, exps + target, mans + target);
+			tps[target] = resultType;
+		}
+	}
+
+	(*env)->ReleaseIntArrayElements(env, program, ops, JNI_ABORT);
+	(*env)->ReleaseLongArrayElements(env, exponents, exps, 0);
+	(*env)->ReleaseLongArrayElements(env, mantissas, mans, 0);
+	(*env)->ReleaseIntArrayElements(env, types, tps, 0);
+
+	if (!valid) {
+		throwNativeException(env, EX_TEXT);
+	}
+}
@@ -0,0 +1,120 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+ * Compares the closure kernels from oct_closure_simd.c on random octagons.
+ * Usage: closure-benchmark [repetitions]
+ * For every size and kernel supported by this CPU, this prints the average time per closure
+ * and checks that all kernels compute the same result as the scalar kernel.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "oct_closure_simd.h"
+
+static const int SIZES[] = { 16, 32, 64, 128, 256 };
+
+static double now(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* random sparse octagon that is (almost always) non-empty: about 1/4 of the entries are finite */
+static void random_matrix(int64_t* m, int dim) {
+	int i, j;
+	for (i = 0; i < dim; i++) {
+		for (j = 0; j < dim; j++) {
+			m[(size_t) i * dim + j] = i == j ? 0
+					: rand() % 4 == 0 ? rand() % 1000 + 10 : CLOSURE_INF_LONG;
+		}
+	}
+	/* keep the matrix coherent: m[i][j] = m[j^1][i^1] */
+	for (i = 0; i < dim; i++) {
+		for (j = 0; j < dim; j++) {
+			m[(size_t) (j ^ 1) * dim + (i ^ 1)] = m[(size_t) i * dim + j];
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	int reps = argc > 1 ? atoi(argv[1]) : 10;
+	int failed = 0;
+	size_t s;
+	int kernel;
+
+	printf("%-6s %-8s %-8s %14s %14s\n", "vars", "type", "kernel", "ms/closure", "speedup");
+	for (s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++) {
+		int dim = 2 * SIZES[s];
+		size_t len = (size_t) dim * dim;
+		int64_t* input = malloc(len * sizeof(int64_t));
+		int64_t* lref = malloc(len * sizeof(int64_t));
+		int64_t* lm = malloc(len * sizeof(int64_t));
+		double* dinput = malloc(len * sizeof(double));
+		double* dref = malloc(len * sizeof(double));
+		double* dm = malloc(len * sizeof(double));
+		double lscalar = 0, dscalar = 0;
+		size_t k;
+
+		srand(SIZES[s]);
+		random_matrix(input, dim);
+		for (k = 0; k < len; k++) {
+			dinput[k] = input[k] == CLOSURE_INF_LONG ? 1.0 / 0.0 : (double) input[k];
+		}
+
+		for (kernel = CLOSURE_KERNEL_SCALAR; kernel <= CLOSURE_KERNEL_AVX2; kernel++) {
+			double start, lt = 0, dt;
+			int r, lres = 0, dres = 0;
+			/* kernels without an int64 variant would only measure the scalar kernel again */
+			int has_long = closure_kernel_long(kernel) == kernel;
+			if (!closure_kernel_supported(kernel)) continue;
+
+			if (has_long) {
+				start = now();
+				for (r = 0; r < reps; r++) {
+					memcpy(lm, input, len * sizeof(int64_t));
+					lres = closure_long(lm, dim, kernel);
+				}
+				lt = (now() - start) / reps * 1000;
+			}
+
+			start = now();
+			for (r = 0; r < reps; r++) {
+				memcpy(dm, dinput, len * sizeof(double));
+				dres = closure_double(dm, dim, kernel);
+			}
+			dt = (now() - start) / reps * 1000;
+
+			if (kernel == CLOSURE_KERNEL_SCALAR) {
+				memcpy(lref, lm, len * sizeof(int64_t));
+				memcpy(dref, dm, len * sizeof(double));
+				lscalar = lt;
+				dscalar = dt;
+				if (!lres || !dres) {
+					printf("%-6d random octagon is empty, results not comparable\n", SIZES[s]);
+				}
+			} else if ((has_long && memcmp(lref, lm, len * sizeof(int64_t)) != 0)
+					|| memcmp(dref, dm, len * sizeof(double)) != 0) {
+				printf("%-6d kernel %s differs from scalar kernel\n", SIZES[s], closure_kernel_name(kernel));
+				failed = 1;
+			}
+			if (has_long) {
+				printf("%-6d %-8s %-8s %14.3f %13.2fx\n", SIZES[s], "int64", closure_kernel_name(kernel),
+						lt, lscalar / lt);
+			}
+			printf("%-6d %-8s %-8s %14.3f %13.2fx\n", SIZES[s], "double", closure_kernel_name(kernel),
+					dt, dscalar / dt);
+		}
+
+		free(input); free(lref); free(lm); free(dinput); free(dref); free(dm);
+	}
+	printf("selected kernel: %s\n", closure_kernel_name(closure_kernel_select()));
+	return failed;
+}
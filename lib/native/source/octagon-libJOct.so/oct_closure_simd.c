@@ -0,0 +1,288 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+ * Closure as described by Bagnara, Hill, and Zaffanella (2008): Floyd-Warshall shortest-path
+ * closure, tightening (integers only), one strengthening step, and a consistency check.
+ * The cubic Floyd-Warshall step dominates and is vectorized over the columns of a row:
+ *   m[i][j] = min(m[i][j], m[i][k] + m[k][j])   for all j
+ * The quadratic steps are vectorized for doubles and scalar for integers.
+ *
+ * Integer sums saturate in both directions: too large sums become CLOSURE_INF_LONG, which only
+ * weakens a bound, and too small sums become INT64_MIN, which keeps a negative cycle negative.
+ * There is no SSE2 kernel for integers, because SSE2 has no 64-bit comparison.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "oct_closure_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CLOSURE_X86 1
+#endif
+
+#define AT(m, dim, i, j) ((m)[(size_t)(i) * (dim) + (j)])
+
+/* ---------- kernel selection ---------- */
+
+int closure_kernel_supported(int kernel) {
+	switch (kernel) {
+	case CLOSURE_KERNEL_SCALAR:
+		return 1;
+#ifdef CLOSURE_X86
+	case CLOSURE_KERNEL_SSE2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse2");
+	case CLOSURE_KERNEL_AVX2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#endif
+	default:
+		return 0;
+	}
+}
+
+const char* closure_kernel_name(int kernel) {
+	switch (kernel) {
+	case CLOSURE_KERNEL_SSE2: return "sse2";
+	case CLOSURE_KERNEL_AVX2: return "avx2";
+	default: return "scalar";
+	}
+}
+
+int closure_kernel_select(void) {
+	int limit = CLOSURE_KERNEL_AVX2;
+	const char* env = getenv("JOCT_CLOSURE_KERNEL");
+	int kernel;
+	if (env != NULL) {
+		if (strcmp(env, "scalar") == 0) limit = CLOSURE_KERNEL_SCALAR;
+		else if (strcmp(env, "sse2") == 0) limit = CLOSURE_KERNEL_SSE2;
+	}
+	for (kernel = limit; kernel > CLOSURE_KERNEL_SCALAR; kernel--) {
+		if (closure_kernel_supported(kernel)) {
+			return kernel;
+		}
+	}
+	return CLOSURE_KERNEL_SCALAR;
+}
+
+int closure_kernel_long(int kernel) {
+	return kernel == CLOSURE_KERNEL_AVX2 ? CLOSURE_KERNEL_AVX2 : CLOSURE_KERNEL_SCALAR;
+}
+
+/* ---------- double matrices ---------- */
+
+static void fw_row_double_scalar(double* row, const double* krow, double mik, int dim) {
+	int j;
+	for (j = 0; j < dim; j++) {
+		double v = mik + krow[j];
+		if (v < row[j]) row[j] = v;
+	}
+}
+
+#ifdef CLOSURE_X86
+__attribute__((target("sse2")))
+static void fw_row_double_sse2(double* row, const double* krow, double mik, int dim) {
+	__m128d b = _mm_set1_pd(mik);
+	int j = 0;
+	for (; j + 2 <= dim; j += 2) {
+		__m128d v = _mm_add_pd(b, _mm_loadu_pd(krow + j));
+		_mm_storeu_pd(row + j, _mm_min_pd(_mm_loadu_pd(row + j), v));
+	}
+	fw_row_double_scalar(row + j, krow + j, mik, dim - j);
+}
+
+__attribute__((target("avx2")))
+static void fw_row_double_avx2(double* row, const double* krow, double mik, int dim) {
+	__m256d b = _mm256_set1_pd(mik);
+	int j = 0;
+	for (; j + 4 <= dim; j += 4) {
+		__m256d v = _mm256_add_pd(b, _mm256_loadu_pd(krow + j));
+		_mm256_storeu_pd(row + j, _mm256_min_pd(_mm256_loadu_pd(row + j), v));
+	}
+	fw_row_double_scalar(row + j, krow + j, mik, dim - j);
+}
+
+__attribute__((target("avx2")))
+static void strengthen_row_double_avx2(double* row, const double* half, double hi, int dim) {
+	__m256d b = _mm256_set1_pd(hi);
+	int j = 0;
+	for (; j + 4 <= dim; j += 4) {
+		__m256d v = _mm256_add_pd(b, _mm256_loadu_pd(half + j));
+		_mm256_storeu_pd(row + j, _mm256_min_pd(_mm256_loadu_pd(row + j), v));
+	}
+	for (; j < dim; j++) {
+		double v = hi + half[j];
+		if (v < row[j]) row[j] = v;
+	}
+}
+#endif
+
+int closure_double(double* m, int dim, int kernel) {
+	double* half;
+	int i, j, k;
+
+	for (k = 0; k < dim; k++) {
+		const double* krow = &AT(m, dim, k, 0);
+		for (i = 0; i < dim; i++) {
+			double mik = AT(m, dim, i, k);
+			if (isinf(mik)) continue;
+#ifdef CLOSURE_X86
+			if (kernel == CLOSURE_KERNEL_AVX2) {
+				fw_row_double_avx2(&AT(m, dim, i, 0), krow, mik, dim);
+				continue;
+			} else if (kernel == CLOSURE_KERNEL_SSE2) {
+				fw_row_double_sse2(&AT(m, dim, i, 0), krow, mik, dim);
+				continue;
+			}
+#endif
+			fw_row_double_scalar(&AT(m, dim, i, 0), krow, mik, dim);
+		}
+	}
+
+	for (i = 0; i < dim; i++) {
+		if (AT(m, dim, i, i) < 0) return 0;
+	}
+
+	/* strengthening: m[i][j] = min(m[i][j], (m[i][i^1] + m[j^1][j]) / 2) */
+	half = (double*) malloc(sizeof(double) * (dim > 0 ? dim : 1));
+	for (j = 0; j < dim; j++) {
+		half[j] = AT(m, dim, j ^ 1, j) / 2;
+	}
+	for (i = 0; i < dim; i++) {
+		double hi = half[i ^ 1];
+		if (isinf(hi)) continue;
+#ifdef CLOSURE_X86
+		if (kernel == CLOSURE_KERNEL_AVX2) {
+			strengthen_row_double_avx2(&AT(m, dim, i, 0), half, hi, dim);
+			continue;
+		}
+#endif
+		for (j = 0; j < dim; j++) {
+			double v = hi + half[j];
+			if (v < AT(m, dim, i, j)) AT(m, dim, i, j) = v;
+		}
+	}
+	free(half);
+
+	for (i = 0; i < dim; i++) {
+		if (AT(m, dim, i, i) < 0) return 0;
+		AT(m, dim, i, i) = 0;
+	}
+	return 1;
+}
+
+/* ---------- int64 matrices ---------- */
+
+static int64_t sat_add(int64_t a, int64_t b) {
+	int64_t v;
+	if (__builtin_add_overflow(a, b, &v)) {
+		return a < 0 ? INT64_MIN : CLOSURE_INF_LONG;
+	}
+	return v;
+}
+
+static void fw_row_long_scalar(int64_t* row, const int64_t* krow, int64_t mik, int dim) {
+	int j;
+	for (j = 0; j < dim; j++) {
+		if (krow[j] != CLOSURE_INF_LONG) {
+			int64_t v = sat_add(mik, krow[j]);
+			if (v < row[j]) row[j] = v;
+		}
+	}
+}
+
+#ifdef CLOSURE_X86
+__attribute__((target("avx2")))
+static void fw_row_long_avx2(int64_t* row, const int64_t* krow, int64_t mik, int dim) {
+	__m256i b = _mm256_set1_epi64x(mik);
+	__m256i inf = _mm256_set1_epi64x(CLOSURE_INF_LONG);
+	__m256i zero = _mm256_setzero_si256();
+	/* saturated value of an overflowing sum, INT64_MIN if both summands are negative */
+	__m256i sat = _mm256_xor_si256(inf, _mm256_cmpgt_epi64(zero, b));
+	int j = 0;
+	for (; j + 4 <= dim; j += 4) {
+		__m256i k = _mm256_loadu_si256((const __m256i*) (krow + j));
+		__m256i r = _mm256_loadu_si256((const __m256i*) (row + j));
+		__m256i v = _mm256_add_epi64(b, k);
+		/* the sum overflowed iff its sign differs from the signs of both summands */
+		__m256i overflow = _mm256_cmpgt_epi64(zero,
+				_mm256_and_si256(_mm256_xor_si256(b, v), _mm256_xor_si256(k, v)));
+		v = _mm256_blendv_epi8(v, sat, overflow);
+		/* infinite entries of krow stay infinite */
+		v = _mm256_blendv_epi8(v, inf, _mm256_cmpeq_epi64(k, inf));
+		__m256i smaller = _mm256_cmpgt_epi64(r, v);
+		_mm256_storeu_si256((__m256i*) (row + j), _mm256_blendv_epi8(r, v, smaller));
+	}
+	fw_row_long_scalar(row + j, krow + j, mik, dim - j);
+}
+#endif
+
+static int64_t floor_half(int64_t v) {
+	return v >= 0 ? v / 2 : v / 2 - (v % 2 != 0);
+}
+
+int closure_long(int64_t* m, int dim, int kernel) {
+	int64_t* half;
+	int i, j, k;
+
+	kernel = closure_kernel_long(kernel);
+	for (k = 0; k < dim; k++) {
+		const int64_t* krow = &AT(m, dim, k, 0);
+		for (i = 0; i < dim; i++) {
+			int64_t mik = AT(m, dim, i, k);
+			if (mik == CLOSURE_INF_LONG) continue;
+#ifdef CLOSURE_X86
+			if (kernel == CLOSURE_KERNEL_AVX2) {
+				fw_row_long_avx2(&AT(m, dim, i, 0), krow, mik, dim);
+				continue;
+			}
+#endif
+			fw_row_long_scalar(&AT(m, dim, i, 0), krow, mik, dim);
+		}
+	}
+
+	for (i = 0; i < dim; i++) {
+		if (AT(m, dim, i, i) < 0) return 0;
+	}
+
+	/* tightening: unary constraints 2 * x <= c become 2 * x <= 2 * floor(c / 2) */
+	half = (int64_t*) malloc(sizeof(int64_t) * (dim > 0 ? dim : 1));
+	for (j = 0; j < dim; j++) {
+		int64_t c = AT(m, dim, j ^ 1, j);
+		half[j] = c == CLOSURE_INF_LONG ? CLOSURE_INF_LONG : floor_half(c);
+	}
+	for (i = 0; i < dim; i += 2) {
+		if (half[i] != CLOSURE_INF_LONG && half[i + 1] != CLOSURE_INF_LONG
+				&& sat_add(half[i], half[i + 1]) < 0) {
+			free(half);
+			return 0;
+		}
+	}
+
+	/* strengthening, halves of tightened bounds are exact */
+	for (i = 0; i < dim; i++) {
+		int64_t hi = half[i ^ 1];
+		if (hi == CLOSURE_INF_LONG) continue;
+		for (j = 0; j < dim; j++) {
+			if (half[j] != CLOSURE_INF_LONG) {
+				int64_t v = sat_add(hi, half[j]);
+				if (v < AT(m, dim, i, j)) AT(m, dim, i, j) = v;
+			}
+		}
+	}
+	free(half);
+
+	for (i = 0; i < dim; i++) {
+		if (AT(m, dim, i, i) < 0) return 0;
+		AT(m, dim, i, i) = 0;
+	}
+	return 1;
+}
@@ -0,0 +1,53 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+ * Strong closure of octagon difference-bound matrices with vectorized kernels.
+ *
+ * The matrices are full (not half) row-major matrices of dimension dim = 2 * number of variables,
+ * such that rows can be processed with contiguous vector loads. Infinity is represented by
+ * INFINITY for double matrices and by CLOSURE_INF_LONG for int64 matrices. Sums of int64 entries
+ * saturate, so all finite entries are allowed.
+ *
+ * The kernel is picked at runtime by CPU feature detection, the scalar kernel is always available.
+ * The environment variable JOCT_CLOSURE_KERNEL (scalar, sse2, avx2) restricts the choice.
+ * The SSE2 kernel exists only for double matrices, int64 matrices use the scalar kernel instead.
+ */
+
+#ifndef OCT_CLOSURE_SIMD_H
+#define OCT_CLOSURE_SIMD_H
+
+#include <stdint.h>
+
+#define CLOSURE_KERNEL_SCALAR 0
+#define CLOSURE_KERNEL_SSE2 1
+#define CLOSURE_KERNEL_AVX2 2
+
+#define CLOSURE_INF_LONG INT64_MAX
+
+/* returns the best kernel supported by this CPU (and allowed by JOCT_CLOSURE_KERNEL) */
+int closure_kernel_select(void);
+
+/* returns whether the CPU supports the given kernel */
+int closure_kernel_supported(int kernel);
+
+const char* closure_kernel_name(int kernel);
+
+/* returns the kernel that closure_long actually uses if it is given the kernel */
+int closure_kernel_long(int kernel);
+
+/*
+ * Compute the strong closure of m in place with the given kernel.
+ * Returns 0 if the octagon is empty (m is undefined afterwards), 1 otherwise.
+ */
+int closure_double(double* m, int dim, int kernel);
+
+/* like closure_double, but computes the tight closure for integer octagons */
+int closure_long(int64_t* m, int dim, int kernel);
+
+#endif
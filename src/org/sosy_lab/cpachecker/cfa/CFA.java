@@ -9,12 +9,14 @@
 package org.sosy_lab.cpachecker.cfa;
 
 import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Iterables;
 import java.nio.file.Path;
 import java.util.List;
 import java.util.NavigableMap;
 import java.util.NavigableSet;
 import java.util.Optional;
 import org.sosy_lab.cpachecker.cfa.graph.CfaNetwork;
+import org.sosy_lab.cpachecker.cfa.graph.CompactCfa;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
@@ -61,6 +63,19 @@ public interface CFA extends CfaNetwork {
     return getLoopStructure().map(LoopStructure::getAllLoopHeads);
   }
 
+  /**
+   * Returns a compact, array-based view of this CFA for hot traversals, see {@link CompactCfa}.
+   *
+   * <p>The view reflects the current state of this CFA. For mutable CFAs, a new view is created on
+   * every call, while immutable CFAs create it only once.
+   */
+  default CompactCfa getCompactCfa() {
+    return CompactCfa.of(
+        this,
+        getAllLoopHeads()
+            .orElseGet(() -> ImmutableSet.copyOf(Iterables.filter(nodes(), CFANode::isLoopStart))));
+  }
+
   default Optional<VariableClassification> getVarClassification() {
     return getMetadata().getVariableClassification();
   }
@@ -32,6 +32,7 @@ import java.util.Set;
 import java.util.logging.Level;
 import java.util.stream.Collectors;
 import java.util.zip.GZIPOutputStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.Concurrency;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
@@ -42,6 +43,8 @@ import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.cfa.CfaCache.IncrementalLoopStructure;
+import org.sosy_lab.cpachecker.cfa.FunctionFingerprints.FunctionChanges;
 import org.sosy_lab.cpachecker.cfa.ast.ADeclaration;
 import org.sosy_lab.cpachecker.cfa.ast.AExpression;
 import org.sosy_lab.cpachecker.cfa.ast.AFunctionCall;
@@ -100,6 +103,7 @@ import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.ast.ASTStructure;
 import org.sosy_lab.cpachecker.util.cwriter.CFAToCTranslator;
 import org.sosy_lab.cpachecker.util.cwriter.CfaToCExporter;
+import org.sosy_lab.cpachecker.util.statistics.ProcessCpuTimer;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsUtils;
 import org.sosy_lab.cpachecker.util.variableclassification.VariableClassificationBuilder;
 
@@ -345,6 +349,13 @@ public class CFACreator {
     private final Timer exportTime = new Timer();
     private final Timer loopStructureTime = new Timer();
     private final Timer astStructureTime = new Timer();
+    private final Timer cacheTime = new Timer();
+    private final ProcessCpuTimer totalCpuTime = new ProcessCpuTimer();
+    private @Nullable ProcessCpuTimer parsingCpuTime;
+    private @Nullable ProcessCpuTimer conversionCpuTime;
+    private final ProcessCpuTimer processingCpuTime = new ProcessCpuTimer();
+    private @Nullable FunctionChanges functionChanges;
+    private @Nullable Integer functionsWithReusedLoops;
     private final List<Statistics> statisticsCollection;
     private final LogManager logger;
 
@@ -372,6 +383,36 @@ public class CFACreator {
       if (exportTime.getNumberOfIntervals() > 0) {
         out.println("    Time for CFA export:      " + exportTime);
       }
+      if (cacheTime.getNumberOfIntervals() > 0) {
+        out.println("    Time for CFA cache:       " + cacheTime);
+      }
+      if (functionChanges != null) {
+        out.println(
+            "  Number of changed functions:  "
+                + functionChanges.changed().size()
+                + " (of "
+                + functionChanges.numberOfFunctions()
+                + ", added: "
+                + functionChanges.added().size()
+                + ", removed: "
+                + functionChanges.removed().size()
+                + ")");
+      }
+      if (functionsWithReusedLoops != null) {
+        out.println("  Number of functions with reused loops: " + functionsWithReusedLoops);
+      }
+
+      // the CPU time of all threads, for comparison with the wall time above
+      if (totalCpuTime.isAvailable()) {
+        out.println("  CPU time for CFA construction:  " + totalCpuTime);
+        if (parsingCpuTime != null) {
+          out.println("    CPU time for parsing file(s): " + parsingCpuTime);
+        }
+        if (conversionCpuTime != null) {
+          out.println("    CPU time for AST to CFA:      " + conversionCpuTime);
+        }
+        out.println("    CPU time for post-processing: " + processingCpuTime);
+      }
 
       for (Statistics st : statisticsCollection) {
         StatisticsUtils.printStatistics(st, out, logger, pResult, pReached);
@@ -388,6 +429,7 @@ public class CFACreator {
 
   private final CFACreatorStatistics stats;
   private final Configuration config;
+  private final CfaCache cfaCache;
 
   public CFACreator(Configuration config, LogManager logger, ShutdownNotifier pShutdownNotifier)
       throws InvalidConfigurationException {
@@ -398,6 +440,7 @@ public class CFACreator {
     this.logger = logger;
     shutdownNotifier = pShutdownNotifier;
     stats = new CFACreatorStatistics(logger);
+    cfaCache = new CfaCache(config, logger, usePreprocessor || useClang);
 
     stats.parserInstantiationTime.start();
     String regExPattern;
@@ -451,6 +494,8 @@ public class CFACreator {
 
     stats.parsingTime = parser.getParseTime();
     stats.conversionTime = parser.getCFAConstructionTime();
+    stats.parsingCpuTime = parser.getParseCpuTime();
+    stats.conversionCpuTime = parser.getCFAConstructionCpuTime();
 
     stats.parserInstantiationTime.stop();
   }
@@ -468,15 +513,17 @@ public class CFACreator {
       throws InvalidConfigurationException, ParserException, InterruptedException {
 
     stats.totalTime.start();
+    stats.totalCpuTime.start();
     try {
       ParseResult parseResult = parseToCFAs(program);
       FunctionEntryNode mainFunction = parseResult.getFunctions().get(mainFunctionName);
       assert mainFunction != null : "program lacks main function.";
 
-      CFA cfa = createCFA(parseResult, mainFunction);
+      CFA cfa = createCFA(parseResult, mainFunction, null);
 
       return cfa;
     } finally {
+      stats.totalCpuTime.stop();
       stats.totalTime.stop();
     }
   }
@@ -498,7 +545,23 @@ public class CFACreator {
         !sourceFiles.isEmpty(), "At least one source file must be provided!");
 
     stats.totalTime.start();
+    stats.totalCpuTime.start();
     try {
+      if (cfaCache.isEnabled()) {
+        stats.cacheTime.start();
+        final CFA cachedCfa;
+        try {
+          cachedCfa = cfaCache.load(sourceFiles);
+        } finally {
+          stats.cacheTime.stop();
+        }
+        if (cachedCfa != null) {
+          logger.log(Level.INFO, "Loaded CFA from cache, skipping parsing.");
+          exportCFAIfRequested(cachedCfa);
+          return cachedCfa;
+        }
+      }
+
       // FIRST, parse file(s) and create CFAs for each function
       logger.log(Level.FINE, "Starting parsing of file(s)");
 
@@ -506,6 +569,23 @@ public class CFACreator {
 
       logger.log(Level.FINE, "Parser Finished");
 
+      if (cfaCache.shouldDetectChangedFunctions()) {
+        stats.cacheTime.start();
+        try {
+          stats.functionChanges = cfaCache.detectChangedFunctions(sourceFiles, c);
+        } finally {
+          stats.cacheTime.stop();
+        }
+        if (stats.functionChanges != null) {
+          logger.logf(
+              Level.INFO,
+              "Functions changed since previous run: %s, added: %s, removed: %s",
+              stats.functionChanges.changed(),
+              stats.functionChanges.added(),
+              stats.functionChanges.removed());
+        }
+      }
+
       FunctionEntryNode mainFunction;
 
       switch (language) {
@@ -520,7 +600,7 @@ public class CFACreator {
           throw new AssertionError();
       }
 
-      CFA cfa = createCFA(c, mainFunction);
+      CFA cfa = createCFA(c, mainFunction, sourceFiles);
 
       if (!commentPositions.isEmpty()) {
         SyntacticBlockStructureBuilder blockStructureBuilder =
@@ -531,9 +611,19 @@ public class CFACreator {
                 sourceFiles, cfa, logger, commentPositions, blockStructureBuilder.build());
       }
 
+      if (cfaCache.isEnabled()) {
+        stats.cacheTime.start();
+        try {
+          cfaCache.store(sourceFiles, cfa);
+        } finally {
+          stats.cacheTime.stop();
+        }
+      }
+
       return cfa;
 
     } finally {
+      stats.totalCpuTime.stop();
       stats.totalTime.stop();
     }
   }
@@ -578,7 +668,15 @@ public class CFACreator {
                 "Method " + mainFunction + " not found.\n" + EXAMPLE_JAVA_METHOD_NAME));
   }
 
-  private CFA createCFA(ParseResult pParseResult, FunctionEntryNode pMainFunction)
+  /**
+   * Create the CFA from the CFAs of the functions in the given parse result.
+   *
+   * @param pSourceFiles the parsed files, or null if the program was not parsed from files
+   */
+  private CFA createCFA(
+      ParseResult pParseResult,
+      FunctionEntryNode pMainFunction,
+      @Nullable List<String> pSourceFiles)
       throws InvalidConfigurationException, InterruptedException, ParserException {
 
     FunctionEntryNode mainFunction = pMainFunction;
@@ -606,6 +704,7 @@ public class CFACreator {
 
     // SECOND, do those post-processings that change the CFA by adding/removing nodes/edges
     stats.processingTime.start();
+    stats.processingCpuTime.start();
 
     cfa = postProcessingOnMutableCFAs(cfa, pParseResult.getGlobalDeclarations());
 
@@ -631,7 +730,7 @@ public class CFACreator {
     // (needs post-order information)
     if (useLoopStructure) {
       stats.loopStructureTime.start();
-      addLoopStructure(cfa);
+      addLoopStructure(cfa, pSourceFiles);
       stats.loopStructureTime.stop();
     }
 
@@ -671,6 +770,7 @@ public class CFACreator {
               pParseResult.getGlobalDeclarations(), cfa, logger, shutdownNotifier, config));
     }
 
+    stats.processingCpuTime.stop();
     stats.processingTime.stop();
 
     final ImmutableCFA immutableCFA = cfa.immutableCopy();
@@ -685,14 +785,7 @@ public class CFACreator {
     assert CFACheck.check(mainFunction, null, machineModel);
     stats.checkTime.stop();
 
-    if (((exportCfaFile != null) && (exportCfa || exportCfaPerFunction))
-        || ((exportFunctionCallsFile != null) && exportFunctionCalls)
-        || ((exportFunctionCallsUsedFile != null) && exportFunctionCalls)
-        || ((serializeCfaFile != null) && serializeCfa)
-        || (exportCfaPixelFile != null)
-        || (exportCfaToCFile != null && exportCfaToC)) {
-      exportCFAAsync(immutableCFA);
-    }
+    exportCFAIfRequested(immutableCFA);
 
     logger.log(
         Level.FINE, "DONE, CFA for", immutableCFA.getNumberOfFunctions(), "functions created.");
@@ -1006,9 +1099,20 @@ public class CFACreator {
     }
   }
 
-  private void addLoopStructure(MutableCFA cfa) {
+  private void addLoopStructure(MutableCFA cfa, @Nullable List<String> pSourceFiles) {
     try {
-      cfa.setLoopStructure(LoopStructure.getLoopStructure(cfa));
+      if (pSourceFiles != null && cfaCache.shouldBuildLoopStructureIncrementally()) {
+        IncrementalLoopStructure loopStructure = cfaCache.getLoopStructure(pSourceFiles, cfa);
+        stats.functionsWithReusedLoops = loopStructure.reusedFunctions();
+        logger.log(
+            Level.FINE,
+            "Reused loops of",
+            loopStructure.reusedFunctions(),
+            "unchanged functions from previous run.");
+        cfa.setLoopStructure(loopStructure.loopStructure());
+      } else {
+        cfa.setLoopStructure(LoopStructure.getLoopStructure(cfa));
+      }
 
     } catch (ParserException e) {
       // don't abort here, because if the analysis doesn't need the loop information, we can
@@ -1157,6 +1261,17 @@ public class CFACreator {
     }
   }
 
+  private void exportCFAIfRequested(final CFA cfa) {
+    if (((exportCfaFile != null) && (exportCfa || exportCfaPerFunction))
+        || ((exportFunctionCallsFile != null) && exportFunctionCalls)
+        || ((exportFunctionCallsUsedFile != null) && exportFunctionCalls)
+        || ((serializeCfaFile != null) && serializeCfa)
+        || (exportCfaPixelFile != null)
+        || (exportCfaToCFile != null && exportCfaToC)) {
+      exportCFAAsync(cfa);
+    }
+  }
+
   private void exportCFAAsync(final CFA cfa) {
     // Execute asynchronously, this may take several seconds for large programs on slow disks.
     // This is safe because we don't modify the CFA from this point on.
@@ -14,6 +14,7 @@ import java.util.NavigableMap;
 import java.util.NavigableSet;
 import org.sosy_lab.cpachecker.cfa.ast.acsl.ACSLAnnotation;
 import org.sosy_lab.cpachecker.cfa.graph.CfaNetwork;
+import org.sosy_lab.cpachecker.cfa.graph.CompactCfa;
 import org.sosy_lab.cpachecker.cfa.graph.ForwardingCfaNetwork;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
@@ -67,4 +68,9 @@ public class CFAWithACSLAnnotations extends ForwardingCfaNetwork implements CFA
   public CfaMetadata getMetadata() {
     return delegate.getMetadata();
   }
+
+  @Override
+  public CompactCfa getCompactCfa() {
+    return delegate.getCompactCfa();
+  }
 }
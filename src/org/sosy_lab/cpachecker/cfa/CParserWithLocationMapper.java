@@ -15,6 +15,7 @@ import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.eclipse.cdt.core.parser.IToken;
 import org.eclipse.cdt.core.parser.OffsetLimitReachedException;
 import org.eclipse.cdt.internal.core.parser.scanner.ILexerLog;
@@ -33,6 +34,7 @@ import org.sosy_lab.cpachecker.cfa.ast.c.CAstNode;
 import org.sosy_lab.cpachecker.cfa.parser.Scope;
 import org.sosy_lab.cpachecker.cfa.parser.eclipse.c.BOMParser;
 import org.sosy_lab.cpachecker.exceptions.CParserException;
+import org.sosy_lab.cpachecker.util.statistics.ProcessCpuTimer;
 
 /** Encapsulates a {@link CParser} instance and tokenizes all files first. */
 @Options
@@ -198,6 +200,16 @@ public class CParserWithLocationMapper implements CParser {
     return realParser.getCFAConstructionTime();
   }
 
+  @Override
+  public @Nullable ProcessCpuTimer getParseCpuTime() {
+    return realParser.getParseCpuTime();
+  }
+
+  @Override
+  public @Nullable ProcessCpuTimer getCFAConstructionCpuTime() {
+    return realParser.getCFAConstructionCpuTime();
+  }
+
   @Override
   public ParseResult parseFiles(List<String> pFilenames)
       throws CParserException, IOException, InterruptedException {
@@ -11,11 +11,13 @@ package org.sosy_lab.cpachecker.cfa;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.List;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.ast.c.CAstNode;
 import org.sosy_lab.cpachecker.cfa.parser.Scope;
 import org.sosy_lab.cpachecker.exceptions.CParserException;
 import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.statistics.ProcessCpuTimer;
 
 /**
  * Encapsulates a {@link CParser} instance and processes all files first with a {@link
@@ -48,6 +50,16 @@ class CParserWithPreprocessor implements CParser {
     return realParser.getCFAConstructionTime();
   }
 
+  @Override
+  public @Nullable ProcessCpuTimer getParseCpuTime() {
+    return realParser.getParseCpuTime();
+  }
+
+  @Override
+  public @Nullable ProcessCpuTimer getCFAConstructionCpuTime() {
+    return realParser.getCFAConstructionCpuTime();
+  }
+
   @Override
   public ParseResult parseFiles(List<String> pFilenames)
       throws ParserException, InterruptedException {
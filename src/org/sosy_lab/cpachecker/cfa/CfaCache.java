@@ -0,0 +1,555 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+import static java.nio.charset.StandardCharsets.ISO_8859_1;
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.google.common.base.Joiner;
+import com.google.common.base.Splitter;
+import com.google.common.collect.Collections2;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.ImmutableSortedMap;
+import com.google.common.collect.Maps;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.io.BufferedOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.io.OutputStream;
+import java.io.Serializable;
+import java.io.Writer;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.logging.Level;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.io.IO;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.FunctionFingerprints.FunctionChanges;
+import org.sosy_lab.cpachecker.cfa.FunctionFingerprints.FunctionNodes;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.CPAchecker;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.LoopStructure;
+import org.sosy_lab.cpachecker.util.LoopStructure.Loop;
+
+/**
+ * Cache for finished CFAs (including metadata like the variable classification and the loop
+ * structure) across runs on the same program, e.g., for several configurations of a portfolio.
+ *
+ * <p>The key of a cached CFA is a hash of the CPAchecker version, the names and contents of the
+ * input files and of all files they include, and all options that influence the parsing and the
+ * CFA creation (e.g., the machine model). Included files are found as the parser finds them,
+ * relative to the including file. Programs with an include directive that is given by a macro
+ * cannot be cached, and neither can programs that are processed by an external preprocessor,
+ * because it may read arbitrary system headers. The CFA is stored with Java serialization (as for
+ * option <code>cfa.serialize</code>), but uncompressed, such that it can be loaded quickly from a
+ * memory-mapped file. A cache entry that cannot be read is ignored.
+ *
+ * <p>Additionally, the cache directory can keep data of the last run on the same input files,
+ * independently of their contents: the {@link FunctionFingerprints} of the parsed functions for
+ * reporting which functions changed, and the loops of all functions such that only the loops of
+ * changed functions need to be searched again.
+ */
+@Options(prefix = "cfa.cache")
+final class CfaCache {
+
+  /**
+   * Prefixes of all options that may influence the CFA, except for the options of this class.
+   * CfaCacheTest checks that all options of the classes involved in the CFA creation are covered by
+   * these prefixes or {@link #RELEVANT_OPTIONS}.
+   */
+  private static final ImmutableSet<String> RELEVANT_OPTION_PREFIXES =
+      ImmutableSet.of("cfa.", "parser.", "java.", "liveVar.");
+
+  private static final ImmutableSet<String> RELEVANT_OPTIONS =
+      ImmutableSet.of(
+          "language",
+          "analysis.entryFunction",
+          "analysis.machineModel",
+          "analysis.interprocedural",
+          "analysis.functionPointerCalls",
+          "analysis.functionPointerEdgesForUnknownPointer",
+          "analysis.functionPointerParameterTargets",
+          "analysis.functionPointerTargets",
+          "analysis.matchAssignedFunctionPointers",
+          "analysis.matchAssignedFunctionPointers.ignoreUnknownAssignments",
+          "analysis.replaceFunctionWithParameterPointer",
+          "analysis.replacedFunctionsWithParameters",
+          "analysis.summaryEdges",
+          "analysis.threadOperationsTransform",
+          "analysis.useGlobalVars",
+          "analysis.useASTStructure",
+          "analysis.useLoopStructure");
+
+  private static final Pattern INCLUDE_DIRECTIVE =
+      Pattern.compile("^\\s*#\\s*include\\b(.*)$", Pattern.MULTILINE);
+
+  private static final String FILE_SUFFIX = ".cfa";
+  private static final String FINGERPRINTS_FILE_SUFFIX = ".functions";
+  private static final String LOOPS_FILE_SUFFIX = ".loops";
+
+  @Option(
+      secure = true,
+      description =
+          "Directory for caching the created CFA. Later runs on the same input files with the same"
+              + " options for parsing and CFA creation load the CFA from there instead of parsing"
+              + " the program again. The directory can be shared by several runs at the same"
+              + " time. No caching happens if this option is not set.")
+  @FileOption(FileOption.Type.OUTPUT_DIRECTORY)
+  private @Nullable Path directory = null;
+
+  @Option(
+      secure = true,
+      description =
+          "Detect which functions changed since the previous run on the same input files (with"
+              + " the same options for parsing and CFA creation). This needs a cache directory,"
+              + " where the fingerprints of the functions are stored. The changed functions are"
+              + " logged and written to the file given by changedFunctionsFile.")
+  private boolean detectChangedFunctions = false;
+
+  @Option(
+      secure = true,
+      description =
+          "Build the loop structure incrementally: the loops of each function are stored in the"
+              + " cache directory, and the next run on the same input files (with the same options"
+              + " for parsing and CFA creation) searches only for the loops of functions whose CFA"
+              + " changed after post-processing. The loops of all other functions are taken from"
+              + " the previous run.")
+  private boolean incrementalLoopStructure = false;
+
+  @Option(
+      secure = true,
+      description = "File for the functions that changed since the previous run.")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private @Nullable Path changedFunctionsFile = Path.of("changedFunctions.txt");
+
+  /** The loop structure of a CFA, and the number of functions whose loops were reused. */
+  record IncrementalLoopStructure(LoopStructure loopStructure, int reusedFunctions) {}
+
+  private final Configuration config;
+  private final LogManager logger;
+  private final boolean usesExternalPreprocessor;
+
+  /**
+   * Create the cache.
+   *
+   * @param pUsesExternalPreprocessor whether the program is processed by an external preprocessor
+   *     before parsing, which disables the cache
+   */
+  CfaCache(Configuration pConfig, LogManager pLogger, boolean pUsesExternalPreprocessor)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    config = pConfig;
+    logger = pLogger;
+    usesExternalPreprocessor = pUsesExternalPreprocessor;
+    if (directory != null && usesExternalPreprocessor) {
+      logger.log(
+          Level.INFO,
+          "CFA cache is disabled because the external preprocessor may read files that are not",
+          "part of the cache key.");
+    }
+  }
+
+  boolean isEnabled() {
+    return directory != null && !usesExternalPreprocessor;
+  }
+
+  boolean shouldDetectChangedFunctions() {
+    return directory != null && detectChangedFunctions;
+  }
+
+  boolean shouldBuildLoopStructureIncrementally() {
+    return directory != null && incrementalLoopStructure;
+  }
+
+  /** Load the CFA for the given input files, or return null if it is not cached. */
+  @Nullable CFA load(List<String> pSourceFiles) {
+    Path dir = directory;
+    if (dir == null || usesExternalPreprocessor) {
+      return null;
+    }
+    try {
+      HashCode key = computeKey(pSourceFiles, true);
+      if (key == null) {
+        return null;
+      }
+      Path file = dir.resolve(key + FILE_SUFFIX);
+      if (!Files.isRegularFile(file)) {
+        return null;
+      }
+      try (FileChannel channel = FileChannel.open(file);
+          ObjectInputStream in =
+              new ObjectInputStream(
+                  new ByteBufferInputStream(
+                      channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size())))) {
+        return (CFA) in.readObject();
+      }
+    } catch (IOException | ClassNotFoundException | ClassCastException e) {
+      // a broken cache must never break the analysis
+      logger.logUserException(Level.WARNING, e, "Could not load CFA from cache, parsing again");
+      return null;
+    }
+  }
+
+  /** Store the CFA for the given input files, if possible. */
+  void store(List<String> pSourceFiles, CFA pCfa) {
+    Path dir = directory;
+    if (dir == null || usesExternalPreprocessor) {
+      return;
+    }
+    if (!(pCfa instanceof Serializable)) {
+      logger.log(Level.INFO, "CFA cannot be cached because it is not serializable");
+      return;
+    }
+    try {
+      HashCode key = computeKey(pSourceFiles, true);
+      if (key == null) {
+        logger.log(
+            Level.INFO,
+            "CFA cannot be cached because the program includes a file whose name is given by a",
+            "macro.");
+        return;
+      }
+      Path file = dir.resolve(key + FILE_SUFFIX);
+      Files.createDirectories(dir);
+      // write to a temporary file first, such that concurrent runs never read a partial file
+      Path tmpFile = Files.createTempFile(dir, "cfa", ".tmp");
+      try {
+        try (OutputStream out = new BufferedOutputStream(Files.newOutputStream(tmpFile));
+            ObjectOutputStream oos = new ObjectOutputStream(out)) {
+          oos.writeObject(pCfa);
+        }
+        Files.move(tmpFile, file, StandardCopyOption.ATOMIC_MOVE);
+      } finally {
+        Files.deleteIfExists(tmpFile);
+      }
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not store CFA in cache");
+    }
+  }
+
+  /**
+   * Compare the functions of the given parse result with the previous run on the same input files
+   * and remember their fingerprints for the next run. The changes are also written to a file.
+   *
+   * @return the changes, or null if there was no previous run
+   */
+  @Nullable FunctionChanges detectChangedFunctions(
+      List<String> pSourceFiles, ParseResult pParseResult) {
+    Path dir = directory;
+    if (dir == null || !detectChangedFunctions) {
+      return null;
+    }
+    ImmutableSortedMap<String, HashCode> fingerprints = FunctionFingerprints.of(pParseResult);
+    FunctionChanges changes = null;
+    try {
+      // the same file is used for all versions of the input files
+      Path file = dir.resolve(computeKey(pSourceFiles, false) + FINGERPRINTS_FILE_SUFFIX);
+      if (Files.isRegularFile(file)) {
+        Map<String, HashCode> previous = new HashMap<>();
+        for (String line : Files.readAllLines(file, UTF_8)) {
+          List<String> parts = Splitter.on(' ').limit(2).splitToList(line);
+          if (parts.size() == 2) {
+            previous.put(parts.get(1), HashCode.fromString(parts.get(0)));
+          }
+        }
+        changes = FunctionFingerprints.diff(previous, fingerprints);
+      }
+
+      Files.createDirectories(dir);
+      Path tmpFile = Files.createTempFile(dir, "functions", ".tmp");
+      try {
+        Files.write(
+            tmpFile,
+            Collections2.transform(fingerprints.entrySet(), e -> e.getValue() + " " + e.getKey()),
+            UTF_8);
+        Files.move(tmpFile, file, StandardCopyOption.ATOMIC_MOVE);
+      } finally {
+        Files.deleteIfExists(tmpFile);
+      }
+    } catch (IOException | IllegalArgumentException e) {
+      logger.logUserException(Level.WARNING, e, "Could not compare functions with previous run");
+    }
+
+    if (changes != null && changedFunctionsFile != null) {
+      try (Writer w = IO.openOutputFile(changedFunctionsFile, UTF_8)) {
+        for (String function : changes.changed()) {
+          w.append("changed ").append(function).append('\n');
+        }
+        for (String function : changes.added()) {
+          w.append("added ").append(function).append('\n');
+        }
+        for (String function : changes.removed()) {
+          w.append("removed ").append(function).append('\n');
+        }
+      } catch (IOException e) {
+        logger.logUserException(Level.WARNING, e, "Could not write changed functions to file");
+      }
+    }
+    return changes;
+  }
+
+  /**
+   * Compute the loop structure of the given CFA, which must not have super edges yet. The loops of
+   * all functions that did not change since the previous run on the same input files are reused,
+   * and the loops of all functions are remembered for the next run.
+   */
+  IncrementalLoopStructure getLoopStructure(List<String> pSourceFiles, MutableCFA pCfa)
+      throws ParserException {
+    Path dir = checkNotNull(directory);
+    Map<String, FunctionNodes> functions = new HashMap<>();
+    for (String function : pCfa.getAllFunctionNames()) {
+      FunctionNodes nodes =
+          FunctionFingerprints.ofFunction(
+              pCfa.getFunctionHead(function), pCfa.getFunctionNodes(function));
+      if (nodes != null) {
+        functions.put(function, nodes);
+      }
+    }
+
+    @Nullable Path file = null;
+    Map<String, List<Loop>> reusedLoops = ImmutableMap.of();
+    try {
+      // the same file is used for all versions of the input files
+      file = dir.resolve(computeKey(pSourceFiles, false) + LOOPS_FILE_SUFFIX);
+      if (Files.isRegularFile(file)) {
+        reusedLoops = readLoops(file, functions);
+      }
+    } catch (IOException | IllegalArgumentException | IndexOutOfBoundsException e) {
+      logger.logUserException(Level.WARNING, e, "Could not reuse loops of previous run");
+    }
+    LoopStructure loopStructure = LoopStructure.getLoopStructure(pCfa, reusedLoops);
+
+    if (file != null) {
+      try {
+        Files.createDirectories(dir);
+        Path tmpFile = Files.createTempFile(dir, "loops", ".tmp");
+        try {
+          Files.write(tmpFile, writeLoops(functions, loopStructure), UTF_8);
+          Files.move(tmpFile, file, StandardCopyOption.ATOMIC_MOVE);
+        } finally {
+          Files.deleteIfExists(tmpFile);
+        }
+      } catch (IOException e) {
+        logger.logUserException(Level.WARNING, e, "Could not store loops for next run");
+      }
+    }
+    return new IncrementalLoopStructure(loopStructure, reusedLoops.size());
+  }
+
+  /**
+   * Read the loops of the previous run for all functions whose fingerprint did not change. A
+   * function is written as a line <code>function FINGERPRINT NAME</code>, followed by one line
+   * <code>loop HEADS NODES</code> for each of its loops, where the nodes are given by their
+   * positions in {@link FunctionNodes#nodes()}.
+   */
+  private static Map<String, List<Loop>> readLoops(
+      Path pFile, Map<String, FunctionNodes> pFunctions) throws IOException {
+    Map<String, List<Loop>> result = new HashMap<>();
+    @Nullable FunctionNodes reused = null;
+    List<Loop> reusedLoops = new ArrayList<>();
+    for (String line : Files.readAllLines(pFile, UTF_8)) {
+      List<String> parts = Splitter.on(' ').limit(3).splitToList(line);
+      if (parts.size() != 3) {
+        throw new IllegalArgumentException("Invalid line in loops file: " + line);
+      }
+      if (parts.get(0).equals("function")) {
+        FunctionNodes function = pFunctions.get(parts.get(2));
+        if (function != null && function.fingerprint().equals(HashCode.fromString(parts.get(1)))) {
+          reused = function;
+          reusedLoops = new ArrayList<>();
+          result.put(parts.get(2), reusedLoops);
+        } else {
+          reused = null;
+        }
+      } else if (parts.get(0).equals("loop")) {
+        if (reused != null) {
+          reusedLoops.add(
+              Loop.restore(
+                  toNodes(parts.get(1), reused.nodes()), toNodes(parts.get(2), reused.nodes())));
+        }
+      } else {
+        throw new IllegalArgumentException("Invalid line in loops file: " + line);
+      }
+    }
+    return result;
+  }
+
+  private static Set<CFANode> toNodes(String pIds, List<CFANode> pNodes) {
+    Set<CFANode> result = new HashSet<>();
+    for (String id : Splitter.on(',').split(pIds)) {
+      result.add(pNodes.get(Integer.parseInt(id)));
+    }
+    return result;
+  }
+
+  private static List<String> writeLoops(
+      Map<String, FunctionNodes> pFunctions, LoopStructure pLoopStructure) {
+    List<String> lines = new ArrayList<>();
+    for (Map.Entry<String, FunctionNodes> function : pFunctions.entrySet()) {
+      List<CFANode> nodes = function.getValue().nodes();
+      Map<CFANode, Integer> ids = Maps.newHashMapWithExpectedSize(nodes.size());
+      for (int i = 0; i < nodes.size(); i++) {
+        ids.put(nodes.get(i), i);
+      }
+      lines.add("function " + function.getValue().fingerprint() + " " + function.getKey());
+      for (Loop loop : pLoopStructure.getLoopsForFunction(function.getKey())) {
+        lines.add(
+            "loop "
+                + Joiner.on(',').join(Collections2.transform(loop.getLoopHeads(), ids::get))
+                + " "
+                + Joiner.on(',').join(Collections2.transform(loop.getLoopNodes(), ids::get)));
+      }
+    }
+    return lines;
+  }
+
+  /**
+   * Compute the key for the given input files and the current options, optionally including the
+   * contents of the input files and of the files they include.
+   *
+   * @return the key, or null if the included files cannot be determined
+   */
+  private @Nullable HashCode computeKey(List<String> pSourceFiles, boolean pWithContents)
+      throws IOException {
+    Hasher hasher =
+        Hashing.sha256()
+            .newHasher()
+            .putString(CPAchecker.getPlainVersion(), UTF_8)
+            .putInt(pSourceFiles.size());
+    for (String sourceFile : pSourceFiles) {
+      hasher.putString(sourceFile, UTF_8);
+      if (pWithContents && !putContents(hasher, Path.of(sourceFile))) {
+        return null;
+      }
+    }
+    for (String line : config.asPropertiesString().split("\n")) {
+      String option = line.split(" ", 2)[0].trim();
+      if (isRelevantOption(option)) {
+        hasher.putString(line, UTF_8);
+      }
+    }
+    return hasher.hash();
+  }
+
+  /**
+   * Add the contents of the given file and of all files it includes (transitively) to the hasher.
+   * An include directive is resolved relative to the including file like the parser does, and the
+   * absence of an included file is part of the key as well. Include directives in disabled
+   * preprocessor branches are also considered, which can only lead to unnecessary cache misses.
+   *
+   * @return false if an included file is given by a macro and thus cannot be determined
+   */
+  private static boolean putContents(Hasher pHasher, Path pFile) throws IOException {
+    Set<Path> visited = new HashSet<>();
+    Deque<Path> waitlist = new ArrayDeque<>();
+    waitlist.add(pFile);
+    while (!waitlist.isEmpty()) {
+      Path file = waitlist.removeFirst();
+      if (!visited.add(file)) {
+        continue;
+      }
+      pHasher.putString(file.toString(), UTF_8);
+      if (!Files.isRegularFile(file)) {
+        pHasher.putBoolean(false);
+        if (file.equals(pFile)) {
+          throw new NoSuchFileException(file.toString());
+        }
+        continue;
+      }
+      byte[] contents = Files.readAllBytes(file);
+      pHasher.putBoolean(true).putInt(contents.length).putBytes(contents);
+
+      // every byte is a char in ISO-8859-1, so this never fails for other encodings
+      Matcher matcher = INCLUDE_DIRECTIVE.matcher(new String(contents, ISO_8859_1));
+      while (matcher.find()) {
+        String argument = matcher.group(1).trim();
+        int end = -1;
+        if (argument.startsWith("\"")) {
+          end = argument.indexOf('"', 1);
+        } else if (argument.startsWith("<")) {
+          end = argument.indexOf('>', 1);
+        }
+        if (end < 0) {
+          return false;
+        }
+        waitlist.add(file.resolveSibling(argument.substring(1, end)).normalize());
+      }
+    }
+    return true;
+  }
+
+  @VisibleForTesting
+  static boolean isRelevantOption(String pOption) {
+    if (pOption.startsWith("cfa.cache.")) {
+      return false;
+    }
+    return RELEVANT_OPTIONS.contains(pOption)
+        || RELEVANT_OPTION_PREFIXES.stream().anyMatch(pOption::startsWith);
+  }
+
+  /** Makes a (memory-mapped) buffer readable for {@link ObjectInputStream}. */
+  private static final class ByteBufferInputStream extends InputStream {
+
+    private final ByteBuffer buffer;
+
+    ByteBufferInputStream(ByteBuffer pBuffer) {
+      buffer = pBuffer;
+    }
+
+    @Override
+    public int read() {
+      return buffer.hasRemaining() ? Byte.toUnsignedInt(buffer.get()) : -1;
+    }
+
+    @Override
+    public int read(byte[] pBytes, int pOffset, int pLength) {
+      if (pLength == 0) {
+        return 0;
+      }
+      if (!buffer.hasRemaining()) {
+        return -1;
+      }
+      int length = Math.min(pLength, buffer.remaining());
+      buffer.get(pBytes, pOffset, length);
+      return length;
+    }
+
+    @Override
+    public int available() {
+      return buffer.remaining();
+    }
+  }
+}
@@ -0,0 +1,300 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.truth.Truth.assertThat;
+import static com.google.common.truth.Truth.assertWithMessage;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import java.io.IOException;
+import java.lang.reflect.Field;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Set;
+import java.util.TreeSet;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.ConfigurationBuilder;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.configuration.converters.FileTypeConverter;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CfaCache.IncrementalLoopStructure;
+import org.sosy_lab.cpachecker.cfa.FunctionFingerprints.FunctionChanges;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.LoopStructure;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class CfaCacheTest {
+
+  private static final String PROGRAM =
+      "int main() { int x = 0; while (x < 10) { x++; } return x; }";
+
+  /**
+   * All classes whose options influence the parsing or the CFA creation, except for the Eclipse
+   * parsers, which are loaded in a separate class loader.
+   */
+  private static final ImmutableList<String> CFA_OPTION_CLASSES =
+      ImmutableList.of(
+          "org.sosy_lab.cpachecker.cfa.CFACreator",
+          "org.sosy_lab.cpachecker.cfa.CFASecondPassBuilder",
+          "org.sosy_lab.cpachecker.cfa.CParserWithLocationMapper",
+          "org.sosy_lab.cpachecker.cfa.CPreprocessor",
+          "org.sosy_lab.cpachecker.cfa.ClangPreprocessor",
+          "org.sosy_lab.cpachecker.cfa.parser.Parsers$EclipseCParserOptions",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.function.CFunctionPointerResolver",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.function.EdgeReplacerFunctionPointer",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.function.EdgeReplacerParameterFunctionPointer",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.function.NullPointerChecks",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.function.ThreadCreateTransformer",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.global.CFACloner",
+          "org.sosy_lab.cpachecker.cfa.postprocessing.global.FunctionCallUnwinder",
+          "org.sosy_lab.cpachecker.util.LiveVariables$LiveVariablesConfiguration",
+          "org.sosy_lab.cpachecker.util.variableclassification.VariableClassificationBuilder");
+
+  /** Options of these classes that do not influence the CFA. */
+  private static final ImmutableSet<String> IRRELEVANT_OPTIONS =
+      ImmutableSet.of("locmapper.dumpTokenizedProgramToFile");
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private List<String> sourceFiles;
+
+  @Before
+  public void setUp() throws IOException {
+    Path program = tempFolder.newFile("program.c").toPath();
+    Files.writeString(program, PROGRAM, StandardCharsets.US_ASCII);
+    sourceFiles = ImmutableList.of(program.toString());
+  }
+
+  private ConfigurationBuilder configurationWithCache() throws InvalidConfigurationException {
+    Path root = tempFolder.getRoot().toPath();
+    FileTypeConverter fileTypeConverter =
+        FileTypeConverter.create(
+            Configuration.builder()
+                .setOption("output.path", root.resolve("output").toString())
+                .build());
+    return Configuration.builder()
+        .addConverter(FileOption.class, fileTypeConverter)
+        .setOption("cfa.cache.directory", root.resolve("cache").toString());
+  }
+
+  private CfaCache createCache(Configuration pConfig) throws InvalidConfigurationException {
+    return new CfaCache(pConfig, LogManager.createTestLogManager(), false);
+  }
+
+  @Test
+  public void testStoreAndLoad()
+      throws InvalidConfigurationException, ParserException, InterruptedException {
+    CfaCache cache = createCache(configurationWithCache().build());
+    assertThat(cache.isEnabled()).isTrue();
+    assertThat(cache.load(sourceFiles)).isNull();
+
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    cache.store(sourceFiles, cfa);
+
+    CFA loaded = createCache(configurationWithCache().build()).load(sourceFiles);
+    assertThat(loaded).isNotNull();
+    assertThat(loaded.getAllFunctionNames()).isEqualTo(cfa.getAllFunctionNames());
+    assertThat(loaded.nodes().stream().map(CFANode::getNodeNumber).toList())
+        .containsExactlyElementsIn(cfa.nodes().stream().map(CFANode::getNodeNumber).toList());
+    assertThat(loaded.getLoopStructure()).isPresent();
+    assertThat(loaded.getLoopStructure().orElseThrow().getCount()).isEqualTo(1);
+
+    // nodes created later must not reuse the numbers of the loaded nodes
+    int newNodeNumber = CFANode.newDummyCFANode().getNodeNumber();
+    assertThat(loaded.nodes().stream().allMatch(node -> node.getNodeNumber() < newNodeNumber))
+        .isTrue();
+  }
+
+  @Test
+  public void testChangedInputIsNotLoaded()
+      throws InvalidConfigurationException, ParserException, InterruptedException, IOException {
+    CfaCache cache = createCache(configurationWithCache().build());
+    cache.store(sourceFiles, TestDataTools.makeCFA(PROGRAM));
+
+    Configuration otherMachineModel =
+        configurationWithCache().setOption("analysis.machineModel", "LINUX64").build();
+    assertThat(createCache(otherMachineModel).load(sourceFiles)).isNull();
+
+    // options that do not influence the CFA are irrelevant
+    Configuration otherAnalysis =
+        configurationWithCache().setOption("analysis.algorithm.CEGAR", "true").build();
+    assertThat(createCache(otherAnalysis).load(sourceFiles)).isNotNull();
+
+    Files.writeString(Path.of(sourceFiles.get(0)), PROGRAM + "\n", StandardCharsets.US_ASCII);
+    assertThat(cache.load(sourceFiles)).isNull();
+  }
+
+  @Test
+  public void testChangedIncludeIsNotLoaded()
+      throws InvalidConfigurationException, ParserException, InterruptedException, IOException {
+    Path program = Path.of(sourceFiles.get(0));
+    Path header = program.resolveSibling("header.h");
+    Path nestedHeader = program.resolveSibling("nested.h");
+    Files.writeString(header, "#include \"nested.h\"\nint f(void);\n");
+    Files.writeString(program, "#include \"header.h\"\n" + PROGRAM);
+    CfaCache cache = createCache(configurationWithCache().build());
+    cache.store(sourceFiles, TestDataTools.makeCFA(PROGRAM));
+    assertThat(cache.load(sourceFiles)).isNotNull();
+
+    // a missing included file that appears later changes the key
+    Files.writeString(nestedHeader, "int g(void);\n");
+    assertThat(cache.load(sourceFiles)).isNull();
+    cache.store(sourceFiles, TestDataTools.makeCFA(PROGRAM));
+    assertThat(cache.load(sourceFiles)).isNotNull();
+
+    Files.writeString(nestedHeader, "int g(int);\n");
+    assertThat(cache.load(sourceFiles)).isNull();
+  }
+
+  @Test
+  public void testIncludeByMacroIsNotCached()
+      throws InvalidConfigurationException, ParserException, InterruptedException, IOException {
+    Path program = Path.of(sourceFiles.get(0));
+    Files.writeString(program, "#define HEADER \"header.h\"\n#include HEADER\n" + PROGRAM);
+    CfaCache cache = createCache(configurationWithCache().build());
+    cache.store(sourceFiles, TestDataTools.makeCFA(PROGRAM));
+    assertThat(cache.load(sourceFiles)).isNull();
+  }
+
+  @Test
+  public void testDisabledWithExternalPreprocessor() throws InvalidConfigurationException {
+    CfaCache cache =
+        new CfaCache(configurationWithCache().build(), LogManager.createTestLogManager(), true);
+    assertThat(cache.isEnabled()).isFalse();
+    assertThat(cache.load(sourceFiles)).isNull();
+  }
+
+  /** Get the names of all options of a class and its superclasses. */
+  private static Set<String> getOptionNames(Class<?> pClass) {
+    Set<String> names = new TreeSet<>();
+    for (Class<?> cls = pClass; cls != null; cls = cls.getSuperclass()) {
+      Options options = cls.getAnnotation(Options.class);
+      String prefix = options == null || options.prefix().isEmpty() ? "" : options.prefix() + ".";
+      for (Field field : cls.getDeclaredFields()) {
+        Option option = field.getAnnotation(Option.class);
+        if (option != null) {
+          names.add(prefix + (option.name().isEmpty() ? field.getName() : option.name()));
+        }
+      }
+    }
+    return names;
+  }
+
+  @Test
+  public void testAllCfaOptionsAreRelevant() throws ClassNotFoundException {
+    for (String className : CFA_OPTION_CLASSES) {
+      Set<String> options = getOptionNames(Class.forName(className));
+      assertThat(options).isNotEmpty();
+      for (String option : options) {
+        if (!IRRELEVANT_OPTIONS.contains(option)) {
+          assertWithMessage("option %s of %s is not part of the cache key", option, className)
+              .that(CfaCache.isRelevantOption(option))
+              .isTrue();
+        }
+      }
+    }
+  }
+
+  @Test
+  public void testDetectChangedFunctions()
+      throws InvalidConfigurationException, ParserException, InterruptedException, IOException {
+    Path program = Path.of(sourceFiles.get(0));
+    Configuration config =
+        configurationWithCache().setOption("cfa.cache.detectChangedFunctions", "true").build();
+    CfaCache cache = createCache(config);
+    assertThat(cache.shouldDetectChangedFunctions()).isTrue();
+
+    Files.writeString(program, "int f() { return 1; }\nint g() { return 2; }\n" + PROGRAM);
+    assertThat(cache.detectChangedFunctions(sourceFiles, parse(config))).isNull();
+
+    // g and main are only moved
+    Files.writeString(program, "int f() {\n  return 3;\n}\nint g() { return 2; }\n" + PROGRAM);
+    FunctionChanges changes = cache.detectChangedFunctions(sourceFiles, parse(config));
+    assertThat(changes).isNotNull();
+    assertThat(changes.changed()).containsExactly("f");
+    assertThat(changes.added()).isEmpty();
+    assertThat(changes.removed()).isEmpty();
+
+    Files.writeString(program, "int g() { return 2; }\nint h() { return 4; }\n" + PROGRAM);
+    changes = cache.detectChangedFunctions(sourceFiles, parse(config));
+    // the declarations of the functions are global declarations
+    assertThat(changes.changed()).containsExactly(FunctionFingerprints.GLOBAL_DECLARATIONS);
+    assertThat(changes.added()).containsExactly("h");
+    assertThat(changes.removed()).containsExactly("f");
+  }
+
+  private ParseResult parse(Configuration pConfig)
+      throws InvalidConfigurationException, ParserException, InterruptedException {
+    CParser parser =
+        CParser.Factory.getParser(
+            LogManager.createTestLogManager(),
+            CParser.Factory.getOptions(pConfig),
+            MachineModel.LINUX32,
+            ShutdownNotifier.createDummy());
+    return parser.parseFiles(sourceFiles);
+  }
+
+  @Test
+  public void testIncrementalLoopStructure()
+      throws InvalidConfigurationException, ParserException, InterruptedException, IOException {
+    Path program = Path.of(sourceFiles.get(0));
+    Configuration config =
+        configurationWithCache().setOption("cfa.cache.incrementalLoopStructure", "true").build();
+    CfaCache cache = createCache(config);
+    assertThat(cache.shouldBuildLoopStructureIncrementally()).isTrue();
+
+    Files.writeString(program, "int f(int n) { while (n > 0) { n--; } return n; }\n" + PROGRAM);
+    assertThat(cache.getLoopStructure(sourceFiles, toMutableCfa(parse(config))).reusedFunctions())
+        .isEqualTo(0);
+
+    Files.writeString(
+        program, "int f(int n) { for (;;) { if (n < 0) { return n; } n++; } }\n" + PROGRAM);
+    MutableCFA cfa = toMutableCfa(parse(config));
+    IncrementalLoopStructure incremental = cache.getLoopStructure(sourceFiles, cfa);
+    // only the loops of f are searched again
+    assertThat(incremental.reusedFunctions()).isEqualTo(1);
+    LoopStructure expected = LoopStructure.getLoopStructure(cfa);
+    for (String function : cfa.getAllFunctionNames()) {
+      assertThat(incremental.loopStructure().getLoopsForFunction(function))
+          .containsExactlyElementsIn(expected.getLoopsForFunction(function))
+          .inOrder();
+    }
+  }
+
+  private static MutableCFA toMutableCfa(ParseResult pParseResult) {
+    CfaMetadata metadata =
+        CfaMetadata.forMandatoryAttributes(
+            MachineModel.LINUX32,
+            Language.C,
+            pParseResult.getFileNames(),
+            pParseResult.getFunctions().get("main"),
+            CfaConnectedness.UNCONNECTED_FUNCTIONS);
+    return new MutableCFA(pParseResult.getFunctions(), pParseResult.getCFANodes(), metadata);
+  }
+
+  @Test
+  public void testDisabled() throws InvalidConfigurationException {
+    CfaCache cache = createCache(TestDataTools.configurationForTest().build());
+    assertThat(cache.isEnabled()).isFalse();
+    assertThat(cache.load(sourceFiles)).isNull();
+  }
+}
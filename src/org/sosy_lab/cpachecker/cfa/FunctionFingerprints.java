@@ -0,0 +1,160 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSortedMap;
+import com.google.common.collect.ImmutableSortedSet;
+import com.google.common.collect.Sets;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.ast.ADeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.Pair;
+
+/**
+ * Fingerprints of the CFAs of single functions, for detecting which functions changed between two
+ * versions of a program.
+ *
+ * <p>A fingerprint covers the structure of the CFA of a function, the code of its edges, and the
+ * relative order of the node numbers, but not the node numbers themselves and the file locations.
+ * Thus, functions that only moved in the file have the same fingerprint. The global declarations
+ * have a separate fingerprint.
+ *
+ * <p>The nodes of two functions with the same fingerprint correspond to each other by their
+ * position in {@link FunctionNodes#nodes()}. This allows to reuse data that was computed for a
+ * function in a previous run, like its loops, if the function did not change.
+ */
+final class FunctionFingerprints {
+
+  /** The key for the fingerprint of the global declarations, which is no valid function name. */
+  static final String GLOBAL_DECLARATIONS = "<global declarations>";
+
+  /**
+   * The functions that differ between two versions of a program. If the global declarations
+   * differ, the changed functions contain {@link #GLOBAL_DECLARATIONS}.
+   */
+  record FunctionChanges(
+      ImmutableSortedSet<String> changed,
+      ImmutableSortedSet<String> added,
+      ImmutableSortedSet<String> removed,
+      int numberOfFunctions) {}
+
+  /**
+   * The fingerprint of a function together with its nodes in the order in which the fingerprint
+   * covers them.
+   */
+  record FunctionNodes(HashCode fingerprint, ImmutableList<CFANode> nodes) {}
+
+  private FunctionFingerprints() {}
+
+  /** Compute the fingerprints of all functions and the global declarations. */
+  static ImmutableSortedMap<String, HashCode> of(ParseResult pParseResult) {
+    ImmutableSortedMap.Builder<String, HashCode> result = ImmutableSortedMap.naturalOrder();
+    for (Map.Entry<String, FunctionEntryNode> function : pParseResult.getFunctions().entrySet()) {
+      result.put(function.getKey(), ofFunction(function.getValue()).fingerprint());
+    }
+    result.put(GLOBAL_DECLARATIONS, ofGlobalDeclarations(pParseResult.getGlobalDeclarations()));
+    return result.buildOrThrow();
+  }
+
+  /**
+   * Compute the fingerprint of a function that contains exactly the given nodes, or return null if
+   * not all of them are reachable from the function entry and the fingerprint would not cover them.
+   */
+  static @Nullable FunctionNodes ofFunction(
+      FunctionEntryNode pEntryNode, Collection<CFANode> pFunctionNodes) {
+    FunctionNodes result = ofFunction(pEntryNode);
+    if (result.nodes().size() != pFunctionNodes.size()
+        || !pFunctionNodes.containsAll(result.nodes())) {
+      return null;
+    }
+    return result;
+  }
+
+  /**
+   * Compute the fingerprint of a single function. The nodes are numbered in the order of a
+   * depth-first traversal along the leaving edges, which is independent of the node numbers, and
+   * only the order of the node numbers is added to the fingerprint at the end.
+   */
+  private static FunctionNodes ofFunction(FunctionEntryNode pEntryNode) {
+    Hasher hasher =
+        Hashing.sha256().newHasher().putString(pEntryNode.getFunction().toASTString(), UTF_8);
+
+    Map<CFANode, Integer> localIds = new HashMap<>();
+    List<CFANode> nodes = new ArrayList<>();
+    Deque<CFANode> waitlist = new ArrayDeque<>();
+    localIds.put(pEntryNode, 0);
+    nodes.add(pEntryNode);
+    waitlist.push(pEntryNode);
+    while (!waitlist.isEmpty()) {
+      CFANode node = waitlist.pop();
+      hasher.putInt(localIds.get(node)).putInt(node.getNumLeavingEdges());
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        CFANode successor = edge.getSuccessor();
+        Integer successorId = localIds.get(successor);
+        if (successorId == null) {
+          successorId = localIds.size();
+          localIds.put(successor, successorId);
+          nodes.add(successor);
+          waitlist.push(successor);
+        }
+        hasher
+            .putString(edge.getEdgeType().name(), UTF_8)
+            .putString(edge.getCode(), UTF_8)
+            .putInt(successorId);
+      }
+    }
+
+    // some algorithms, like the loop detection, depend on the order of the node numbers
+    for (CFANode node : ImmutableList.sortedCopyOf(nodes)) {
+      hasher.putInt(localIds.get(node));
+    }
+    return new FunctionNodes(hasher.hash(), ImmutableList.copyOf(nodes));
+  }
+
+  private static HashCode ofGlobalDeclarations(List<Pair<ADeclaration, String>> pDeclarations) {
+    Hasher hasher = Hashing.sha256().newHasher();
+    for (Pair<ADeclaration, String> declaration : pDeclarations) {
+      hasher.putString(declaration.getFirst().toASTString(), UTF_8);
+    }
+    return hasher.hash();
+  }
+
+  /** Compare the fingerprints of a previous version of a program with the current ones. */
+  static FunctionChanges diff(
+      Map<String, HashCode> pPrevious, ImmutableSortedMap<String, HashCode> pCurrent) {
+    ImmutableSortedSet.Builder<String> changed = ImmutableSortedSet.naturalOrder();
+    for (String function : Sets.intersection(pPrevious.keySet(), pCurrent.keySet())) {
+      if (!Objects.equals(pPrevious.get(function), pCurrent.get(function))) {
+        changed.add(function);
+      }
+    }
+    return new FunctionChanges(
+        changed.build(),
+        ImmutableSortedSet.copyOf(Sets.difference(pCurrent.keySet(), pPrevious.keySet())),
+        ImmutableSortedSet.copyOf(Sets.difference(pPrevious.keySet(), pCurrent.keySet())),
+        pCurrent.size() - 1);
+  }
+}
@@ -20,8 +20,10 @@ import java.util.ArrayList;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.cfa.graph.CfaNetwork;
 import org.sosy_lab.cpachecker.cfa.graph.CheckingCfaNetwork;
+import org.sosy_lab.cpachecker.cfa.graph.CompactCfa;
 import org.sosy_lab.cpachecker.cfa.graph.ConsistentCfaNetwork;
 import org.sosy_lab.cpachecker.cfa.graph.ForwardingCfaNetwork;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
@@ -46,6 +48,9 @@ class ImmutableCFA extends ForwardingCfaNetwork implements CFA, Serializable {
   // `network` isn't `final` due to serialization, but shouldn't be reassigned anywhere else
   private transient CfaNetwork network;
 
+  // created lazily on first use, as most analyses do not need it
+  private transient volatile @Nullable CompactCfa compactCfa;
+
   ImmutableCFA(
       Map<String, FunctionEntryNode> pFunctions,
       SetMultimap<String, CFANode> pAllNodes,
@@ -116,6 +121,21 @@ class ImmutableCFA extends ForwardingCfaNetwork implements CFA, Serializable {
     return metadata;
   }
 
+  @Override
+  public CompactCfa getCompactCfa() {
+    CompactCfa result = compactCfa;
+    if (result == null) {
+      synchronized (this) {
+        result = compactCfa;
+        if (result == null) {
+          result = CFA.super.getCompactCfa();
+          compactCfa = result;
+        }
+      }
+    }
+    return result;
+  }
+
   private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
 
     // write default stuff
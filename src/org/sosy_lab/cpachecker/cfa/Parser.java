@@ -11,9 +11,11 @@ package org.sosy_lab.cpachecker.cfa;
 import java.io.IOException;
 import java.nio.file.Path;
 import java.util.List;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.statistics.ProcessCpuTimer;
 
 /**
  * Abstraction of a parser that creates CFAs from code.
@@ -53,4 +55,20 @@ public interface Parser {
    * null.
    */
   Timer getCFAConstructionTime();
+
+  /**
+   * Return a timer that measured the CPU time of all threads during parsing. Optional method: may
+   * return null.
+   */
+  default @Nullable ProcessCpuTimer getParseCpuTime() {
+    return null;
+  }
+
+  /**
+   * Return a timer that measured the CPU time of all threads during CFA construction. Optional
+   * method: may return null.
+   */
+  default @Nullable ProcessCpuTimer getCFAConstructionCpuTime() {
+    return null;
+  }
 }
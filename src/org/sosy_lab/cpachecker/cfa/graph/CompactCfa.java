@@ -0,0 +1,222 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.graph;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import java.util.Arrays;
+import java.util.BitSet;
+import java.util.Set;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+
+/**
+ * A frozen, array-based view of a {@link CfaNetwork}, for hot traversals that should run over
+ * primitive arrays instead of CFA nodes and their lists of edges.
+ *
+ * <p>Every node has an ID between {@code 0} (inclusive) and {@link #getNodeCount()} (exclusive).
+ * The IDs are contiguous and assigned in the order of the node numbers. The successors and
+ * predecessors of all nodes are stored in compressed sparse row (CSR) format: the successors of the
+ * node with ID {@code n} are stored in a single array at the positions {@code offsets[n]} to {@code
+ * offsets[n + 1] - 1}, and the corresponding edges are stored at the same positions in a parallel
+ * array. As in {@link CfaNetwork}, summary edges are not contained.
+ *
+ * <p>Additionally, the reverse post-order IDs of the nodes (see {@link
+ * CFANode#getReversePostorderId()}) and the loop heads are stored for all nodes.
+ *
+ * <p>Instances are immutable and do not reflect later changes of the network they were created
+ * from, so they should only be created for CFAs that are not modified anymore.
+ */
+public final class CompactCfa {
+
+  private final CFANode[] nodes;
+
+  // idsByNodeNumber[nodeNumber - minNodeNumber] == ID of the node, or -1 if there is no such node
+  private final int minNodeNumber;
+  private final int[] idsByNodeNumber;
+
+  private final int[] successorOffsets;
+  private final int[] successors;
+  private final CFAEdge[] leavingEdges;
+
+  private final int[] predecessorOffsets;
+  private final int[] predecessors;
+  private final CFAEdge[] enteringEdges;
+
+  private final int[] reversePostorderIds;
+  private final BitSet loopHeads;
+
+  private CompactCfa(CfaNetwork pNetwork, Set<CFANode> pLoopHeads) {
+    nodes = pNetwork.nodes().toArray(new CFANode[0]);
+    Arrays.sort(nodes);
+
+    if (nodes.length == 0) {
+      minNodeNumber = 0;
+      idsByNodeNumber = new int[0];
+    } else {
+      minNodeNumber = nodes[0].getNodeNumber();
+      idsByNodeNumber = new int[nodes[nodes.length - 1].getNodeNumber() - minNodeNumber + 1];
+      Arrays.fill(idsByNodeNumber, -1);
+    }
+    for (int id = 0; id < nodes.length; id++) {
+      idsByNodeNumber[nodes[id].getNodeNumber() - minNodeNumber] = id;
+    }
+
+    int edgeCount = pNetwork.edges().size();
+
+    successorOffsets = new int[nodes.length + 1];
+    successors = new int[edgeCount];
+    leavingEdges = new CFAEdge[edgeCount];
+    int position = 0;
+    for (int id = 0; id < nodes.length; id++) {
+      successorOffsets[id] = position;
+      for (CFAEdge edge : pNetwork.outEdges(nodes[id])) {
+        successors[position] = getId(pNetwork.successor(edge));
+        leavingEdges[position] = edge;
+        position++;
+      }
+    }
+    successorOffsets[nodes.length] = position;
+
+    predecessorOffsets = new int[nodes.length + 1];
+    predecessors = new int[edgeCount];
+    enteringEdges = new CFAEdge[edgeCount];
+    position = 0;
+    for (int id = 0; id < nodes.length; id++) {
+      predecessorOffsets[id] = position;
+      for (CFAEdge edge : pNetwork.inEdges(nodes[id])) {
+        predecessors[position] = getId(pNetwork.predecessor(edge));
+        enteringEdges[position] = edge;
+        position++;
+      }
+    }
+    predecessorOffsets[nodes.length] = position;
+
+    reversePostorderIds = new int[nodes.length];
+    loopHeads = new BitSet(nodes.length);
+    for (int id = 0; id < nodes.length; id++) {
+      reversePostorderIds[id] = nodes[id].getReversePostorderId();
+      if (pLoopHeads.contains(nodes[id])) {
+        loopHeads.set(id);
+      }
+    }
+  }
+
+  /**
+   * Creates a compact view of the current state of the given {@link CfaNetwork}.
+   *
+   * @param pNetwork the network to create the view for
+   * @param pLoopHeads the loop heads of the network
+   * @return a compact view of the given network
+   */
+  public static CompactCfa of(CfaNetwork pNetwork, Set<CFANode> pLoopHeads) {
+    return new CompactCfa(pNetwork, pLoopHeads);
+  }
+
+  public int getNodeCount() {
+    return nodes.length;
+  }
+
+  public int getEdgeCount() {
+    return successors.length;
+  }
+
+  public CFANode getNode(int pId) {
+    return nodes[pId];
+  }
+
+  /** Returns whether the given node is contained in this view. */
+  public boolean contains(CFANode pNode) {
+    int index = pNode.getNodeNumber() - minNodeNumber;
+    return index >= 0 && index < idsByNodeNumber.length && idsByNodeNumber[index] >= 0;
+  }
+
+  /**
+   * Returns the ID of the given node.
+   *
+   * @throws IllegalArgumentException if the node is not contained in this view
+   */
+  public int getId(CFANode pNode) {
+    checkArgument(contains(pNode), "Node %s is not contained in this CFA", pNode);
+    return idsByNodeNumber[pNode.getNodeNumber() - minNodeNumber];
+  }
+
+  public int getSuccessorCount(int pId) {
+    return successorOffsets[pId + 1] - successorOffsets[pId];
+  }
+
+  /** Returns the ID of the successor of the leaving edge with the given index. */
+  public int getSuccessor(int pId, int pIndex) {
+    return successors[successorOffsets[pId] + pIndex];
+  }
+
+  public CFAEdge getLeavingEdge(int pId, int pIndex) {
+    return leavingEdges[successorOffsets[pId] + pIndex];
+  }
+
+  public int getPredecessorCount(int pId) {
+    return predecessorOffsets[pId + 1] - predecessorOffsets[pId];
+  }
+
+  /** Returns the ID of the predecessor of the entering edge with the given index. */
+  public int getPredecessor(int pId, int pIndex) {
+    return predecessors[predecessorOffsets[pId] + pIndex];
+  }
+
+  public CFAEdge getEnteringEdge(int pId, int pIndex) {
+    return enteringEdges[predecessorOffsets[pId] + pIndex];
+  }
+
+  /** Returns the reverse post-order ID of the node, see {@link CFANode#getReversePostorderId()}. */
+  public int getReversePostorderId(int pId) {
+    return reversePostorderIds[pId];
+  }
+
+  public boolean isLoopHead(int pId) {
+    return loopHeads.get(pId);
+  }
+
+  /** Returns the IDs of all loop heads. The returned set is a copy and can be modified. */
+  public BitSet getLoopHeads() {
+    return (BitSet) loopHeads.clone();
+  }
+
+  /** Returns the IDs of all nodes that are reachable from the given node (including itself). */
+  public BitSet getReachableNodes(int pStartId) {
+    return traverse(pStartId, successorOffsets, successors);
+  }
+
+  /**
+   * Returns the IDs of all nodes from which the given node is reachable (including the given node
+   * itself).
+   */
+  public BitSet getBackwardReachableNodes(int pStartId) {
+    return traverse(pStartId, predecessorOffsets, predecessors);
+  }
+
+  private BitSet traverse(int pStartId, int[] pOffsets, int[] pTargets) {
+    BitSet visited = new BitSet(nodes.length);
+    int[] stack = new int[nodes.length];
+    int stackSize = 0;
+
+    visited.set(pStartId);
+    stack[stackSize++] = pStartId;
+    while (stackSize > 0) {
+      int id = stack[--stackSize];
+      for (int position = pOffsets[id]; position < pOffsets[id + 1]; position++) {
+        int target = pTargets[position];
+        if (!visited.get(target)) {
+          visited.set(target);
+          stack[stackSize++] = target;
+        }
+      }
+    }
+    return visited;
+  }
+}
@@ -0,0 +1,89 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.graph;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.CFATraversal;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class CompactCfaTest {
+
+  private static final String PROGRAM =
+      "int f(int x) { return x + 1; }"
+          + "int main() { int i = 0; while (i < 10) { i = f(i); } return i; }";
+
+  @Test
+  public void testSameGraphAsCfa() throws ParserException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    CompactCfa compactCfa = cfa.getCompactCfa();
+
+    assertThat(compactCfa.getNodeCount()).isEqualTo(cfa.nodes().size());
+    assertThat(compactCfa.getEdgeCount()).isEqualTo(cfa.edges().size());
+
+    for (CFANode node : cfa.nodes()) {
+      int id = compactCfa.getId(node);
+      assertThat(compactCfa.getNode(id)).isEqualTo(node);
+      assertThat(compactCfa.getReversePostorderId(id)).isEqualTo(node.getReversePostorderId());
+
+      List<CFAEdge> leavingEdges = new ArrayList<>();
+      for (int i = 0; i < compactCfa.getSuccessorCount(id); i++) {
+        CFAEdge edge = compactCfa.getLeavingEdge(id, i);
+        assertThat(compactCfa.getNode(compactCfa.getSuccessor(id, i)))
+            .isEqualTo(edge.getSuccessor());
+        leavingEdges.add(edge);
+      }
+      assertThat(leavingEdges).containsExactlyElementsIn(cfa.outEdges(node)).inOrder();
+
+      List<CFAEdge> enteringEdges = new ArrayList<>();
+      for (int i = 0; i < compactCfa.getPredecessorCount(id); i++) {
+        CFAEdge edge = compactCfa.getEnteringEdge(id, i);
+        assertThat(compactCfa.getNode(compactCfa.getPredecessor(id, i)))
+            .isEqualTo(edge.getPredecessor());
+        enteringEdges.add(edge);
+      }
+      assertThat(enteringEdges).containsExactlyElementsIn(cfa.inEdges(node)).inOrder();
+    }
+  }
+
+  @Test
+  public void testIdsAreContiguousAndOrdered() throws ParserException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    CompactCfa compactCfa = cfa.getCompactCfa();
+
+    List<CFANode> nodesById = new ArrayList<>();
+    for (int id = 0; id < compactCfa.getNodeCount(); id++) {
+      nodesById.add(compactCfa.getNode(id));
+    }
+    assertThat(nodesById).containsExactlyElementsIn(cfa.nodes()).inOrder();
+    assertThat(compactCfa.contains(CFANode.newDummyCFANode())).isFalse();
+  }
+
+  @Test
+  public void testLoopHeadsAndReachability() throws ParserException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    CompactCfa compactCfa = cfa.getCompactCfa();
+
+    List<CFANode> loopHeads = new ArrayList<>();
+    compactCfa.getLoopHeads().stream().forEach(id -> loopHeads.add(compactCfa.getNode(id)));
+    assertThat(loopHeads).containsExactlyElementsIn(cfa.getAllLoopHeads().orElseThrow());
+
+    int mainEntry = compactCfa.getId(cfa.getMainFunction());
+    assertThat(compactCfa.getReachableNodes(mainEntry).cardinality())
+        .isEqualTo(CFATraversal.dfs().collectNodesReachableFrom(cfa.getMainFunction()).size());
+    assertThat(compactCfa.getBackwardReachableNodes(mainEntry).cardinality()).isEqualTo(1);
+  }
+}
@@ -20,7 +20,7 @@ import java.util.Collections;
 import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Set;
-import org.sosy_lab.common.UniqueIdGenerator;
+import java.util.concurrent.atomic.AtomicInteger;
 import org.sosy_lab.cpachecker.cfa.ast.AFunctionDeclaration;
 import org.sosy_lab.cpachecker.cfa.ast.FileLocation;
 import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionDeclaration;
@@ -33,9 +33,20 @@ public sealed class CFANode implements Comparable<CFANode>, Serializable
 
   private static final long serialVersionUID = 5168350921309486536L;
 
-  private static final UniqueIdGenerator idGenerator = new UniqueIdGenerator();
+  /**
+   * The number for the next node. Not a UniqueIdGenerator, because the numbers of deserialized
+   * nodes (e.g., from a cached CFA) need to be skipped.
+   */
+  private static final AtomicInteger nextNodeNumber = new AtomicInteger();
+
+  /**
+   * The number for the next node created by the current thread, if the thread numbers its nodes
+   * locally (see {@link #beginLocalNumbering()}).
+   */
+  private static final ThreadLocal<int[]> nextLocalNodeNumber = new ThreadLocal<>();
 
-  private final int nodeNumber;
+  // only changed by assignGlobalNumbers(), before the node is part of a CFA
+  private int nodeNumber;
 
   // do not serialize edges, recursive traversal of the CFA causes a stack-overflow.
   // edge-list is final, except for serialization
@@ -77,13 +88,48 @@ public sealed class CFANode implements Comparable<CFANode>, Serializable
 
   public CFANode(AFunctionDeclaration pFunction) {
     function = pFunction;
-    nodeNumber = idGenerator.getFreshId();
+    int[] nextLocalNumber = nextLocalNodeNumber.get();
+    nodeNumber =
+        nextLocalNumber == null ? nextNodeNumber.getAndIncrement() : nextLocalNumber[0]++;
   }
 
   public int getNodeNumber() {
     return nodeNumber;
   }
 
+  /**
+   * Number the nodes created by the current thread from 0 on, until {@link #endLocalNumbering()}.
+   * This is used if the nodes of different functions are created concurrently, such that the
+   * numbering does not depend on the scheduling. The local numbers are not unique, so the nodes
+   * must get their final numbers from {@link #assignGlobalNumbers} before they are put into a CFA.
+   */
+  public static void beginLocalNumbering() {
+    checkState(nextLocalNodeNumber.get() == null, "nodes are already numbered locally");
+    nextLocalNodeNumber.set(new int[1]);
+  }
+
+  /** Stop the local numbering of the current thread and return the number of created nodes. */
+  public static int endLocalNumbering() {
+    int[] nextLocalNumber = nextLocalNodeNumber.get();
+    checkState(nextLocalNumber != null, "nodes are not numbered locally");
+    nextLocalNodeNumber.remove();
+    return nextLocalNumber[0];
+  }
+
+  /**
+   * Give locally numbered nodes their final numbers. This reserves {@code pCount} numbers, the
+   * number of all nodes created during the local numbering including those that are no longer part
+   * of the CFA, and shifts the local numbers into this range. Doing this in the order in which a
+   * single thread would have created the nodes yields exactly the same numbers.
+   */
+  public static void assignGlobalNumbers(Collection<CFANode> pNodes, int pCount) {
+    int first = nextNodeNumber.getAndAdd(pCount);
+    for (CFANode node : pNodes) {
+      assert node.nodeNumber < pCount;
+      node.nodeNumber += first;
+    }
+  }
+
   public int getReversePostorderId() {
     return reversePostorderId;
   }
@@ -291,6 +337,9 @@ public sealed class CFANode implements Comparable<CFANode>, Serializable
       throws java.io.IOException, ClassNotFoundException {
     s.defaultReadObject();
 
+    // nodes created later must not get the same number
+    nextNodeNumber.accumulateAndGet(nodeNumber + 1, Math::max);
+
     // leaving and entering edges have to be updated explicitly after reading a node
     leavingEdges = new ArrayList<>(1);
     enteringEdges = new ArrayList<>(1);
@@ -21,6 +21,7 @@ import org.sosy_lab.common.Classes;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.annotations.SuppressForbidden;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -69,6 +70,27 @@ public class Parsers {
         description = "Which functions should be interpreted as never returning to their call site")
     private Set<String> noReturnFunctions = ImmutableSet.of("abort", "exit");
 
+    @Option(
+        secure = true,
+        description =
+            "Number of threads for parsing translation units and building the CFAs of functions"
+                + " in parallel (-1 for the number of available processors). The resulting CFA is"
+                + " the same as with one thread, except for the names of anonymous types that are"
+                + " declared inside functions.")
+    @IntegerOption(min = -1)
+    private int parserThreads = 1;
+
+    @Option(
+        secure = true,
+        description =
+            "Parse the translation units one after another and convert each of them, including"
+                + " the CFAs of its functions, before parsing the next one. This reduces the memory"
+                + " needed for parsing programs that consist of several large files, because only"
+                + " one syntax tree is kept in memory at a time. A program in a single file (e.g.,"
+                + " an amalgamated one) needs its complete syntax tree anyway, so this saves"
+                + " nothing there. Translation units are then never parsed in parallel.")
+    private boolean streamTranslationUnits = false;
+
     public boolean initializeAllVariables() {
       return initializeAllVariables;
     }
@@ -85,6 +107,18 @@ public class Parsers {
       return simplifyConstExpressions;
     }
 
+    /** Returns the number of threads that should be used for parsing and building the CFA. */
+    public int getParserThreads() {
+      if (parserThreads == -1) {
+        return Runtime.getRuntime().availableProcessors();
+      }
+      return Math.max(parserThreads, 1);
+    }
+
+    public boolean streamTranslationUnits() {
+      return streamTranslationUnits;
+    }
+
     /**
      * Returns whether the given function (by name) should be interpreted to never return to its
      * call site.
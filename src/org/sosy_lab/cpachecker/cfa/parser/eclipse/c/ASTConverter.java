@@ -29,6 +29,7 @@ import java.util.Iterator;
 import java.util.List;
 import java.util.LongSummaryStatistics;
 import java.util.Optional;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.eclipse.cdt.core.dom.ast.IASTArrayDeclarator;
@@ -314,8 +315,8 @@ class ASTConverter {
 
   // this counter is static to make the replacing names for anonymous types, in
   // more than one file (which get parsed with different AstConverters, although
-  // they are in the same run) unique
-  private static int anonTypeCounter = 0;
+  // they are in the same run) unique, and atomic because functions may be converted in parallel
+  private static final AtomicInteger anonTypeCounter = new AtomicInteger();
 
   private final Sideassignments sideAssignmentStack;
   private final String staticVariablePrefix;
@@ -2610,7 +2611,7 @@ class ASTConverter {
         name +=
             ((IASTSimpleDeclaration) d.getParent()).getDeclarators()[0].getName().getRawSignature();
       } else {
-        name += anonTypeCounter++;
+        name += anonTypeCounter.getAndIncrement();
       }
     }
 
@@ -2660,7 +2661,7 @@ class ASTConverter {
     // when the enum has no name we create one
     // (this may be the case when the enum declaration is surrounded by a typedef)
     if (name.isEmpty()) {
-      name = "__anon_type_" + anonTypeCounter++;
+      name = "__anon_type_" + anonTypeCounter.getAndIncrement();
     }
 
     CSimpleType integerType = getEnumerationType(list);
@@ -31,6 +31,7 @@ import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
 import org.sosy_lab.cpachecker.cfa.types.c.CSimpleType;
 import org.sosy_lab.cpachecker.cfa.types.c.CType;
 import org.sosy_lab.cpachecker.util.floatingpoint.CFloat;
+import org.sosy_lab.cpachecker.util.floatingpoint.CFloatFactory;
 import org.sosy_lab.cpachecker.util.floatingpoint.CFloatNative;
 import org.sosy_lab.cpachecker.util.floatingpoint.CFloatNativeAPI;
 
@@ -38,8 +39,8 @@ import org.sosy_lab.cpachecker.util.floatingpoint.CFloatNativeAPI;
  * This Class contains functions, that convert literals (chars, numbers) from C-source into
  * CPAchecker-format.
  */
-// Deprecated because of the temporary use of the CFloatNative class. This will be replaced by
-// CFloatImpl as soon as available.
+// Deprecated because of the temporary use of the CFloatNative class for long double. This will be
+// replaced by CFloatImpl as soon as available.
 @SuppressWarnings("deprecation")
 class ASTLiteralConverter {
 
@@ -157,15 +158,17 @@ class ASTLiteralConverter {
     // an unsuffixed floating constant has type double. If suffixed by the letter f or F, it has
     // type float. If suffixed by the letter l or L, it has type long double.
 
-    // TODO: replace CFloatNative-class by CFloatImpl when available
+    // TODO: replace CFloatNative-class by CFloatImpl for long double when it can parse exponents
     CFloat cFloat;
     if (pValueStr.endsWith("L") || pValueStr.endsWith("l")) {
       cFloat = new CFloatNative(pValueStr, CFloatNativeAPI.FP_TYPE_LONG_DOUBLE);
     } else if (pValueStr.endsWith("F") || pValueStr.endsWith("f")) {
-      cFloat = new CFloatNative(pValueStr, CFloatNativeAPI.FP_TYPE_SINGLE);
+      cFloat =
+          CFloatFactory.create(
+              pValueStr.substring(0, pValueStr.length() - 1), CFloatNativeAPI.FP_TYPE_SINGLE);
     } else {
       // literal has no suffix declared
-      cFloat = new CFloatNative(pValueStr, CFloatNativeAPI.FP_TYPE_DOUBLE);
+      cFloat = CFloatFactory.create(pValueStr, CFloatNativeAPI.FP_TYPE_DOUBLE);
     }
 
     if (cFloat.isInfinity()) {
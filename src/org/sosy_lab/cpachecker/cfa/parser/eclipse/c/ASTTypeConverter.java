@@ -13,11 +13,12 @@ import static com.google.common.base.Verify.verify;
 
 import java.math.BigInteger;
 import java.util.ArrayList;
-import java.util.HashMap;
+import java.util.Collections;
 import java.util.IdentityHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Map.Entry;
+import java.util.concurrent.ConcurrentHashMap;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.eclipse.cdt.core.dom.ast.DOMException;
 import org.eclipse.cdt.core.dom.ast.IASTDeclSpecifier;
@@ -78,44 +79,62 @@ class ASTTypeConverter {
     converter = pConverter;
     filePrefix = pFilePrefix;
     parseContext = pParseContext;
-    if (!typeConversions.containsKey(filePrefix)) {
-      typeConversions.put(filePrefix, new IdentityHashMap<>());
-    }
   }
 
   /**
    * cache for all ITypes, so that they don't have to be parsed again and again (Eclipse seems to
-   * give us identical objects for identical types already).
+   * give us identical objects for identical types already). The caches of the files are
+   * synchronized, because the functions of a file may be converted in parallel, and {@link
+   * #convert(IType)} holds the lock of the cache for the whole conversion of a type.
    */
-  private static final Map<String, Map<IType, CType>> typeConversions = new HashMap<>();
+  private static final Map<String, Map<IType, CType>> typeConversions = new ConcurrentHashMap<>();
+
+  private static Map<IType, CType> getTypeConversions(String filePrefix) {
+    return typeConversions.computeIfAbsent(
+        filePrefix, k -> Collections.synchronizedMap(new IdentityHashMap<>()));
+  }
 
   /**
    * This can be used to rename a CType in case of Types with equal names but different fields, from
    * different files.
    */
   static void overwriteType(IType cdtType, CType ourType, String filePrefix) {
-    typeConversions.get(filePrefix).put(cdtType, ourType);
+    getTypeConversions(filePrefix).put(cdtType, ourType);
   }
 
   static IType getTypeFromTypeConversion(CType ourCType, String filePrefix) {
-    for (Entry<IType, CType> entry : typeConversions.get(filePrefix).entrySet()) {
-      if (ourCType.equals(entry.getValue())) {
-        return entry.getKey();
+    Map<IType, CType> conversions = getTypeConversions(filePrefix);
+    synchronized (conversions) {
+      for (Entry<IType, CType> entry : conversions.entrySet()) {
+        if (ourCType.equals(entry.getValue())) {
+          return entry.getKey();
+        }
       }
     }
     return null;
   }
 
+  /**
+   * Drop the cached conversions of a file. The ITypes reference the AST of the file, so this should
+   * be called as soon as the file is converted completely, otherwise the AST is kept in memory.
+   */
+  static void releaseTypeConversions(String filePrefix) {
+    typeConversions.remove(filePrefix);
+  }
+
   CType convert(IType t) {
-    CType result = typeConversions.get(filePrefix).get(t);
-    if (result == null) {
-      result = checkNotNull(convert0(t));
-      // re-check, in some cases we updated the map already
-      if (!typeConversions.get(filePrefix).containsKey(t)) {
-        typeConversions.get(filePrefix).put(t, result);
+    Map<IType, CType> conversions = getTypeConversions(filePrefix);
+    // the whole conversion is atomic, such that a type is converted only once even if functions
+    // are converted in parallel, convert0 has side effects like naming anonymous types
+    synchronized (conversions) {
+      CType result = conversions.get(t);
+      if (result == null) {
+        result = checkNotNull(convert0(t));
+        // re-check, in some cases we updated the map already
+        conversions.putIfAbsent(t, result);
       }
+      return result;
     }
-    return result;
   }
 
   /** converts types BOOL, INT,..., PointerTypes, ComplexTypes */
@@ -164,8 +183,7 @@ class ASTTypeConverter {
       // we cheat and put a CElaboratedType instance in the map.
       // This means that wherever the ICompositeType instance appears, it will be
       // replaced by an CElaboratedType.
-      typeConversions
-          .get(filePrefix)
+      getTypeConversions(filePrefix)
           .put(t, new CElaboratedType(false, false, kind, name, compType.getOrigName(), compType));
 
       compType.setMembers(conv(ct.getFields()));
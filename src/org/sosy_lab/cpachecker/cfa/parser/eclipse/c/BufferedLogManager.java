@@ -0,0 +1,99 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.parser.eclipse.c;
+
+import com.google.errorprone.annotations.FormatMethod;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.function.Supplier;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.log.ForwardingLogManager;
+import org.sosy_lab.common.log.LogManager;
+
+/**
+ * Log manager that keeps the messages until {@link #replay()} is called and then passes them to
+ * the delegate. This is used for building the CFAs of functions in parallel, such that the log
+ * messages appear in the order of the functions independently of the scheduling.
+ *
+ * <p>Only the methods that are used during CFA construction are buffered, all others are passed
+ * to the delegate directly.
+ */
+final class BufferedLogManager extends ForwardingLogManager {
+
+  private final LogManager logger;
+  private final List<Runnable> messages;
+
+  BufferedLogManager(LogManager pLogger) {
+    this(pLogger, Collections.synchronizedList(new ArrayList<>()));
+  }
+
+  private BufferedLogManager(LogManager pLogger, List<Runnable> pMessages) {
+    logger = pLogger;
+    messages = pMessages;
+  }
+
+  /** Pass all messages that were logged so far to the delegate, in the order they were logged. */
+  void replay() {
+    List<Runnable> buffered;
+    synchronized (messages) {
+      buffered = new ArrayList<>(messages);
+      messages.clear();
+    }
+    buffered.forEach(Runnable::run);
+  }
+
+  @Override
+  public LogManager withComponentName(String pName) {
+    return new BufferedLogManager(logger.withComponentName(pName), messages);
+  }
+
+  @Override
+  protected LogManager delegate() {
+    return logger;
+  }
+
+  @Override
+  public void log(Level pPriority, Object... pArgs) {
+    if (wouldBeLogged(pPriority)) {
+      messages.add(() -> logger.log(pPriority, pArgs));
+    }
+  }
+
+  @Override
+  public void log(Level pPriority, Supplier<String> pMsgSupplier) {
+    if (wouldBeLogged(pPriority)) {
+      String message = pMsgSupplier.get();
+      messages.add(() -> logger.log(pPriority, message));
+    }
+  }
+
+  @Override
+  @FormatMethod
+  public void logf(Level pPriority, String pFormat, Object... pArgs) {
+    if (wouldBeLogged(pPriority)) {
+      messages.add(() -> logger.logf(pPriority, pFormat, pArgs));
+    }
+  }
+
+  @Override
+  public void logUserException(Level pPriority, Throwable pE, @Nullable String pAdditionalMessage) {
+    if (wouldBeLogged(pPriority)) {
+      messages.add(() -> logger.logUserException(pPriority, pE, pAdditionalMessage));
+    }
+  }
+
+  @Override
+  public void logException(Level pPriority, Throwable pE, @Nullable String pAdditionalMessage) {
+    if (wouldBeLogged(pPriority)) {
+      messages.add(() -> logger.logException(pPriority, pE, pAdditionalMessage));
+    }
+  }
+}
@@ -21,6 +21,8 @@ import java.util.List;
 import java.util.NavigableMap;
 import java.util.Set;
 import java.util.TreeMap;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutorService;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.eclipse.cdt.core.dom.ast.ASTVisitor;
@@ -65,6 +67,11 @@ import org.sosy_lab.cpachecker.util.Pair;
  * <p>After instantiating this class, call {@link #analyzeTranslationUnit(IASTTranslationUnit,
  * String, Scope)} once for each translation unit that should be used and finally call {@link
  * #createCFA()}.
+ *
+ * <p>If an executor is given, the CFAs of the functions are built in parallel after all
+ * translation units were analyzed. The results and the numbering of CFA nodes are the same as in
+ * the sequential case and log messages appear in the order of the functions. Only the names of
+ * anonymous types that are declared inside functions may depend on the scheduling.
  */
 class CFABuilder extends ASTVisitor {
 
@@ -77,6 +84,16 @@ class CFABuilder extends ASTVisitor {
   private final TreeMultimap<String, CFANode> cfaNodes = TreeMultimap.create();
   private final List<String> eliminateableDuplicates = new ArrayList<>();
 
+  // The CFA of a single function, before it is added to the result
+  private record FunctionDefinition(
+      GlobalScope scope, CFAFunctionBuilder builder, Set<CFANode> nodes) {}
+
+  // What the building of a function on another thread reports, passed on after joining
+  private record FunctionReports(BufferedLogManager log, CheckBindingVisitor checkBinding) {}
+
+  // A function built on another thread, whose nodes are numbered locally (see CFANode)
+  private record LocallyNumberedFunction(FunctionDefinition definition, int createdNodes) {}
+
   // Data structure for storing global declarations
   private record GlobalDeclaration(
       ADeclaration declaration, String rawSignature, GlobalScope scope) {}
@@ -104,6 +121,7 @@ class CFABuilder extends ASTVisitor {
   private final LogManagerWithoutDuplicates logger;
   private final ShutdownNotifier shutdownNotifier;
   private final CheckBindingVisitor checkBinding;
+  private final @Nullable ExecutorService executor;
 
   private boolean encounteredAsm = false;
   private Sideassignments sideAssignmentStack = null;
@@ -113,12 +131,14 @@ class CFABuilder extends ASTVisitor {
       LogManager pLogger,
       ShutdownNotifier pShutdownNotifier,
       ParseContext pParseContext,
-      MachineModel pMachine) {
+      MachineModel pMachine,
+      @Nullable ExecutorService pExecutor) {
     options = pOptions;
     logger = new LogManagerWithoutDuplicates(pLogger);
     shutdownNotifier = pShutdownNotifier;
     parseContext = pParseContext;
     machine = pMachine;
+    executor = pExecutor;
 
     checkBinding = new CheckBindingVisitor(pLogger);
 
@@ -341,7 +361,40 @@ class CFABuilder extends ASTVisitor {
       ((CDeclaration) decl.declaration()).getType().accept(fillInAllBindingsVisitor);
     }
 
+    buildFunctions();
+
+    if (encounteredAsm) {
+      logger.log(Level.WARNING, "Inline assembler ignored, analysis is probably unsound!");
+    }
+
+    if (checkBinding.foundUndefinedIdentifiers()) {
+      throw new CParserException(
+          "Invalid C code because of undefined identifiers mentioned above.");
+    }
+
+    if (acslCommentPositions.isEmpty()) {
+      return new ParseResult(cfas, cfaNodes, globalDecls, parsedFiles);
+    }
+
+    return new ParseResultWithCommentLocations(
+        cfas, cfaNodes, globalDecls, parsedFiles, acslCommentPositions, blocks);
+  }
+
+  /**
+   * Build the CFAs of all function definitions that were found in the translation units analyzed
+   * so far. Afterwards, the builder does not reference the syntax trees of these translation units
+   * anymore, so they can be garbage collected even if further translation units are analyzed.
+   */
+  public void buildFunctions() throws CParserException, InterruptedException {
+    fillInBindingsOfPendingTranslationUnits();
+
+    List<Callable<LocallyNumberedFunction>> functionTasks = new ArrayList<>();
+    List<FunctionReports> functionReports = new ArrayList<>();
+    ResolveBindingsVisitor resolveBindings = new ResolveBindingsVisitor();
     for (FunctionsOfTranslationUnit functionDeclaration : functionDeclarations) {
+      if (functionDeclaration.getFirst().isEmpty()) {
+        continue; // no functions or already built
+      }
       GlobalScope actScope = functionDeclaration.scope();
 
       // giving these variables as parameters to the handleFunctionDefinition method
@@ -352,32 +405,103 @@ class CFABuilder extends ASTVisitor {
       ImmutableMap<String, CTypeDefDeclaration> actTypeDefs = actScope.getTypeDefs();
       ImmutableMap<String, CSimpleDeclaration> actVars = actScope.getGlobalVars();
       for (IASTFunctionDefinition declaration : functionDeclaration.getFirst()) {
-        handleFunctionDefinition(
-            actScope,
-            functionDeclaration.fileName(),
-            declaration,
-            actFunctions,
-            actTypes,
-            actTypeDefs,
-            actVars);
+        if (executor == null) {
+          handleFunctionDefinition(
+              actScope,
+              functionDeclaration.fileName(),
+              declaration,
+              actFunctions,
+              actTypes,
+              actTypeDefs,
+              actVars);
+        } else {
+          // CDT resolves bindings lazily without synchronization, so do it here before forking
+          declaration.accept(resolveBindings);
+
+          // each function gets its own stack of side assignments, which is empty at the
+          // beginning and end of a function definition anyway, and reports its messages
+          // only after all functions were built, in the order of the functions
+          FunctionReports reports =
+              new FunctionReports(
+                  new BufferedLogManager(logger), CheckBindingVisitor.withoutLogging());
+          functionReports.add(reports);
+          // the numbers of the nodes would depend on the order in which the threads create them,
+          // so each function numbers its nodes locally and gets its final numbers after joining
+          functionTasks.add(
+              () -> {
+                CFANode.beginLocalNumbering();
+                FunctionDefinition definition;
+                int createdNodes;
+                try {
+                  definition =
+                      buildFunctionDefinition(
+                          actScope,
+                          functionDeclaration.fileName(),
+                          declaration,
+                          actFunctions,
+                          actTypes,
+                          actTypeDefs,
+                          actVars,
+                          new LogManagerWithoutDuplicates(reports.log()),
+                          new Sideassignments(),
+                          reports.checkBinding());
+                } finally {
+                  createdNodes = CFANode.endLocalNumbering();
+                }
+                return new LocallyNumberedFunction(definition, createdNodes);
+              });
+        }
       }
     }
 
-    if (encounteredAsm) {
-      logger.log(Level.WARNING, "Inline assembler ignored, analysis is probably unsound!");
-    }
+    if (executor != null) {
+      List<LocallyNumberedFunction> functions;
+      try {
+        functions = ParallelTasks.invokeAllInOrder(executor, functionTasks);
+      } finally {
+        functionReports.forEach(reports -> reports.log().replay());
+      }
 
-    if (checkBinding.foundUndefinedIdentifiers()) {
-      throw new CParserException(
-          "Invalid C code because of undefined identifiers mentioned above.");
+      // in the order of the functions, such that the numbers are the same as in the sequential
+      // case, including the gaps of the nodes that were removed from the CFA
+      for (int i = 0; i < functions.size(); i++) {
+        FunctionDefinition definition = functions.get(i).definition();
+        CFANode.assignGlobalNumbers(definition.nodes(), functions.get(i).createdNodes());
+        addFunctionDefinition(definition);
+        checkBinding.reportUndefinedNamesOf(functionReports.get(i).checkBinding());
+      }
     }
 
-    if (acslCommentPositions.isEmpty()) {
-      return new ParseResult(cfas, cfaNodes, globalDecls, parsedFiles);
+    for (FunctionsOfTranslationUnit functionDeclaration : functionDeclarations) {
+      functionDeclaration.getFirst().clear();
+      ASTTypeConverter.releaseTypeConversions(functionDeclaration.fileName());
     }
+  }
 
-    return new ParseResultWithCommentLocations(
-        cfas, cfaNodes, globalDecls, parsedFiles, acslCommentPositions, blocks);
+  /**
+   * Fill in the missing bindings of elaborated types in the global declarations of the translation
+   * units whose functions are not built yet, as far as the translation unit itself declares the
+   * types. {@link #createCFA()} fills in the bindings of all global declarations, but the
+   * functions may be built before if the translation units are streamed, and the functions need
+   * the complete types of the global variables they use (e.g., for accessing fields). This fills in
+   * the same types as {@link #createCFA()} would, because it searches the scope of the translation
+   * unit first, which does not change anymore. Elaborated types that are completed only by other
+   * translation units are updated in place later, which the functions see as well.
+   */
+  private void fillInBindingsOfPendingTranslationUnits() {
+    Set<GlobalScope> pendingScopes = new HashSet<>();
+    for (FunctionsOfTranslationUnit functionDeclaration : functionDeclarations) {
+      if (!functionDeclaration.getFirst().isEmpty()) {
+        pendingScopes.add(functionDeclaration.scope());
+      }
+    }
+    for (GlobalDeclaration decl : globalDeclarations) {
+      if (pendingScopes.contains(decl.scope())) {
+        FillInAllBindingsVisitor fillInAllBindingsVisitor =
+            new FillInAllBindingsVisitor(decl.scope(), null);
+        ((CDeclaration) decl.declaration()).getType().accept(fillInAllBindingsVisitor);
+      }
+    }
   }
 
   private void handleFunctionDefinition(
@@ -389,26 +513,66 @@ class CFABuilder extends ASTVisitor {
       ImmutableMap<String, CTypeDefDeclaration> typedefs,
       ImmutableMap<String, CSimpleDeclaration> globalVars)
       throws InterruptedException {
+    addFunctionDefinition(
+        buildFunctionDefinition(
+            actScope,
+            fileName,
+            declaration,
+            functions,
+            types,
+            typedefs,
+            globalVars,
+            logger,
+            sideAssignmentStack,
+            checkBinding));
+  }
+
+  /**
+   * Build the CFA of a single function. This does not modify the state of this builder and can
+   * thus be called concurrently for different functions with separate loggers, side-assignment
+   * stacks, and binding checkers, after the bindings of the functions were resolved.
+   */
+  private FunctionDefinition buildFunctionDefinition(
+      final GlobalScope actScope,
+      String fileName,
+      IASTFunctionDefinition declaration,
+      ImmutableMap<String, CFunctionDeclaration> functions,
+      ImmutableMap<String, CComplexTypeDeclaration> types,
+      ImmutableMap<String, CTypeDefDeclaration> typedefs,
+      ImmutableMap<String, CSimpleDeclaration> globalVars,
+      LogManagerWithoutDuplicates pLogger,
+      Sideassignments pSideAssignmentStack,
+      CheckBindingVisitor pCheckBinding)
+      throws InterruptedException {
 
     FunctionScope localScope =
         new FunctionScope(functions, types, typedefs, globalVars, fileName, artificialScope);
     CFAFunctionBuilder functionBuilder =
         new CFAFunctionBuilder(
             options,
-            logger,
+            pLogger,
             shutdownNotifier,
             localScope,
             parseContext,
             machine,
             fileName,
-            sideAssignmentStack,
-            checkBinding);
+            pSideAssignmentStack,
+            pCheckBinding);
 
     declaration.accept(functionBuilder);
 
     // check whether an interrupt happened while parsing
     shutdownNotifier.shutdownIfNecessary();
 
+    Set<CFANode> functionNodes = functionBuilder.getCfaNodes();
+    functionBuilder.finish();
+    return new FunctionDefinition(actScope, functionBuilder, functionNodes);
+  }
+
+  /** Add the CFA of a function to the result. */
+  private void addFunctionDefinition(FunctionDefinition function) {
+    final GlobalScope actScope = function.scope();
+    CFAFunctionBuilder functionBuilder = function.builder();
     FunctionEntryNode startNode = functionBuilder.getStartNode();
     String functionName = startNode.getFunctionName();
 
@@ -422,7 +586,7 @@ class CFABuilder extends ASTVisitor {
               + cfas.get(functionName).getFileLocation());
     }
     cfas.put(functionName, startNode);
-    cfaNodes.putAll(functionName, functionBuilder.getCfaNodes());
+    cfaNodes.putAll(functionName, function.nodes());
     globalDeclarations.addAll(
         Collections2.transform(
             functionBuilder.getGlobalDeclarations(),
@@ -431,7 +595,6 @@ class CFABuilder extends ASTVisitor {
 
     encounteredAsm |= functionBuilder.didEncounterAsm();
     blocks.addAll(functionBuilder.getBlocks());
-    functionBuilder.finish();
   }
 
   @Override
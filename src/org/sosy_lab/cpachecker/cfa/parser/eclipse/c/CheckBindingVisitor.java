@@ -8,10 +8,12 @@
 
 package org.sosy_lab.cpachecker.cfa.parser.eclipse.c;
 
-import java.util.HashSet;
-import java.util.Set;
+import java.util.LinkedHashMap;
+import java.util.Map;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.ast.FileLocation;
 import org.sosy_lab.cpachecker.cfa.ast.c.CAddressOfLabelExpression;
 import org.sosy_lab.cpachecker.cfa.ast.c.CArrayDesignator;
 import org.sosy_lab.cpachecker.cfa.ast.c.CArrayRangeDesignator;
@@ -60,9 +62,12 @@ class CheckBindingVisitor
         CStatementVisitor<Void, CFAGenerationRuntimeException>,
         CDesignatorVisitor<Void, CFAGenerationRuntimeException> {
 
-  private final LogManager logger;
+  private final @Nullable LogManager logger;
 
-  private final Set<String> printedWarnings = new HashSet<>();
+  private record UndefinedName(boolean isFunction, FileLocation firstReference) {}
+
+  // the undefined identifiers and functions with the location of their first reference
+  private final Map<String, UndefinedName> undefinedNames = new LinkedHashMap<>();
 
   private boolean foundUndefinedIdentifiers = false;
 
@@ -70,10 +75,45 @@ class CheckBindingVisitor
     logger = pLogger;
   }
 
+  private CheckBindingVisitor() {
+    logger = null;
+  }
+
+  /**
+   * Create a visitor that only collects the undefined identifiers and functions without logging
+   * them. This is used for building the CFA of a function on another thread, afterwards they can be
+   * reported with {@link #reportUndefinedNamesOf(CheckBindingVisitor)} in a deterministic order.
+   */
+  static CheckBindingVisitor withoutLogging() {
+    return new CheckBindingVisitor();
+  }
+
   public boolean foundUndefinedIdentifiers() {
     return foundUndefinedIdentifiers;
   }
 
+  /** Report the undefined names collected by another visitor as if this visitor found them. */
+  void reportUndefinedNamesOf(CheckBindingVisitor pOther) {
+    pOther.undefinedNames.forEach(this::reportUndefinedName);
+  }
+
+  private void reportUndefinedName(String pName, UndefinedName pUndefinedName) {
+    if (undefinedNames.putIfAbsent(pName, pUndefinedName) != null) {
+      return; // already reported
+    }
+    if (!pUndefinedName.isFunction()) {
+      foundUndefinedIdentifiers = true;
+    }
+    if (logger != null) {
+      logger.log(
+          Level.WARNING,
+          pUndefinedName.isFunction() ? "Undefined function" : "Undefined identifier",
+          pName,
+          pUndefinedName.isFunction() ? "found, first called in" : "found, first referenced in",
+          pUndefinedName.firstReference());
+    }
+  }
+
   @Override
   public Void visit(CArraySubscriptExpression e) {
     e.getArrayExpression().accept(this);
@@ -109,15 +149,7 @@ class CheckBindingVisitor
   @Override
   public Void visit(CIdExpression e) {
     if (e.getDeclaration() == null) {
-      if (printedWarnings.add(e.getName())) {
-        logger.log(
-            Level.WARNING,
-            "Undefined identifier",
-            e.getName(),
-            "found, first referenced in",
-            e.getFileLocation());
-        foundUndefinedIdentifiers = true;
-      }
+      reportUndefinedName(e.getName(), new UndefinedName(false, e.getFileLocation()));
     }
     return null;
   }
@@ -179,14 +211,8 @@ class CheckBindingVisitor
               + " is not a valid function type (neither a plain function nor a function-pointer).";
 
       if (f.getDeclaration() == null) {
-        if (!BuiltinFunctions.isBuiltinFunction(f.getName()) // GCC builtin functions
-            && printedWarnings.add(f.getName())) {
-          logger.log(
-              Level.WARNING,
-              "Undefined function",
-              f.getName(),
-              "found, first called in",
-              e.getFileLocation());
+        if (!BuiltinFunctions.isBuiltinFunction(f.getName())) { // GCC builtin functions
+          reportUndefinedName(f.getName(), new UndefinedName(true, e.getFileLocation()));
         }
       }
 
@@ -29,6 +29,9 @@ import java.util.HashMap;
 import java.util.Iterator;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutorService;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.eclipse.cdt.core.dom.ast.IASTCompoundStatement;
 import org.eclipse.cdt.core.dom.ast.IASTDeclaration;
 import org.eclipse.cdt.core.dom.ast.IASTFunctionDefinition;
@@ -51,6 +54,7 @@ import org.sosy_lab.cpachecker.cfa.parser.Parsers.EclipseCParserOptions;
 import org.sosy_lab.cpachecker.cfa.parser.Scope;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.exceptions.CParserException;
+import org.sosy_lab.cpachecker.util.statistics.ProcessCpuTimer;
 
 /** Parser based on Eclipse CDT */
 class EclipseCParser implements CParser {
@@ -64,6 +68,8 @@ class EclipseCParser implements CParser {
 
   private final Timer parseTimer = new Timer();
   private final Timer cfaTimer = new Timer();
+  private final ProcessCpuTimer parseCpuTimer = new ProcessCpuTimer();
+  private final ProcessCpuTimer cfaCpuTimer = new ProcessCpuTimer();
 
   public EclipseCParser(
       LogManager pLogger,
@@ -115,19 +121,142 @@ class EclipseCParser implements CParser {
     ParseContext parseContext =
         new ParseContext(createNiceFileNameFunction(fileNameMapping.keySet()), sourceOriginMapping);
 
-    List<IASTTranslationUnit> astUnits = new ArrayList<>(pInput.size());
+    int threads = options.getParserThreads();
+    if (options.streamTranslationUnits()) {
+      if (threads <= 1) {
+        return parseAndConvertOneByOne(pInput, parseContext, scope, pWrapperFunction, null);
+      }
+      ExecutorService executor = ParallelTasks.createExecutor(threads);
+      try {
+        return parseAndConvertOneByOne(pInput, parseContext, scope, pWrapperFunction, executor);
+      } finally {
+        executor.shutdownNow();
+      }
+    }
+
+    if (threads <= 1) {
+      List<IASTTranslationUnit> astUnits = new ArrayList<>(pInput.size());
+
+      for (FileToParse f : pInput) {
+        final Path fileName = fixPath(f.getFileName());
+
+        try {
+          astUnits.add(parse(pWrapperFunction.wrap(fileName, f), parseContext));
+        } catch (IOException e) {
+          throw new CParserException("IO failed!", e);
+        }
+      }
 
+      return buildCFA(astUnits, parseContext, scope, null);
+    }
+
+    ExecutorService executor = ParallelTasks.createExecutor(threads);
+    try {
+      return buildCFA(
+          parseInParallel(pInput, parseContext, pWrapperFunction, executor),
+          parseContext,
+          scope,
+          executor);
+    } finally {
+      executor.shutdownNow();
+    }
+  }
+
+  /**
+   * Parse all translation units in parallel. The translation units are returned in the order of
+   * the input, which keeps the subsequent merging of the global scopes deterministic.
+   */
+  private List<IASTTranslationUnit> parseInParallel(
+      List<? extends FileToParse> pInput,
+      ParseContext parseContext,
+      FileParseWrapper pWrapperFunction,
+      ExecutorService executor)
+      throws CParserException, InterruptedException {
+    List<Callable<IASTTranslationUnit>> tasks = new ArrayList<>(pInput.size());
     for (FileToParse f : pInput) {
       final Path fileName = fixPath(f.getFileName());
+      tasks.add(
+          () -> {
+            try {
+              return getASTTranslationUnit(pWrapperFunction.wrap(fileName, f), parseContext);
+            } catch (IOException e) {
+              throw new CParserException("IO failed!", e);
+            }
+          });
+    }
 
-      try {
-        astUnits.add(parse(pWrapperFunction.wrap(fileName, f), parseContext));
-      } catch (IOException e) {
-        throw new CParserException("IO failed!", e);
-      }
+    parseTimer.start();
+    parseCpuTimer.start();
+    try {
+      return ParallelTasks.invokeAllInOrder(executor, tasks);
+    } finally {
+      parseCpuTimer.stop();
+      parseTimer.stop();
     }
+  }
 
-    return buildCFA(astUnits, parseContext, scope);
+  /**
+   * Parse the translation units one after another and convert each of them, including the CFAs of
+   * its functions, before the next one is parsed. This keeps only the syntax tree of a single
+   * translation unit in memory instead of the syntax trees of all translation units. The functions
+   * of a translation unit are still built in parallel if an executor is given.
+   */
+  private ParseResult parseAndConvertOneByOne(
+      List<? extends FileToParse> pInput,
+      ParseContext parseContext,
+      Scope pScope,
+      FileParseWrapper pWrapperFunction,
+      @Nullable ExecutorService executor)
+      throws CParserException, InterruptedException {
+    checkArgument(!pInput.isEmpty());
+    CFABuilder builder =
+        new CFABuilder(options, logger, shutdownNotifier, parseContext, machine, executor);
+
+    for (FileToParse f : pInput) {
+      parseAndConvert(f, pInput.size() == 1, builder, parseContext, pScope, pWrapperFunction);
+    }
+
+    cfaTimer.start();
+    cfaCpuTimer.start();
+    try {
+      return builder.createCFA();
+    } catch (CFAGenerationRuntimeException e) {
+      throw new CParserException(e);
+    } finally {
+      cfaCpuTimer.stop();
+      cfaTimer.stop();
+    }
+  }
+
+  /** Parse and convert a single translation unit, its syntax tree is not referenced afterwards. */
+  private void parseAndConvert(
+      FileToParse pFile,
+      boolean pIsOnlyFile,
+      CFABuilder builder,
+      ParseContext parseContext,
+      Scope pScope,
+      FileParseWrapper pWrapperFunction)
+      throws CParserException, InterruptedException {
+    IASTTranslationUnit ast;
+    try {
+      ast = parse(pWrapperFunction.wrap(fixPath(pFile.getFileName()), pFile), parseContext);
+    } catch (IOException e) {
+      throw new CParserException("IO failed!", e);
+    }
+
+    cfaTimer.start();
+    cfaCpuTimer.start();
+    try {
+      // we don't need any file prefix if we only have one file
+      String staticVariablePrefix = pIsOnlyFile ? "" : getStaticVariablePrefix(ast, parseContext);
+      builder.analyzeTranslationUnit(ast, staticVariablePrefix, pScope);
+      builder.buildFunctions();
+    } catch (CFAGenerationRuntimeException e) {
+      throw new CParserException(e);
+    } finally {
+      cfaCpuTimer.stop();
+      cfaTimer.stop();
+    }
   }
 
   @Override
@@ -259,6 +388,19 @@ class EclipseCParser implements CParser {
   private IASTTranslationUnit parse(FileContent codeReader, ParseContext parseContext)
       throws CParserException, InterruptedException {
     parseTimer.start();
+    parseCpuTimer.start();
+    try {
+      return getASTTranslationUnit(codeReader, parseContext);
+    } finally {
+      parseCpuTimer.stop();
+      parseTimer.stop();
+    }
+  }
+
+  /** Parse a translation unit without measuring the time, may be called concurrently. */
+  private IASTTranslationUnit getASTTranslationUnit(
+      FileContent codeReader, ParseContext parseContext)
+      throws CParserException, InterruptedException {
     try {
       IASTTranslationUnit result = eclipseCdt.getASTTranslationUnit(codeReader);
 
@@ -287,8 +429,6 @@ class EclipseCParser implements CParser {
 
     } catch (CFAGenerationRuntimeException | CoreException e) {
       throw new CParserException(e);
-    } finally {
-      parseTimer.stop();
     }
   }
 
@@ -306,16 +446,22 @@ class EclipseCParser implements CParser {
    *
    * @param asts a List of Pairs of translation units and the appropriate prefix for static
    *     variables
+   * @param executor the executor for building the CFAs of functions in parallel, or null
    */
   private ParseResult buildCFA(
-      List<IASTTranslationUnit> asts, ParseContext parseContext, Scope pScope)
+      List<IASTTranslationUnit> asts,
+      ParseContext parseContext,
+      Scope pScope,
+      @Nullable ExecutorService executor)
       throws CParserException, InterruptedException {
 
     checkArgument(!asts.isEmpty());
     cfaTimer.start();
+    cfaCpuTimer.start();
 
     try {
-      CFABuilder builder = new CFABuilder(options, logger, shutdownNotifier, parseContext, machine);
+      CFABuilder builder =
+          new CFABuilder(options, logger, shutdownNotifier, parseContext, machine, executor);
 
       // we don't need any file prefix if we only have one file
       if (asts.size() == 1) {
@@ -327,11 +473,7 @@ class EclipseCParser implements CParser {
         // the prefix
       } else {
         for (IASTTranslationUnit ast : asts) {
-          String staticVariablePrefix =
-              LEGAL_VAR_NAME_CHARACTERS
-                  .negate()
-                  .replaceFrom(parseContext.mapFileNameToNameForHumans(ast.getFilePath()), "_");
-          builder.analyzeTranslationUnit(ast, staticVariablePrefix, pScope);
+          builder.analyzeTranslationUnit(ast, getStaticVariablePrefix(ast, parseContext), pScope);
         }
       }
 
@@ -340,10 +482,18 @@ class EclipseCParser implements CParser {
     } catch (CFAGenerationRuntimeException e) {
       throw new CParserException(e);
     } finally {
+      cfaCpuTimer.stop();
       cfaTimer.stop();
     }
   }
 
+  private static String getStaticVariablePrefix(
+      IASTTranslationUnit ast, ParseContext parseContext) {
+    return LEGAL_VAR_NAME_CHARACTERS
+        .negate()
+        .replaceFrom(parseContext.mapFileNameToNameForHumans(ast.getFilePath()), "_");
+  }
+
   /**
    * Given a file name, this function returns a "nice" representation of it. This should be used for
    * situations where the name is going to be presented to the user. The result may be the empty
@@ -400,6 +550,16 @@ class EclipseCParser implements CParser {
     return cfaTimer;
   }
 
+  @Override
+  public ProcessCpuTimer getParseCpuTime() {
+    return parseCpuTimer;
+  }
+
+  @Override
+  public ProcessCpuTimer getCFAConstructionCpuTime() {
+    return cfaCpuTimer;
+  }
+
   /**
    * Wrapper for {@link CSourceOriginMapping} that does the reverse file-name mapping of {@link
    * EclipseCParser#fixPath(Path)}, otherwise file-name lookup fails and origin-source mapping does
@@ -0,0 +1,229 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.parser.eclipse.c;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSortedSet;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CParser;
+import org.sosy_lab.cpachecker.cfa.ParseResult;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CDeclarationEdge;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.c.CPointerType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class EclipseCParserTest {
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private ParseResult parse(List<String> pFiles, boolean pStream)
+      throws InvalidConfigurationException, ParserException, InterruptedException {
+    return parse(pFiles, pStream, 1);
+  }
+
+  private ParseResult parse(List<String> pFiles, boolean pStream, int pThreads)
+      throws InvalidConfigurationException, ParserException, InterruptedException {
+    CParser parser =
+        CParser.Factory.getParser(
+            LogManager.createTestLogManager(),
+            CParser.Factory.getOptions(
+                TestDataTools.configurationForTest()
+                    .setOption("cfa.streamTranslationUnits", String.valueOf(pStream))
+                    .setOption("cfa.parserThreads", String.valueOf(pThreads))
+                    .build()),
+            MachineModel.LINUX32,
+            ShutdownNotifier.createDummy());
+    return parser.parseFiles(pFiles);
+  }
+
+  private String writeFile(String pName, String pContent) throws IOException {
+    Path file = tempFolder.newFile(pName).toPath();
+    Files.writeString(file, pContent, StandardCharsets.US_ASCII);
+    return file.toString();
+  }
+
+  private static List<String> getGlobalDeclarations(ParseResult pParseResult) {
+    return pParseResult.getGlobalDeclarations().stream()
+        .map(declaration -> declaration.getFirst().toASTString())
+        .toList();
+  }
+
+  /**
+   * Describe all edges of the CFA, with the node numbers relative to the smallest node number. The
+   * first number differs between parser runs, but the gaps left by nodes that were removed from
+   * the CFA must not.
+   */
+  private static List<String> describeEdges(ParseResult pParseResult) {
+    ImmutableSortedSet<CFANode> nodes =
+        ImmutableSortedSet.copyOf(pParseResult.getCFANodes().values());
+    int first = nodes.first().getNodeNumber();
+    List<String> edges = new ArrayList<>();
+    for (CFANode node : nodes) {
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        edges.add(
+            node.getFunctionName()
+                + ": "
+                + (edge.getPredecessor().getNodeNumber() - first)
+                + " -> "
+                + (edge.getSuccessor().getNodeNumber() - first)
+                + " "
+                + edge.getDescription());
+      }
+    }
+    return edges;
+  }
+
+  /**
+   * Describe the declarations in the functions, together with the kind of the type they refer to
+   * (behind pointers), which shows whether elaborated types were completed.
+   */
+  private static List<String> describeLocalDeclarations(ParseResult pParseResult) {
+    List<String> declarations = new ArrayList<>();
+    for (CFANode node : ImmutableSortedSet.copyOf(pParseResult.getCFANodes().values())) {
+      for (CDeclarationEdge edge : CFAUtils.leavingEdges(node).filter(CDeclarationEdge.class)) {
+        if (!edge.getDeclaration().isGlobal()) {
+          CType type = edge.getDeclaration().getType().getCanonicalType();
+          while (type instanceof CPointerType pointerType) {
+            type = pointerType.getType();
+          }
+          declarations.add(
+              edge.getDeclaration().toASTString() + " " + type.getClass().getSimpleName());
+        }
+      }
+    }
+    return declarations;
+  }
+
+  @Test
+  public void testParallelEqualsSequential()
+      throws IOException, InvalidConfigurationException, ParserException, InterruptedException {
+    List<String> files =
+        ImmutableList.of(
+            writeFile(
+                "lib.c",
+                "struct point { int x; int y; };\n"
+                    + "int norm(struct point *p) { if (p->x < 0) { return -p->x + p->y; }"
+                    + " return p->x + p->y; }\n"
+                    + "int sum(int n) { int s = 0; for (int i = 0; i < n; i++) { s += i; }"
+                    + " return s; }\n"),
+            writeFile(
+                "main.c",
+                "struct point { int x; int y; };\n"
+                    + "int norm(struct point *p);\n"
+                    + "int sum(int n);\n"
+                    // the dead code creates nodes that are removed from the CFA
+                    + "int max(int a, int b) { return a > b ? a : b; a++; }\n"
+                    + "int main() { struct point p = {1, 2}; while (sum(3) > 0) { p.x--; }"
+                    + " return max(norm(&p), undefined_function()); }\n"));
+
+    for (boolean stream : new boolean[] {false, true}) {
+      ParseResult expected = parse(files, stream, 1);
+      List<String> expectedEdges = describeEdges(expected);
+      assertThat(expectedEdges).isNotEmpty();
+
+      ParseResult parallel = parse(files, stream, 4);
+      assertThat(parallel.getFunctions().keySet())
+          .containsExactlyElementsIn(expected.getFunctions().keySet())
+          .inOrder();
+      assertThat(describeEdges(parallel)).containsExactlyElementsIn(expectedEdges).inOrder();
+      assertThat(getGlobalDeclarations(parallel))
+          .containsExactlyElementsIn(getGlobalDeclarations(expected))
+          .inOrder();
+    }
+  }
+
+  @Test
+  public void testStreamTranslationUnits()
+      throws IOException, InvalidConfigurationException, ParserException, InterruptedException {
+    List<String> files =
+        ImmutableList.of(
+            writeFile(
+                "lib.c",
+                "struct point { int x; int y; };\n"
+                    + "static int counter;\n"
+                    + "int norm(struct point *p) { counter++; return p->x + p->y; }\n"),
+            writeFile(
+                "main.c",
+                "struct point;\n"
+                    + "static int counter;\n"
+                    + "int norm(struct point *p);\n"
+                    + "int main() { counter = 1; return norm(0); }\n"));
+
+    ParseResult expected = parse(files, false);
+    ParseResult streamed = parse(files, true);
+
+    assertThat(streamed.getFunctions().keySet())
+        .containsExactlyElementsIn(expected.getFunctions().keySet())
+        .inOrder();
+    for (String function : expected.getFunctions().keySet()) {
+      assertThat(streamed.getCFANodes().get(function))
+          .hasSize(expected.getCFANodes().get(function).size());
+    }
+    assertThat(getGlobalDeclarations(streamed))
+        .containsExactlyElementsIn(getGlobalDeclarations(expected))
+        .inOrder();
+  }
+
+  @Test
+  public void testStreamTypeCompletedByLaterTranslationUnit()
+      throws IOException, InvalidConfigurationException, ParserException, InterruptedException {
+    // struct point is incomplete in the first translation unit, whose functions are built before
+    // the second one is parsed, and struct counter is defined after a global variable uses it
+    List<String> files =
+        ImmutableList.of(
+            writeFile(
+                "main.c",
+                "struct point;\n"
+                    + "struct point *origin;\n"
+                    + "struct counter *current;\n"
+                    + "struct counter { int value; };\n"
+                    + "int getX(struct point *p);\n"
+                    + "int next() { return ++current->value; }\n"
+                    + "int main() { struct point *q = origin; next(); return getX(q); }\n"),
+            writeFile(
+                "lib.c",
+                "struct point { int x; int y; };\n"
+                    + "extern struct point *origin;\n"
+                    + "int getX(struct point *p) { return p->x + origin->y; }\n"));
+
+    ParseResult expected = parse(files, false);
+    ParseResult streamed = parse(files, true);
+
+    assertThat(streamed.getFunctions().keySet())
+        .containsExactlyElementsIn(expected.getFunctions().keySet())
+        .inOrder();
+    assertThat(describeEdges(streamed))
+        .containsExactlyElementsIn(describeEdges(expected))
+        .inOrder();
+    assertThat(describeLocalDeclarations(streamed))
+        .containsExactlyElementsIn(describeLocalDeclarations(expected))
+        .inOrder();
+    assertThat(getGlobalDeclarations(streamed))
+        .containsExactlyElementsIn(getGlobalDeclarations(expected))
+        .inOrder();
+  }
+}
@@ -25,14 +25,15 @@ import org.sosy_lab.cpachecker.exceptions.NoException;
 
 /**
  * Visitor that fills in missing bindings of CElaboratedTypes with matching types from the scope (if
- * name and kind match, of course).
+ * name and kind match, of course). If the scope has no matching type, the types of the whole
+ * program are searched, unless no program declarations are given.
  */
 class FillInAllBindingsVisitor extends DefaultCTypeVisitor<@Nullable Void, NoException> {
 
   private final Scope scope;
-  private final ProgramDeclarations programDeclarations;
+  private final @Nullable ProgramDeclarations programDeclarations;
 
-  FillInAllBindingsVisitor(Scope pScope, ProgramDeclarations pProgramDeclarations) {
+  FillInAllBindingsVisitor(Scope pScope, @Nullable ProgramDeclarations pProgramDeclarations) {
     scope = pScope;
     programDeclarations = pProgramDeclarations;
   }
@@ -64,7 +65,7 @@ class FillInAllBindingsVisitor extends DefaultCTypeVisitor<@Nullable Void, NoExc
       while (realType instanceof CElaboratedType) {
         realType = ((CElaboratedType) realType).getRealType();
       }
-      if (realType == null) {
+      if (realType == null && programDeclarations != null) {
         realType =
             programDeclarations.lookupType(
                 pElaboratedType.getQualifiedName(), pElaboratedType.getOrigName());
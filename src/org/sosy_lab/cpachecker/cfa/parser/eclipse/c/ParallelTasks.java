@@ -0,0 +1,65 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.parser.eclipse.c;
+
+import com.google.common.base.Throwables;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import org.sosy_lab.cpachecker.exceptions.CParserException;
+
+/** Utilities for running independent parts of the parsing and CFA construction in parallel. */
+final class ParallelTasks {
+
+  private ParallelTasks() {}
+
+  static ExecutorService createExecutor(int pThreads) {
+    return Executors.newFixedThreadPool(
+        pThreads,
+        new ThreadFactoryBuilder()
+            .setDaemon(true) // for killing hanging threads at program exit
+            .setNameFormat("CFA-builder-thread-%d")
+            .build());
+  }
+
+  /**
+   * Run the given tasks on the executor and return their results in the order of the tasks, such
+   * that callers can merge the results deterministically regardless of the scheduling. If a task
+   * fails, the remaining tasks are cancelled and the exception of the first failed task (in order)
+   * is rethrown.
+   */
+  static <T> List<T> invokeAllInOrder(ExecutorService pExecutor, List<Callable<T>> pTasks)
+      throws CParserException, InterruptedException {
+    List<Future<T>> futures = new ArrayList<>(pTasks.size());
+    for (Callable<T> task : pTasks) {
+      futures.add(pExecutor.submit(task));
+    }
+
+    List<T> results = new ArrayList<>(futures.size());
+    try {
+      for (Future<T> future : futures) {
+        results.add(future.get());
+      }
+    } catch (ExecutionException e) {
+      Throwable cause = e.getCause();
+      Throwables.throwIfInstanceOf(cause, CParserException.class);
+      Throwables.throwIfInstanceOf(cause, InterruptedException.class);
+      Throwables.throwIfUnchecked(cause);
+      throw new AssertionError("unexpected exception during parallel CFA construction", cause);
+    } finally {
+      futures.forEach(future -> future.cancel(true));
+    }
+    return results;
+  }
+}
@@ -0,0 +1,97 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.parser.eclipse.c;
+
+import java.util.Collections;
+import java.util.IdentityHashMap;
+import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.eclipse.cdt.core.dom.ast.ASTVisitor;
+import org.eclipse.cdt.core.dom.ast.IASTExpression;
+import org.eclipse.cdt.core.dom.ast.IASTName;
+import org.eclipse.cdt.core.dom.ast.IArrayType;
+import org.eclipse.cdt.core.dom.ast.IBinding;
+import org.eclipse.cdt.core.dom.ast.ICompositeType;
+import org.eclipse.cdt.core.dom.ast.IField;
+import org.eclipse.cdt.core.dom.ast.IFunction;
+import org.eclipse.cdt.core.dom.ast.IFunctionType;
+import org.eclipse.cdt.core.dom.ast.IPointerType;
+import org.eclipse.cdt.core.dom.ast.IQualifierType;
+import org.eclipse.cdt.core.dom.ast.IType;
+import org.eclipse.cdt.core.dom.ast.ITypedef;
+import org.eclipse.cdt.core.dom.ast.IVariable;
+
+/**
+ * Visitor that resolves the bindings of all names and the types of all expressions in an AST in
+ * advance, including the types and fields reachable from them.
+ *
+ * <p>CDT computes bindings and types lazily and caches them in the AST and in the bindings without
+ * any synchronization. Bindings and types are shared between the functions of a translation unit,
+ * so they have to be resolved by a single thread before the CFAs of the functions are built in
+ * parallel. Afterwards, the conversion only reads the cached results.
+ */
+class ResolveBindingsVisitor extends ASTVisitor {
+
+  // CDT returns the same instances for the same bindings and types, so each is resolved once
+  private final Set<Object> resolved = Collections.newSetFromMap(new IdentityHashMap<>());
+
+  ResolveBindingsVisitor() {
+    shouldVisitNames = true;
+    shouldVisitExpressions = true;
+  }
+
+  @Override
+  public int visit(IASTName pName) {
+    resolve(pName.resolveBinding());
+    return PROCESS_CONTINUE;
+  }
+
+  @Override
+  public int visit(IASTExpression pExpression) {
+    resolve(pExpression.getExpressionType());
+    return PROCESS_CONTINUE;
+  }
+
+  private void resolve(@Nullable IBinding pBinding) {
+    if (pBinding instanceof IType type) {
+      resolve(type);
+    } else if (pBinding != null && resolved.add(pBinding)) {
+      if (pBinding instanceof IVariable variable) {
+        resolve(variable.getType());
+      } else if (pBinding instanceof IFunction function) {
+        resolve(function.getType());
+      }
+    }
+  }
+
+  private void resolve(@Nullable IType pType) {
+    if (pType == null || !resolved.add(pType)) {
+      return;
+    }
+    if (pType instanceof ITypedef typedef) {
+      resolve(typedef.getType());
+    } else if (pType instanceof ICompositeType compositeType) {
+      // also looks up the definition of the type, which may be in another part of the AST
+      for (IField field : compositeType.getFields()) {
+        resolve(field);
+      }
+    } else if (pType instanceof IPointerType pointerType) {
+      resolve(pointerType.getType());
+    } else if (pType instanceof IArrayType arrayType) {
+      resolve(arrayType.getType());
+    } else if (pType instanceof IQualifierType qualifierType) {
+      resolve(qualifierType.getType());
+    } else if (pType instanceof IFunctionType functionType) {
+      resolve(functionType.getReturnType());
+      for (IType parameterType : functionType.getParameterTypes()) {
+        resolve(parameterType);
+      }
+    }
+  }
+}
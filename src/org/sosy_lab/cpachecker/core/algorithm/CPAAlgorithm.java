@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.core.algorithm;
 
 import com.google.common.base.Functions;
+import com.google.common.collect.ImmutableSet;
 import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.Collection;
@@ -18,12 +19,17 @@ import java.util.List;
 import java.util.Map;
 import java.util.Map.Entry;
 import java.util.Optional;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinWorkerThread;
+import java.util.concurrent.Future;
 import java.util.concurrent.TimeUnit;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.ClassOption;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -45,9 +51,14 @@ import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.cpa.arg.ARGCPA;
 import org.sosy_lab.cpachecker.cpa.arg.ARGMergeJoinCPAEnabledAnalysis;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.cpa.arg.ARGTransferRelation;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.CPAs;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.statistics.AbstractStatValue;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
@@ -76,6 +87,8 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     private int countMerge = 0;
     private int countStop = 0;
     private int countBreak = 0;
+    private int countParallelBatches = 0;
+    private int countSkippedBatchStates = 0;
 
     private Map<String, AbstractStatValue> reachedSetStatistics = new HashMap<>();
 
@@ -141,6 +154,10 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
       out.println("Number of times merged:          " + countMerge);
       out.println("Number of times stopped:         " + countStop);
       out.println("Number of times breaked:         " + countBreak);
+      if (countParallelBatches > 0) {
+        out.println("Number of parallel batches:      " + countParallelBatches);
+        out.println("Number of skipped batch states:  " + countSkippedBatchStates);
+      }
       out.println();
       out.println(
           "Total time for CPA algorithm:     "
@@ -179,6 +196,32 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
                 + " Useful for incomplete analysis with no counterexample checking.")
     private boolean reportFalseAsUnknown = false;
 
+    @Option(
+        secure = true,
+        name = "parallelExploration.threads",
+        description =
+            "Number of worker threads that compute successors concurrently. "
+                + "A value larger than 1 enables the parallel exploration mode: "
+                + "states are taken from the waitlist in batches, their successors are computed "
+                + "by a work-stealing thread pool, and merge, stop, and add are committed "
+                + "sequentially in the order in which the states were taken from the waitlist. "
+                + "ARG states are created when the successors are committed, so ARGCPA has to be "
+                + "the outermost CPA. Identifiers that other transfer relations assign to new "
+                + "states depend on the scheduling of the threads, so results that depend on them "
+                + "may differ between runs. "
+                + "This requires that the transfer relation of the CPA is thread-safe.")
+    @IntegerOption(min = 1)
+    private int parallelThreads = 1;
+
+    @Option(
+        secure = true,
+        name = "parallelExploration.batchSize",
+        description =
+            "Maximal number of states that are taken from the waitlist at once "
+                + "in the parallel exploration mode (0 for four times the number of threads).")
+    @IntegerOption(min = 0)
+    private int parallelBatchSize = 0;
+
     private final ForcedCovering forcedCovering;
 
     private final ConfigurableProgramAnalysis cpa;
@@ -197,6 +240,17 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
       this.logger = logger;
       shutdownNotifier = pShutdownNotifier;
 
+      if (forcedCoveringClass != null && parallelThreads > 1) {
+        throw new InvalidConfigurationException(
+            "Forced covering is not supported in the parallel exploration mode.");
+      }
+      if (parallelThreads > 1
+          && !(cpa instanceof ARGCPA)
+          && CPAs.retrieveCPA(cpa, ARGCPA.class) != null) {
+        // the ARG is only updated by the committing thread if ARGCPA is the outermost CPA
+        throw new InvalidConfigurationException(
+            "The parallel exploration mode supports ARGCPA only as the outermost CPA.");
+      }
       if (forcedCoveringClass != null) {
         forcedCovering = forcedCoveringClass.create(config, logger, cpa);
       } else {
@@ -206,7 +260,15 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
 
     @Override
     public CPAAlgorithm newInstance() {
-      return new CPAAlgorithm(cpa, logger, shutdownNotifier, forcedCovering, reportFalseAsUnknown);
+      int batchSize = parallelBatchSize > 0 ? parallelBatchSize : 4 * parallelThreads;
+      return new CPAAlgorithm(
+          cpa,
+          logger,
+          shutdownNotifier,
+          forcedCovering,
+          reportFalseAsUnknown,
+          parallelThreads,
+          batchSize);
     }
   }
 
@@ -225,6 +287,8 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
   private final CPAStatistics stats = new CPAStatistics();
 
   private final TransferRelation transferRelation;
+  // set if ARGCPA is the outermost CPA, whose transfer relation changes the ARG
+  private final @Nullable ARGTransferRelation argTransferRelation;
   private final MergeOperator mergeOperator;
   private final StopOperator stopOperator;
   private final PrecisionAdjustment precisionAdjustment;
@@ -235,14 +299,21 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
 
   private final AlgorithmStatus status;
 
+  private final int parallelThreads;
+  private final int parallelBatchSize;
+
   private CPAAlgorithm(
       ConfigurableProgramAnalysis cpa,
       LogManager logger,
       ShutdownNotifier pShutdownNotifier,
       ForcedCovering pForcedCovering,
-      boolean pIsImprecise) {
+      boolean pIsImprecise,
+      int pParallelThreads,
+      int pParallelBatchSize) {
 
     transferRelation = cpa.getTransferRelation();
+    argTransferRelation =
+        transferRelation instanceof ARGTransferRelation argTransfer ? argTransfer : null;
     mergeOperator = cpa.getMergeOperator();
     stopOperator = cpa.getStopOperator();
     precisionAdjustment = cpa.getPrecisionAdjustment();
@@ -250,6 +321,8 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     shutdownNotifier = pShutdownNotifier;
     forcedCovering = pForcedCovering;
     status = AlgorithmStatus.SOUND_AND_PRECISE.withPrecise(!pIsImprecise);
+    parallelThreads = pParallelThreads;
+    parallelBatchSize = pParallelBatchSize;
   }
 
   @Override
@@ -257,6 +330,9 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
       throws CPAException, InterruptedException {
     stats.totalTimer.start();
     try {
+      if (parallelThreads > 1) {
+        return runParallel(reachedSet);
+      }
       return run0(reachedSet);
     } finally {
       stats.stopAllTimers();
@@ -301,6 +377,171 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     return status;
   }
 
+  /**
+   * Parallel variant of {@link #run0(ReachedSet)}. States are taken from the waitlist in batches
+   * and their successors are computed concurrently by a work-stealing pool. The successors are
+   * then committed to the reached set by the calling thread, one state after another in the order
+   * in which the states were popped from the waitlist. Thus all accesses to the reached set,
+   * precision adjustment, merge, and stop happen sequentially, only the transfer relation is
+   * executed concurrently. If ARGCPA is the outermost CPA, the workers only compute the successors
+   * of the wrapped states, and the ARG states are created and linked when the successors are
+   * committed. Thus the ARG is only changed by the calling thread, and states of the batch that are
+   * skipped or handled later do not get children. Note that states created by the transfer relation
+   * of a wrapped CPA may still differ between runs if they depend on the scheduling.
+   */
+  private AlgorithmStatus runParallel(final ReachedSet reachedSet)
+      throws CPAException, InterruptedException {
+    final ForkJoinPool pool =
+        new ForkJoinPool(
+            parallelThreads,
+            p -> {
+              ForkJoinWorkerThread thread =
+                  ForkJoinPool.defaultForkJoinWorkerThreadFactory.newThread(p);
+              thread.setName("CPAAlgorithm-worker-" + thread.getPoolIndex());
+              return thread;
+            },
+            null,
+            false);
+    try {
+      while (reachedSet.hasWaitingState()) {
+        shutdownNotifier.shutdownIfNecessary();
+
+        int size = reachedSet.getWaitlist().size();
+        if (size >= stats.maxWaitlistSize) {
+          stats.maxWaitlistSize = size;
+        }
+
+        stats.chooseTimer.start();
+        List<AbstractState> batch = new ArrayList<>(parallelBatchSize);
+        List<Precision> batchPrecisions = new ArrayList<>(parallelBatchSize);
+        while (batch.size() < parallelBatchSize && reachedSet.hasWaitingState()) {
+          AbstractState state = reachedSet.popFromWaitlist();
+          batch.add(state);
+          batchPrecisions.add(reachedSet.getPrecision(state));
+        }
+        stats.chooseTimer.stop();
+        stats.countParallelBatches++;
+        logger.log(Level.FINER, "Retrieved batch of", batch.size(), "states from waitlist");
+
+        List<Future<Collection<? extends AbstractState>>> futures =
+            new ArrayList<>(batch.size());
+        for (int i = 0; i < batch.size(); i++) {
+          final AbstractState state = batch.get(i);
+          final Precision precision = batchPrecisions.get(i);
+          futures.add(pool.submit(() -> computeSuccessorsConcurrently(state, precision)));
+        }
+
+        int committed = 0;
+        try {
+          for (; committed < batch.size(); committed++) {
+            final AbstractState state = batch.get(committed);
+            final Precision precision = batchPrecisions.get(committed);
+            stats.countIterations++;
+            // the states of the batch that are not yet committed count as waiting
+            stats.countWaitlistSize +=
+                reachedSet.getWaitlist().size() + (batch.size() - committed);
+
+            if (!reachedSet.contains(state)) {
+              // An earlier state of this batch was merged into this state. The merge result
+              // was added to the waitlist and covers this state, so its successors are not needed.
+              futures.get(committed).cancel(true);
+              stats.countSkippedBatchStates++;
+              continue;
+            }
+
+            stats.transferTimer.start();
+            Collection<? extends AbstractState> successors;
+            try {
+              successors = commitSuccessors(state, futures.get(committed));
+            } finally {
+              stats.transferTimer.stop();
+            }
+
+            logger.log(Level.ALL, "Current state is", state, "with precision", precision);
+            if (handleSuccessors(state, precision, successors, reachedSet)) {
+              // Prec operator requested break, the remaining states of the batch
+              // need to be handled later on
+              for (int i = committed + 1; i < batch.size(); i++) {
+                futures.get(i).cancel(true);
+                reAddIfStillReached(batch.get(i), reachedSet);
+              }
+              return status;
+            }
+          }
+        } catch (CPAException | InterruptedException e) {
+          // re-add all states of the batch that were not fully handled,
+          // otherwise their successors would be forgotten (which would be unsound)
+          for (int i = committed; i < batch.size(); i++) {
+            futures.get(i).cancel(true);
+            reAddIfStillReached(batch.get(i), reachedSet);
+          }
+          throw e;
+        }
+      }
+      return status;
+
+    } finally {
+      pool.shutdownNow();
+    }
+  }
+
+  /** The part of the transfer relation that is executed by the worker threads. */
+  private Collection<? extends AbstractState> computeSuccessorsConcurrently(
+      AbstractState pState, Precision pPrecision)
+      throws CPATransferException, InterruptedException {
+    if (argTransferRelation != null) {
+      // the ARG is changed only by the committing thread
+      return argTransferRelation.getWrappedSuccessors((ARGState) pState, pPrecision);
+    }
+    return transferRelation.getAbstractSuccessors(pState, pPrecision);
+  }
+
+  /**
+   * Get the successors that a worker thread computed for the given state. For ARGCPA, this creates
+   * the ARG states for them, like its transfer relation does in the sequential mode.
+   */
+  private Collection<? extends AbstractState> commitSuccessors(
+      AbstractState pState, Future<Collection<? extends AbstractState>> pFuture)
+      throws CPAException, InterruptedException {
+    if (argTransferRelation == null) {
+      return getSuccessorsFromFuture(pFuture);
+    }
+    ARGState state = (ARGState) pState;
+    // covered elements may be in the reached set, but should always be ignored
+    if (state.isCovered()) {
+      pFuture.cancel(true);
+      return ImmutableSet.of();
+    }
+    state.markExpanded();
+    return argTransferRelation.addSuccessorsToARG(state, getSuccessorsFromFuture(pFuture));
+  }
+
+  private static Collection<? extends AbstractState> getSuccessorsFromFuture(
+      Future<Collection<? extends AbstractState>> pFuture)
+      throws CPAException, InterruptedException {
+    try {
+      return pFuture.get();
+    } catch (ExecutionException e) {
+      Throwable cause = e.getCause();
+      if (cause instanceof CPAException cpaException) {
+        throw cpaException;
+      } else if (cause instanceof InterruptedException interruptedException) {
+        throw interruptedException;
+      } else if (cause instanceof RuntimeException runtimeException) {
+        throw runtimeException;
+      } else if (cause instanceof Error error) {
+        throw error;
+      }
+      throw new CPATransferException("Unexpected exception in parallel exploration", cause);
+    }
+  }
+
+  private static void reAddIfStillReached(AbstractState pState, ReachedSet pReachedSet) {
+    if (pReachedSet.contains(pState)) {
+      pReachedSet.reAddToWaitlist(pState);
+    }
+  }
+
   /**
    * Handle one state from the waitlist, i.e., produce successors etc.
    *
@@ -338,6 +579,25 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     // TODO When we have a nice way to mark the analysis result as incomplete,
     // we could continue analysis on a CPATransferException with the next state from waitlist.
 
+    return handleSuccessors(state, precision, successors, reachedSet);
+  }
+
+  /**
+   * Commit the successors of one state to the reached set, i.e., apply precision adjustment, merge,
+   * and stop and add the remaining successors.
+   *
+   * @param state The abstract state whose successors are handled
+   * @param precision The precision for this abstract state.
+   * @param successors The successors of the abstract state as computed by the transfer relation.
+   * @param reachedSet The reached set.
+   * @return true if analysis should terminate, false if analysis should continue with next state
+   */
+  private boolean handleSuccessors(
+      final AbstractState state,
+      final Precision precision,
+      final Collection<? extends AbstractState> successors,
+      final ReachedSet reachedSet)
+      throws CPAException, InterruptedException {
     int numSuccessors = successors.size();
     logger.log(Level.FINER, "Current state has", numSuccessors, "successors");
     stats.countSuccessors += numSuccessors;
@@ -0,0 +1,146 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.Collections2;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableMultiset;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.ImmutableSortedSet;
+import java.util.Map;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.cpa.arg.ARGUtils;
+import org.sosy_lab.cpachecker.cpa.callstack.CallstackState;
+import org.sosy_lab.cpachecker.cpa.dominator.DominatorState;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.test.CPATestRunner;
+import org.sosy_lab.cpachecker.util.test.TestResults;
+
+public class CPAAlgorithmTest {
+
+  private static final String PROGRAM = "test/programs/simple/parallel_exploration.c";
+
+  private static TestResults run(int pThreads, int pBatchSize) throws Exception {
+    Map<String, String> prop =
+        ImmutableMap.of(
+            "CompositeCPA.cpas", "cpa.location.LocationCPA, cpa.callstack.CallstackCPA",
+            "specification", "config/specification/default.spc",
+            "cpa.parallelExploration.threads", Integer.toString(pThreads),
+            "cpa.parallelExploration.batchSize", Integer.toString(pBatchSize));
+    return CPATestRunner.run(prop, PROGRAM);
+  }
+
+  /** Run with ARGCPA and a CPA whose states are merged by join. */
+  private static TestResults runWithARGAndMerge(int pThreads, int pBatchSize) throws Exception {
+    Map<String, String> prop =
+        ImmutableMap.of(
+            "cpa", "cpa.arg.ARGCPA",
+            "ARGCPA.cpa", "cpa.composite.CompositeCPA",
+            "CompositeCPA.cpas",
+                "cpa.location.LocationCPA, cpa.callstack.CallstackCPA, cpa.dominator.DominatorCPA",
+            "specification", "config/specification/default.spc",
+            "cpa.parallelExploration.threads", Integer.toString(pThreads),
+            "cpa.parallelExploration.batchSize", Integer.toString(pBatchSize));
+    return CPATestRunner.run(prop, PROGRAM);
+  }
+
+  /** Project the reached states to the location and the call stack, both are order-independent. */
+  private static ImmutableMultiset<String> reachedStates(TestResults pResults) {
+    ImmutableMultiset.Builder<String> states = ImmutableMultiset.builder();
+    for (AbstractState state : pResults.getCheckerResult().getReached()) {
+      CallstackState callstack = AbstractStates.extractStateByType(state, CallstackState.class);
+      states.add(
+          AbstractStates.extractLocation(state).getNodeNumber()
+              + "@"
+              + callstack.getCurrentFunction()
+              + "/"
+              + callstack.getDepth());
+    }
+    return states.build();
+  }
+
+  /**
+   * Project the reached states to the location, the call stack, and the dominators. The dominators
+   * of a location are the same for any order of exploration.
+   */
+  private static ImmutableSet<String> reachedStatesWithDominators(TestResults pResults) {
+    ImmutableSet.Builder<String> states = ImmutableSet.builder();
+    for (AbstractState state : pResults.getCheckerResult().getReached()) {
+      CallstackState callstack = AbstractStates.extractStateByType(state, CallstackState.class);
+      DominatorState dominators = AbstractStates.extractStateByType(state, DominatorState.class);
+      states.add(
+          AbstractStates.extractLocation(state).getNodeNumber()
+              + "@"
+              + callstack.getCurrentFunction()
+              + "/"
+              + callstack.getDepth()
+              + " "
+              + ImmutableSortedSet.copyOf(
+                  Collections2.transform(dominators, CFANode::getNodeNumber)));
+    }
+    return states.build();
+  }
+
+  /** Check that parents and children in the ARG refer to each other and to reached states. */
+  private static void assertConsistentARG(TestResults pResults) {
+    ReachedSet reached = pResults.getCheckerResult().getReached();
+    assertThat(ARGUtils.checkARG(reached)).isTrue();
+    for (AbstractState state : reached) {
+      ARGState argState = (ARGState) state;
+      assertThat(argState.isDestroyed()).isFalse();
+      assertThat(argState.getChildren()).containsNoDuplicates();
+      assertThat(argState.getParents()).containsNoDuplicates();
+      for (ARGState parent : argState.getParents()) {
+        assertThat(parent.getChildren()).contains(argState);
+        assertThat(reached.contains(parent)).isTrue();
+      }
+      for (ARGState child : argState.getChildren()) {
+        assertThat(child.getParents()).contains(argState);
+        assertThat(reached.contains(child) || child.isCovered()).isTrue();
+      }
+    }
+  }
+
+  @Test
+  public void testParallelExplorationWithARGAndMergeJoin() throws Exception {
+    TestResults sequential = runWithARGAndMerge(1, 0);
+    sequential.assertIsSafe();
+    assertConsistentARG(sequential);
+    ImmutableSet<String> expected = reachedStatesWithDominators(sequential);
+    assertThat(expected).isNotEmpty();
+
+    for (int batchSize : new int[] {0, 1, 3}) {
+      TestResults parallel = runWithARGAndMerge(4, batchSize);
+      parallel.assertIsSafe();
+      assertConsistentARG(parallel);
+      assertThat(reachedStatesWithDominators(parallel)).isEqualTo(expected);
+    }
+  }
+
+  @Test
+  public void testParallelExplorationEqualsSequential() throws Exception {
+    TestResults sequential = run(1, 0);
+    sequential.assertIsSafe();
+    ImmutableMultiset<String> expected = reachedStates(sequential);
+    assertThat(expected).isNotEmpty();
+
+    for (int batchSize : new int[] {0, 1, 3}) {
+      TestResults parallel = run(4, batchSize);
+      parallel.assertIsSafe();
+      assertThat(reachedStates(parallel)).isEqualTo(expected);
+    }
+  }
+}
@@ -29,8 +29,10 @@ import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.decompositio
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.decomposition.GivenSizeDecomposer;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.decomposition.SingleBlockDecomposer;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryConnection;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryConnectionProvider;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummarySortedMessageQueue;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.memory.InMemoryBlockSummaryConnectionProvider;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket.SocketBlockSummaryConnectionProvider;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.worker.BlockSummaryActor;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.worker.BlockSummaryAnalysisOptions;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.worker.BlockSummaryObserverWorker;
@@ -85,6 +87,13 @@ public class DistributedSummaryAnalysis implements Algorithm {
               + "Workers consume resources and should not be used for benchmarks.")
   private boolean spawnUtilWorkers = true;
 
+  @Option(
+      description =
+          "How workers exchange messages. MEMORY passes messages between threads of this process."
+              + " SOCKET sends messages over TCP through a message hub (see"
+              + " distributedSummaries.socket.*), which other processes can join as well.")
+  private ConnectionType connectionType = ConnectionType.MEMORY;
+
   private enum DecompositionType {
     BLOCK_OPERATOR,
     GIVEN_SIZE,
@@ -96,6 +105,11 @@ public class DistributedSummaryAnalysis implements Algorithm {
     SMART
   }
 
+  private enum ConnectionType {
+    MEMORY,
+    SOCKET
+  }
+
   public DistributedSummaryAnalysis(
       Configuration pConfig,
       LogManager pLogger,
@@ -134,10 +148,20 @@ public class DistributedSummaryAnalysis implements Algorithm {
     };
   }
 
+  private BlockSummaryConnectionProvider<?> getConnectionProvider()
+      throws InvalidConfigurationException {
+    return switch (connectionType) {
+      case MEMORY ->
+          new InMemoryBlockSummaryConnectionProvider(BlockSummarySortedMessageQueue::new);
+      case SOCKET -> new SocketBlockSummaryConnectionProvider(configuration, logger);
+      default -> throw new AssertionError("Unknown ConnectionType: " + connectionType);
+    };
+  }
+
   @Override
   public AlgorithmStatus run(ReachedSet reachedSet) throws CPAException, InterruptedException {
     logger.log(Level.INFO, "Starting block analysis...");
-    try {
+    try (BlockSummaryConnectionProvider<?> connectionProvider = getConnectionProvider()) {
       // create blockGraph and reduce to relevant parts
       CFADecomposer decomposer = getDecomposer();
       BlockGraph blockGraph = decomposer.cut(cfa);
@@ -151,11 +175,7 @@ public class DistributedSummaryAnalysis implements Algorithm {
       Collection<BlockNode> blocks = blockGraph.getDistinctNodes();
       BlockSummaryWorkerBuilder builder =
           new BlockSummaryWorkerBuilder(
-              cfa,
-              new InMemoryBlockSummaryConnectionProvider(BlockSummarySortedMessageQueue::new),
-              specification,
-              configuration,
-              shutdownManager);
+              cfa, connectionProvider, specification, configuration, shutdownManager);
       builder = builder.createAdditionalConnections(1);
       for (BlockNode distinctNode : blocks) {
         if (distinctNode.isRoot()) {
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.distributed_cpa.predicate;
 
 import java.io.IOException;
+import java.nio.ByteBuffer;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.distributed_cpa.operators.SerializeOperator;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryMessagePayload;
@@ -55,11 +56,11 @@ public class SerializePredicateStateOperator implements SerializeOperator {
     }
     String formula = formulaManagerView.dumpFormula(pathFormula.getFormula()).toString();
     SerializationInfoStorage.storeSerializationInformation(predicateCPA, cfa);
-    String ssa;
-    String pts;
+    ByteBuffer ssa;
+    ByteBuffer pts;
     try {
-      ssa = SerializeUtil.serialize(pathFormula.getSsa());
-      pts = SerializeUtil.serialize(state.getPathFormula().getPointerTargetSet());
+      ssa = SerializeUtil.serializeToBuffer(pathFormula.getSsa());
+      pts = SerializeUtil.serializeToBuffer(state.getPathFormula().getPointerTargetSet());
     } catch (IOException e) {
       throw new AssertionError("Unable to serialize SSAMap " + pathFormula.getSsa());
     } finally {
@@ -9,9 +9,11 @@
 package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange;
 
 import com.google.common.collect.ImmutableList;
+import java.io.Closeable;
 import java.io.IOException;
 
-public interface BlockSummaryConnectionProvider<T extends BlockSummaryConnection> {
+public interface BlockSummaryConnectionProvider<T extends BlockSummaryConnection>
+    extends Closeable {
 
   /**
    * Creates multiple distinct {@link BlockSummaryConnection Connections}.
@@ -21,4 +23,11 @@ public interface BlockSummaryConnectionProvider<T extends BlockSummaryConnection
    * @throws IOException if an IOException occurs during Connection creation
    */
   ImmutableList<T> createConnections(int connections) throws IOException;
+
+  /**
+   * Release resources shared by all connections of this provider. Connections created by this
+   * provider may stop working afterwards.
+   */
+  @Override
+  default void close() throws IOException {}
 }
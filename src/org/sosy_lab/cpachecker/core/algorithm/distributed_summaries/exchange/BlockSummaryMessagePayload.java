@@ -14,8 +14,10 @@ import com.fasterxml.jackson.databind.type.MapType;
 import com.fasterxml.jackson.databind.type.TypeFactory;
 import com.google.common.collect.ForwardingMap;
 import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.Maps;
 import com.google.errorprone.annotations.CanIgnoreReturnValue;
 import java.io.IOException;
+import java.nio.ByteBuffer;
 import java.util.HashMap;
 import java.util.Map;
 import org.sosy_lab.common.JSON;
@@ -53,9 +55,13 @@ public class BlockSummaryMessagePayload extends ForwardingMap<String, Object> {
     return new BlockSummaryMessagePayload(ImmutableMap.of());
   }
 
+  /** Binary entries are written as Base64 strings, as JSON does not support raw bytes. */
   public String toJSONString() throws IOException {
     StringBuilder builder = new StringBuilder();
-    JSON.writeJSONString(delegate, builder);
+    JSON.writeJSONString(
+        Maps.transformValues(
+            delegate, v -> v instanceof ByteBuffer buffer ? SerializeUtil.toBase64(buffer) : v),
+        builder);
     return builder.toString();
   }
 
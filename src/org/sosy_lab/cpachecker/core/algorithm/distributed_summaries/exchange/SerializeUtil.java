@@ -8,12 +8,16 @@
 
 package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange;
 
+import static java.nio.charset.StandardCharsets.US_ASCII;
+
 import java.io.ByteArrayInputStream;
 import java.io.ByteArrayOutputStream;
 import java.io.IOException;
+import java.io.InputStream;
 import java.io.ObjectInputStream;
 import java.io.ObjectOutputStream;
 import java.io.Serializable;
+import java.nio.ByteBuffer;
 import java.util.Base64;
 
 public final class SerializeUtil {
@@ -21,22 +25,84 @@ public final class SerializeUtil {
   private SerializeUtil() {}
 
   public static <T extends Serializable> String serialize(T pObject) throws IOException {
+    return Base64.getEncoder().encodeToString(serializeToBytes(pObject));
+  }
+
+  /**
+   * Serialize the given object into a read-only buffer. In contrast to {@link
+   * #serialize(Serializable)}, this avoids the Base64 encoding, and the buffer can be shared
+   * between several messages and threads without copying.
+   */
+  public static <T extends Serializable> ByteBuffer serializeToBuffer(T pObject)
+      throws IOException {
+    return ByteBuffer.wrap(serializeToBytes(pObject)).asReadOnlyBuffer();
+  }
+
+  private static <T extends Serializable> byte[] serializeToBytes(T pObject) throws IOException {
     try (ByteArrayOutputStream bos = new ByteArrayOutputStream();
         ObjectOutputStream out = new ObjectOutputStream(bos)) {
       out.writeObject(pObject);
       out.flush();
-      return Base64.getEncoder().encodeToString(bos.toByteArray());
+      return bos.toByteArray();
     }
   }
 
   public static <T extends Serializable> T deserialize(String pSerialize, Class<T> pClass) {
-    try (ByteArrayInputStream bis =
-            new ByteArrayInputStream(Base64.getDecoder().decode(pSerialize));
-        ObjectInputStream in = new ObjectInputStream(bis)) {
+    return deserialize(new ByteArrayInputStream(Base64.getDecoder().decode(pSerialize)), pClass);
+  }
+
+  /**
+   * Deserialize an object from the remaining content of the given buffer. The position of the
+   * buffer is not changed.
+   */
+  public static <T extends Serializable> T deserialize(ByteBuffer pBuffer, Class<T> pClass) {
+    return deserialize(new ByteBufferInputStream(pBuffer.duplicate()), pClass);
+  }
+
+  private static <T extends Serializable> T deserialize(InputStream pStream, Class<T> pClass) {
+    try (ObjectInputStream in = new ObjectInputStream(pStream)) {
       return pClass.cast(in.readObject());
     } catch (IOException | ClassNotFoundException e) {
       // in no scenario deserializing a message should cause exceptions
       throw new AssertionError(e);
     }
   }
+
+  /** Encode the remaining content of the buffer with Base64 (e.g., for JSON output). */
+  public static String toBase64(ByteBuffer pBuffer) {
+    return new String(Base64.getEncoder().encode(pBuffer.duplicate()).array(), US_ASCII);
+  }
+
+  /** Read from a buffer without copying its content into an array first. */
+  private static final class ByteBufferInputStream extends InputStream {
+
+    private final ByteBuffer buffer;
+
+    private ByteBufferInputStream(ByteBuffer pBuffer) {
+      buffer = pBuffer;
+    }
+
+    @Override
+    public int read() {
+      return buffer.hasRemaining() ? (buffer.get() & 0xFF) : -1;
+    }
+
+    @Override
+    public int read(byte[] pBytes, int pOffset, int pLength) {
+      if (pLength == 0) {
+        return 0;
+      }
+      if (!buffer.hasRemaining()) {
+        return -1;
+      }
+      int length = Math.min(pLength, buffer.remaining());
+      buffer.get(pBytes, pOffset, length);
+      return length;
+    }
+
+    @Override
+    public int available() {
+      return buffer.remaining();
+    }
+  }
 }
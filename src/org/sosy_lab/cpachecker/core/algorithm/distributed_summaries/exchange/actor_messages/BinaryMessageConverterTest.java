@@ -0,0 +1,84 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages;
+
+import static com.google.common.truth.Truth.assert_;
+
+import com.google.common.collect.ImmutableSet;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryMessagePayload;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.SerializeUtil;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage.BinaryMessageConverter;
+
+public class BinaryMessageConverterTest {
+
+  private final BinaryMessageConverter converter = new BinaryMessageConverter();
+
+  @Test
+  public void testRoundTripPostCondition() throws IOException {
+    ByteBuffer serialized = SerializeUtil.serializeToBuffer("x@1");
+    BlockSummaryMessagePayload payload =
+        new BlockSummaryMessagePayload.Builder()
+            .addEntry("formula", "(= x@1 0)")
+            .addEntry("binary", serialized)
+            .buildPayload();
+    BlockSummaryMessage message =
+        BlockSummaryMessage.newBlockPostCondition(
+            "B1", 42, payload, true, false, ImmutableSet.of("B0", "B1"));
+
+    BlockSummaryMessage decoded = converter.bufferToMessage(converter.messageToBuffer(message));
+
+    assert_().that(decoded).isEqualTo(message);
+    assert_().that(decoded).isInstanceOf(BlockSummaryPostConditionMessage.class);
+    assert_().that(decoded.getTimestamp()).isEqualTo(message.getTimestamp());
+    BlockSummaryPostConditionMessage postCondition = (BlockSummaryPostConditionMessage) decoded;
+    assert_().that(postCondition.representsFullPath()).isTrue();
+    assert_().that(postCondition.isReachable()).isFalse();
+    Object binary = decoded.getPayload().get("binary");
+    assert_().that(binary).isInstanceOf(ByteBuffer.class);
+    assert_().that(SerializeUtil.deserialize((ByteBuffer) binary, String.class)).isEqualTo("x@1");
+  }
+
+  @Test
+  public void testRoundTripVisited() throws IOException {
+    BlockSummaryMessage message =
+        BlockSummaryMessage.newResultMessage("B2", 7, Result.TRUE, ImmutableSet.of("B0", "B2"));
+
+    BlockSummaryMessage decoded = converter.jsonToMessage(converter.messageToJson(message));
+
+    assert_().that(decoded).isInstanceOf(BlockSummaryResultMessage.class);
+    assert_().that(decoded.getUniqueBlockId()).isEqualTo("B2");
+    assert_().that(decoded.getTargetNodeNumber()).isEqualTo(7);
+    assert_().that(decoded.extractVisited()).containsExactly("B0", "B2");
+  }
+
+  @Test
+  public void testStringsAreInterned() {
+    String formula = "(and (= x@1 0) (= y@1 x@1))".repeat(10);
+    BlockSummaryMessagePayload payload =
+        new BlockSummaryMessagePayload.Builder()
+            .addEntry("a", formula)
+            .addEntry("b", formula)
+            .buildPayload();
+    BlockSummaryMessage message =
+        BlockSummaryMessage.newErrorConditionMessage("B3", 1, payload, false, ImmutableSet.of());
+
+    assert_().that(converter.messageToBuffer(message).remaining()).isLessThan(2 * formula.length());
+  }
+
+  @Test(expected = IOException.class)
+  public void testTruncatedMessage() throws IOException {
+    BlockSummaryMessage message = BlockSummaryMessage.newErrorConditionUnreachableMessage("B4", "");
+    ByteBuffer buffer = converter.messageToBuffer(message);
+    converter.bufferToMessage(buffer.limit(buffer.limit() - 1));
+  }
+}
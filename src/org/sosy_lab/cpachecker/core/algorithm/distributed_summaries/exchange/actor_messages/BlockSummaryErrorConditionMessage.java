@@ -9,10 +9,8 @@
 package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages;
 
 import java.time.Instant;
-import java.util.Objects;
 import java.util.Set;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryMessagePayload;
-import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.SerializeUtil;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSet;
 
@@ -32,21 +30,13 @@ public class BlockSummaryErrorConditionMessage extends BlockSummaryMessage {
   }
 
   public SSAMap getSSAMap() {
-    if (getPayload().containsKey(BlockSummaryMessagePayload.SSA)) {
-      return SerializeUtil.deserialize(
-          (String) Objects.requireNonNull(getPayload().get(BlockSummaryMessagePayload.SSA)),
-          SSAMap.class);
-    }
-    return SSAMap.emptySSAMap();
+    return extractSerialized(BlockSummaryMessagePayload.SSA, SSAMap.class)
+        .orElse(SSAMap.emptySSAMap());
   }
 
   public PointerTargetSet getPointerTargetSet() {
-    if (getPayload().containsKey(BlockSummaryMessagePayload.PTS)) {
-      return SerializeUtil.deserialize(
-          (String) Objects.requireNonNull(getPayload().get(BlockSummaryMessagePayload.PTS)),
-          PointerTargetSet.class);
-    }
-    return PointerTargetSet.emptyPointerTargetSet();
+    return extractSerialized(BlockSummaryMessagePayload.PTS, PointerTargetSet.class)
+        .orElse(PointerTargetSet.emptyPointerTargetSet());
   }
 
   public Set<String> visitedBlockIds() {
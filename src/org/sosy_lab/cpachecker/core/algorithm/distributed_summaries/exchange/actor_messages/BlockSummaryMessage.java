@@ -8,6 +8,8 @@
 
 package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages;
 
+import static java.nio.charset.StandardCharsets.UTF_8;
+
 import com.fasterxml.jackson.core.JsonGenerator;
 import com.fasterxml.jackson.core.JsonParser;
 import com.fasterxml.jackson.core.ObjectCodec;
@@ -22,12 +24,22 @@ import com.fasterxml.jackson.databind.ser.std.StdSerializer;
 import com.google.common.base.Joiner;
 import com.google.common.base.MoreObjects;
 import com.google.common.base.Throwables;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.io.ByteArrayDataOutput;
+import com.google.common.io.ByteStreams;
 import java.io.ByteArrayInputStream;
 import java.io.ByteArrayOutputStream;
 import java.io.IOException;
+import java.io.Serializable;
+import java.nio.BufferUnderflowException;
+import java.nio.ByteBuffer;
+import java.time.DateTimeException;
 import java.time.Instant;
+import java.util.ArrayList;
 import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
 import java.util.Map;
 import java.util.Objects;
 import java.util.Optional;
@@ -37,6 +49,7 @@ import java.util.zip.GZIPOutputStream;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.algorithm.Algorithm.AlgorithmStatus;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryMessagePayload;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.SerializeUtil;
 import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.worker.BlockSummaryObserverWorker.StatusObserver;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 
@@ -229,6 +242,27 @@ public abstract class BlockSummaryMessage implements Comparable<BlockSummaryMess
         Instant.now());
   }
 
+  private static BlockSummaryMessage createMessage(
+      MessageType pType,
+      String pUniqueBlockId,
+      int pNodeNumber,
+      BlockSummaryMessagePayload pPayload,
+      Instant pTimestamp) {
+    return switch (pType) {
+      case FOUND_RESULT ->
+          new BlockSummaryResultMessage(pUniqueBlockId, pNodeNumber, pPayload, pTimestamp);
+      case ERROR -> new BlockSummaryErrorMessage(pUniqueBlockId, pNodeNumber, pPayload, pTimestamp);
+      case ERROR_CONDITION_UNREACHABLE ->
+          new BlockSummaryErrorConditionUnreachableMessage(
+              pUniqueBlockId, pNodeNumber, pPayload, pTimestamp);
+      case ERROR_CONDITION ->
+          new BlockSummaryErrorConditionMessage(pUniqueBlockId, pNodeNumber, pPayload, pTimestamp);
+      case BLOCK_POSTCONDITION ->
+          new BlockSummaryPostConditionMessage(pUniqueBlockId, pNodeNumber, pPayload, pTimestamp);
+      default -> throw new AssertionError("Unknown MessageType " + pType);
+    };
+  }
+
   public String getBlockId() {
     return uniqueBlockId;
   }
@@ -254,6 +288,22 @@ public abstract class BlockSummaryMessage implements Comparable<BlockSummaryMess
     return Boolean.parseBoolean(getPayload().getOrDefault(key, defaultValue).toString());
   }
 
+  /**
+   * Deserialize the entry stored for {@code key}. The entry is either a buffer (messages that were
+   * created locally or received in the binary format) or a Base64 string (messages received as
+   * JSON).
+   */
+  protected <T extends Serializable> Optional<T> extractSerialized(String key, Class<T> pClass) {
+    Object value = getPayload().get(key);
+    if (value == null) {
+      return Optional.empty();
+    }
+    if (value instanceof ByteBuffer buffer) {
+      return Optional.of(SerializeUtil.deserialize(buffer, pClass));
+    }
+    return Optional.of(SerializeUtil.deserialize(value.toString(), pClass));
+  }
+
   public int getTargetNodeNumber() {
     return targetNodeNumber;
   }
@@ -392,6 +442,155 @@ public abstract class BlockSummaryMessage implements Comparable<BlockSummaryMess
     }
   }
 
+  /**
+   * Converts messages into a compact binary format instead of JSON. All strings of a message (block
+   * ids, payload keys, serialized formulas, visited block ids, ...) are stored once in a string
+   * table at the beginning of the message and referenced by their index afterwards. Binary payload
+   * entries ({@link ByteBuffer}s, e.g., serialized {@link
+   * org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap}s) are written as length-prefixed
+   * raw bytes without Base64 encoding. When reading a message, such entries are not copied but
+   * returned as read-only views on the given buffer.
+   *
+   * <p>Layout (big endian): version, message type, target node, timestamp, string table, block id,
+   * payload entries (key, kind, value).
+   */
+  public static class BinaryMessageConverter extends MessageConverter {
+
+    private static final byte VERSION = 1;
+
+    private static final byte KIND_STRING = 0;
+    private static final byte KIND_STRINGS = 1;
+    private static final byte KIND_BYTES = 2;
+
+    private static final MessageType[] TYPES = MessageType.values();
+
+    @Override
+    public byte[] messageToJson(BlockSummaryMessage pMessage) throws IOException {
+      ByteBuffer buffer = messageToBuffer(pMessage);
+      byte[] bytes = new byte[buffer.remaining()];
+      buffer.get(bytes);
+      return bytes;
+    }
+
+    @Override
+    public BlockSummaryMessage jsonToMessage(byte[] pBytes) throws IOException {
+      return bufferToMessage(ByteBuffer.wrap(pBytes));
+    }
+
+    /** Encode the message. The returned buffer is ready to be read (position 0). */
+    public ByteBuffer messageToBuffer(BlockSummaryMessage pMessage) {
+      Map<String, Integer> strings = new LinkedHashMap<>();
+      ByteArrayDataOutput body = ByteStreams.newDataOutput();
+      body.writeInt(intern(strings, pMessage.getUniqueBlockId()));
+      BlockSummaryMessagePayload payload = pMessage.getPayload();
+      body.writeInt(payload.size());
+      for (Map.Entry<String, Object> entry : payload.entrySet()) {
+        body.writeInt(intern(strings, entry.getKey()));
+        Object value = entry.getValue();
+        if (value instanceof ByteBuffer buffer) {
+          byte[] content = new byte[buffer.remaining()];
+          buffer.duplicate().get(content);
+          body.writeByte(KIND_BYTES);
+          body.writeInt(content.length);
+          body.write(content);
+        } else if (value instanceof Iterable<?> iterable) {
+          List<Integer> indices = new ArrayList<>();
+          for (Object element : iterable) {
+            indices.add(intern(strings, element.toString()));
+          }
+          body.writeByte(KIND_STRINGS);
+          body.writeInt(indices.size());
+          for (int index : indices) {
+            body.writeInt(index);
+          }
+        } else {
+          body.writeByte(KIND_STRING);
+          body.writeInt(intern(strings, value.toString()));
+        }
+      }
+
+      ByteArrayDataOutput header = ByteStreams.newDataOutput();
+      header.writeByte(VERSION);
+      header.writeByte(pMessage.getType().ordinal());
+      header.writeInt(pMessage.getTargetNodeNumber());
+      header.writeLong(pMessage.getTimestamp().getEpochSecond());
+      header.writeInt(pMessage.getTimestamp().getNano());
+      header.writeInt(strings.size());
+      for (String string : strings.keySet()) {
+        byte[] encoded = string.getBytes(UTF_8);
+        header.writeInt(encoded.length);
+        header.write(encoded);
+      }
+      byte[] head = header.toByteArray();
+      byte[] tail = body.toByteArray();
+      return ByteBuffer.allocate(head.length + tail.length).put(head).put(tail).flip();
+    }
+
+    /**
+     * Decode a message from the remaining bytes of the buffer. Binary payload entries of the
+     * returned message share their content with {@code pBuffer}, so the buffer must not be
+     * modified afterwards.
+     */
+    public BlockSummaryMessage bufferToMessage(ByteBuffer pBuffer) throws IOException {
+      ByteBuffer buffer = pBuffer.asReadOnlyBuffer();
+      try {
+        byte version = buffer.get();
+        if (version != VERSION) {
+          throw new IOException("Unsupported message format version " + version);
+        }
+        MessageType type = TYPES[buffer.get()];
+        int nodeNumber = buffer.getInt();
+        Instant timestamp = Instant.ofEpochSecond(buffer.getLong(), buffer.getInt());
+        String[] strings = new String[checkLength(buffer, buffer.getInt())];
+        for (int i = 0; i < strings.length; i++) {
+          byte[] encoded = new byte[checkLength(buffer, buffer.getInt())];
+          buffer.get(encoded);
+          strings[i] = new String(encoded, UTF_8);
+        }
+        String uniqueBlockId = strings[buffer.getInt()];
+        int size = buffer.getInt();
+        BlockSummaryMessagePayload.Builder payload = new BlockSummaryMessagePayload.Builder();
+        for (int i = 0; i < size; i++) {
+          String key = strings[buffer.getInt()];
+          byte kind = buffer.get();
+          switch (kind) {
+            case KIND_STRING -> payload.addEntry(key, strings[buffer.getInt()]);
+            case KIND_STRINGS -> {
+              ImmutableList.Builder<String> elements = ImmutableList.builder();
+              int count = checkLength(buffer, buffer.getInt());
+              for (int j = 0; j < count; j++) {
+                elements.add(strings[buffer.getInt()]);
+              }
+              payload.addEntry(key, elements.build());
+            }
+            case KIND_BYTES -> {
+              int length = checkLength(buffer, buffer.getInt());
+              ByteBuffer content = buffer.slice(buffer.position(), length);
+              buffer.position(buffer.position() + length);
+              payload.addEntry(key, content);
+            }
+            default -> throw new IOException("Unknown payload entry kind " + kind);
+          }
+        }
+        return createMessage(type, uniqueBlockId, nodeNumber, payload.buildPayload(), timestamp);
+      } catch (BufferUnderflowException | IndexOutOfBoundsException | DateTimeException e) {
+        throw new IOException("Malformed binary message", e);
+      }
+    }
+
+    /** Reject negative lengths and lengths that cannot fit into the rest of the message. */
+    private static int checkLength(ByteBuffer pBuffer, int pLength) throws IOException {
+      if (pLength < 0 || pLength > pBuffer.remaining()) {
+        throw new IOException("Malformed binary message: invalid length " + pLength);
+      }
+      return pLength;
+    }
+
+    private static int intern(Map<String, Integer> pStrings, String pString) {
+      return pStrings.computeIfAbsent(pString, k -> pStrings.size());
+    }
+  }
+
   private static class MessageDeserializer extends StdDeserializer<BlockSummaryMessage> {
 
     private static final long serialVersionUID = 196344175L;
@@ -415,19 +614,7 @@ public abstract class BlockSummaryMessage implements Comparable<BlockSummaryMess
               .buildPayload();
       Instant timestamp = Instant.parse(node.get("timestamp").asText());
 
-      return switch (type) {
-        case FOUND_RESULT ->
-            new BlockSummaryResultMessage(uniqueBlockId, nodeNumber, payload, timestamp);
-        case ERROR -> new BlockSummaryErrorMessage(uniqueBlockId, nodeNumber, payload, timestamp);
-        case ERROR_CONDITION_UNREACHABLE ->
-            new BlockSummaryErrorConditionUnreachableMessage(
-                uniqueBlockId, nodeNumber, payload, timestamp);
-        case ERROR_CONDITION ->
-            new BlockSummaryErrorConditionMessage(uniqueBlockId, nodeNumber, payload, timestamp);
-        case BLOCK_POSTCONDITION ->
-            new BlockSummaryPostConditionMessage(uniqueBlockId, nodeNumber, payload, timestamp);
-        default -> throw new AssertionError("Unknown MessageType " + type);
-      };
+      return createMessage(type, uniqueBlockId, nodeNumber, payload, timestamp);
     }
   }
 
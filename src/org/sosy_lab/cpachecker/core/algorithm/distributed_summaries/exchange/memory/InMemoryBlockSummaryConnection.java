@@ -18,6 +18,10 @@ import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.act
 /**
  * The {@link InMemoryBlockSummaryConnection} provides a queue for incoming messages and knows about
  * all outgoing connections (that are the queues for incoming messages of other workers).
+ *
+ * <p>Messages are handed over by reference. Binary payload entries (serialized {@link
+ * java.nio.ByteBuffer}s) are shared between all receivers without copying or Base64 encoding, which
+ * is safe because messages are immutable and readers only operate on duplicates of the buffers.
  */
 public class InMemoryBlockSummaryConnection implements BlockSummaryConnection {
 
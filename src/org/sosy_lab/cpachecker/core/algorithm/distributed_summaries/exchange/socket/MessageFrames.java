@@ -0,0 +1,111 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
+
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.EOFException;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.TimeUnit;
+import java.util.function.BooleanSupplier;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Wire format shared by {@link SocketBlockSummaryConnection} and {@link SocketBlockSummaryHub}.
+ * Every message is sent as one frame: the length of the encoded message (4 bytes) followed by the
+ * message in the format of {@link
+ * org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage.BinaryMessageConverter}.
+ */
+final class MessageFrames {
+
+  /** Marks the end of an outgoing queue. Compared by identity. */
+  static final ByteBuffer END_OF_STREAM = ByteBuffer.allocate(0);
+
+  /** Sent by the hub once a new connection is registered and will receive all broadcasts. */
+  static final int HANDSHAKE = 0x42534d31;
+
+  private static final long OFFER_TIMEOUT_MS = 100;
+
+  private MessageFrames() {}
+
+  /**
+   * Read the next frame.
+   *
+   * @return the content of the frame, or null if the stream ended regularly before the frame
+   */
+  static @Nullable ByteBuffer readFrame(DataInputStream pInput) throws IOException {
+    int length;
+    try {
+      length = pInput.readInt();
+    } catch (EOFException e) {
+      return null;
+    }
+    if (length < 0) {
+      throw new IOException("Invalid frame length " + length);
+    }
+    byte[] content = new byte[length];
+    pInput.readFully(content);
+    return ByteBuffer.wrap(content);
+  }
+
+  static void writeFrame(DataOutputStream pOutput, ByteBuffer pFrame) throws IOException {
+    pOutput.writeInt(pFrame.remaining());
+    if (pFrame.hasArray()) {
+      pOutput.write(pFrame.array(), pFrame.arrayOffset() + pFrame.position(), pFrame.remaining());
+    } else {
+      byte[] content = new byte[pFrame.remaining()];
+      pFrame.duplicate().get(content);
+      pOutput.write(content);
+    }
+  }
+
+  /**
+   * Wait for the next frames of the queue and write them with a single flush. At most {@code
+   * pBatchSize} frames are written at once.
+   *
+   * @return false if {@link #END_OF_STREAM} was reached, true otherwise
+   */
+  static boolean writeBatch(
+      BlockingQueue<ByteBuffer> pQueue, DataOutputStream pOutput, int pBatchSize)
+      throws IOException, InterruptedException {
+    List<ByteBuffer> batch = new ArrayList<>(pBatchSize);
+    batch.add(pQueue.take());
+    pQueue.drainTo(batch, pBatchSize - 1);
+    for (ByteBuffer frame : batch) {
+      if (frame == END_OF_STREAM) {
+        pOutput.flush();
+        return false;
+      }
+      writeFrame(pOutput, frame);
+    }
+    pOutput.flush();
+    return true;
+  }
+
+  /**
+   * Put the frame into the bounded queue, waiting while the queue is full. Gives up if {@code
+   * pAbandoned} signals that nobody will consume the queue anymore.
+   *
+   * @return true iff the frame was added
+   */
+  static boolean put(
+      BlockingQueue<ByteBuffer> pQueue, ByteBuffer pFrame, BooleanSupplier pAbandoned)
+      throws InterruptedException {
+    while (!pQueue.offer(pFrame, OFFER_TIMEOUT_MS, TimeUnit.MILLISECONDS)) {
+      if (pAbandoned.getAsBoolean()) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
@@ -0,0 +1,181 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.net.InetSocketAddress;
+import java.net.Socket;
+import java.nio.ByteBuffer;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryConnection;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummarySortedMessageQueue;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage.BinaryMessageConverter;
+
+/**
+ * Connection to a {@link SocketBlockSummaryHub} over TCP. The hub may run in a different process
+ * or on a different machine, so actors using this connection do not have to share a heap.
+ *
+ * <p>Messages are encoded in the calling thread and sent by a background thread, which writes all
+ * messages that are pending at that point (at most {@code batchSize}) with a single flush. This
+ * batches the bursts of {@link
+ * org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryPostConditionMessage}s
+ * that an analysis round produces. At most {@code queueSize} messages are buffered, after that
+ * {@link #write(BlockSummaryMessage)} blocks until the hub accepts more messages (backpressure).
+ *
+ * <p>Incoming messages are read by another background thread, so the hub can always deliver
+ * messages and writing never waits for the actor to read. If the connection fails, an {@link
+ * org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryErrorMessage}
+ * is delivered to the actor and later messages are discarded.
+ */
+public class SocketBlockSummaryConnection implements BlockSummaryConnection {
+
+  private final Socket socket;
+  private final DataInputStream input;
+  private final DataOutputStream output;
+  private final BinaryMessageConverter converter = new BinaryMessageConverter();
+  private final BlockingQueue<BlockSummaryMessage> in;
+  private final BlockingQueue<ByteBuffer> out;
+  private final int batchSize;
+  private final Thread writer;
+  private volatile boolean closed;
+  private volatile boolean failed;
+
+  private SocketBlockSummaryConnection(Socket pSocket, int pQueueSize, int pBatchSize)
+      throws IOException {
+    socket = pSocket;
+    input = new DataInputStream(new BufferedInputStream(socket.getInputStream()));
+    output = new DataOutputStream(new BufferedOutputStream(socket.getOutputStream()));
+    in = new BlockSummarySortedMessageQueue();
+    out = new ArrayBlockingQueue<>(pQueueSize);
+    batchSize = pBatchSize;
+    writer = new Thread(this::writeOutgoing, "BlockSummaryConnection-write-" + getId());
+    writer.setDaemon(true);
+  }
+
+  /**
+   * Connect to the hub at the given address. Returns as soon as the hub has registered the
+   * connection, i.e., all messages broadcast afterwards will be received.
+   *
+   * @param pHub address of a running {@link SocketBlockSummaryHub}
+   * @param pQueueSize maximal number of outgoing messages that are buffered
+   * @param pBatchSize maximal number of messages written with a single flush
+   */
+  public static SocketBlockSummaryConnection connect(
+      InetSocketAddress pHub, int pQueueSize, int pBatchSize) throws IOException {
+    Socket socket = new Socket();
+    try {
+      socket.setTcpNoDelay(true);
+      socket.connect(pHub);
+      SocketBlockSummaryConnection connection =
+          new SocketBlockSummaryConnection(socket, pQueueSize, pBatchSize);
+      if (connection.input.readInt() != MessageFrames.HANDSHAKE) {
+        throw new IOException("Unexpected answer from message hub at " + pHub);
+      }
+      Thread reader =
+          new Thread(connection::readIncoming, "BlockSummaryConnection-read-" + connection.getId());
+      reader.setDaemon(true);
+      reader.start();
+      connection.writer.start();
+      return connection;
+    } catch (IOException e) {
+      socket.close();
+      throw e;
+    }
+  }
+
+  private String getId() {
+    return "socket-" + socket.getLocalPort();
+  }
+
+  private void readIncoming() {
+    try {
+      ByteBuffer frame;
+      while ((frame = MessageFrames.readFrame(input)) != null) {
+        in.add(converter.bufferToMessage(frame));
+      }
+      if (!closed) {
+        fail(new IOException("Message hub closed the connection"));
+      }
+    } catch (IOException e) {
+      if (!closed) {
+        fail(e);
+      }
+    }
+  }
+
+  private void writeOutgoing() {
+    try {
+      while (MessageFrames.writeBatch(out, output, batchSize)) {
+        // continue until the connection is closed
+      }
+      socket.shutdownOutput();
+    } catch (IOException e) {
+      if (!closed) {
+        fail(e);
+      }
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+    }
+  }
+
+  private void fail(IOException pException) {
+    if (!failed) {
+      failed = true;
+      in.add(BlockSummaryMessage.newErrorMessage(getId(), pException));
+    }
+  }
+
+  @Override
+  public BlockSummaryMessage read() throws InterruptedException {
+    if (closed) {
+      throw new IllegalStateException(
+          "Cannot read from an already closed " + SocketBlockSummaryConnection.class);
+    }
+    return in.take();
+  }
+
+  @Override
+  public boolean hasPendingMessages() {
+    return !in.isEmpty();
+  }
+
+  @Override
+  public void write(BlockSummaryMessage message) throws InterruptedException {
+    if (closed) {
+      throw new IllegalStateException(
+          "Cannot write to an already closed " + SocketBlockSummaryConnection.class);
+    }
+    MessageFrames.put(out, converter.messageToBuffer(message), () -> failed);
+  }
+
+  /** Sends all pending messages and closes the connection afterwards. */
+  @Override
+  public void close() throws IOException {
+    if (closed) {
+      return;
+    }
+    closed = true;
+    try {
+      if (MessageFrames.put(out, MessageFrames.END_OF_STREAM, () -> failed)) {
+        writer.join();
+      }
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+    } finally {
+      socket.close();
+      in.clear();
+    }
+  }
+}
@@ -0,0 +1,84 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
+
+import com.google.common.collect.ImmutableList;
+import java.io.IOException;
+import java.net.InetSocketAddress;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryConnectionProvider;
+
+/**
+ * Creates {@link SocketBlockSummaryConnection}s to a {@link SocketBlockSummaryHub} that is started
+ * by this provider. Further actors, e.g., in other processes, can join by connecting to the address
+ * of the hub that is logged on startup.
+ */
+@Options(prefix = "distributedSummaries.socket")
+public class SocketBlockSummaryConnectionProvider
+    implements BlockSummaryConnectionProvider<SocketBlockSummaryConnection> {
+
+  @Option(description = "host name or address the message hub listens on")
+  private String host = "localhost";
+
+  @Option(description = "port the message hub listens on, 0 chooses a free port")
+  @IntegerOption(min = 0, max = 65535)
+  private int port = 0;
+
+  @Option(
+      description =
+          "maximal number of messages buffered for each connection before writing blocks until"
+              + " the receivers caught up")
+  @IntegerOption(min = 1)
+  private int queueSize = 1024;
+
+  @Option(description = "maximal number of messages sent at once over a connection")
+  @IntegerOption(min = 1)
+  private int batchSize = 64;
+
+  private final LogManager logger;
+  private @Nullable SocketBlockSummaryHub hub;
+
+  public SocketBlockSummaryConnectionProvider(Configuration pConfig, LogManager pLogger)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+  }
+
+  @Override
+  public synchronized ImmutableList<SocketBlockSummaryConnection> createConnections(
+      int connections) throws IOException {
+    if (hub == null) {
+      hub =
+          new SocketBlockSummaryHub(
+              logger, new InetSocketAddress(host, port), queueSize, batchSize);
+      logger.log(Level.INFO, "Message hub for block summaries listens on", hub.getAddress());
+    }
+    ImmutableList.Builder<SocketBlockSummaryConnection> result = ImmutableList.builder();
+    for (int i = 0; i < connections; i++) {
+      result.add(SocketBlockSummaryConnection.connect(hub.getAddress(), queueSize, batchSize));
+    }
+    return result.build();
+  }
+
+  /** Stops the hub, which also terminates all connections that are still open. */
+  @Override
+  public synchronized void close() throws IOException {
+    if (hub != null) {
+      hub.close();
+      hub = null;
+    }
+  }
+}
@@ -0,0 +1,63 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
+
+import static com.google.common.truth.Truth.assert_;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.BlockSummaryMessagePayload;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage;
+import org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.actor_messages.BlockSummaryMessage.MessageType;
+
+public class SocketBlockSummaryConnectionTest {
+
+  @Test(timeout = 30_000)
+  public void testBroadcastOverLocalhost() throws Exception {
+    try (SocketBlockSummaryConnectionProvider provider =
+        new SocketBlockSummaryConnectionProvider(
+            Configuration.builder().setOption("distributedSummaries.socket.queueSize", "2").build(),
+            LogManager.createTestLogManager())) {
+      ImmutableList<SocketBlockSummaryConnection> connections = provider.createConnections(3);
+
+      // more messages than the queue can hold, so the writer has to wait for the hub
+      for (int i = 0; i < 10; i++) {
+        BlockSummaryMessage message =
+            BlockSummaryMessage.newBlockPostCondition(
+                "B" + i, i, BlockSummaryMessagePayload.empty(), false, true, ImmutableSet.of());
+        connections.get(0).write(message);
+      }
+
+      for (SocketBlockSummaryConnection connection : connections) {
+        for (int i = 0; i < 10; i++) {
+          BlockSummaryMessage message = connection.read();
+          assert_().that(message.getType()).isEqualTo(MessageType.BLOCK_POSTCONDITION);
+          assert_().that(message.getUniqueBlockId()).isEqualTo("B" + i);
+        }
+      }
+      for (SocketBlockSummaryConnection connection : connections) {
+        connection.close();
+      }
+    }
+  }
+
+  @Test(timeout = 30_000)
+  public void testClosedHubIsReported() throws Exception {
+    SocketBlockSummaryConnectionProvider provider =
+        new SocketBlockSummaryConnectionProvider(
+            Configuration.defaultConfiguration(), LogManager.createTestLogManager());
+    try (SocketBlockSummaryConnection connection = provider.createConnections(1).get(0)) {
+      provider.close();
+      assert_().that(connection.read().getType()).isEqualTo(MessageType.ERROR);
+    }
+  }
+}
@@ -0,0 +1,168 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.Closeable;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.net.InetSocketAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.net.SocketException;
+import java.nio.ByteBuffer;
+import java.util.List;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.logging.Level;
+import org.sosy_lab.common.log.LogManager;
+
+/**
+ * Central broadcast point for {@link SocketBlockSummaryConnection}s. Every frame received from one
+ * connection is forwarded to all connections (including the sender) in the order it was received.
+ * Frames are forwarded without decoding them, and the same buffer is shared by all receivers.
+ *
+ * <p>Every connection has a bounded queue of outgoing frames. If a receiver cannot keep up, the
+ * hub stops reading from the senders, and TCP flow control eventually blocks their writers (see
+ * {@link SocketBlockSummaryConnection#write}).
+ *
+ * <p>Connections that register late do not receive frames that were broadcast before.
+ */
+public class SocketBlockSummaryHub implements Closeable {
+
+  private final LogManager logger;
+  private final ServerSocket server;
+  private final int queueSize;
+  private final int batchSize;
+  private final List<Peer> peers = new CopyOnWriteArrayList<>();
+  private volatile boolean closed;
+
+  /**
+   * Start a hub listening on the given address.
+   *
+   * @param pAddress the address to bind to, port 0 chooses a free port (see {@link #getAddress()})
+   * @param pQueueSize maximal number of frames buffered for each connection
+   * @param pBatchSize maximal number of frames written to a connection with a single flush
+   */
+  public SocketBlockSummaryHub(
+      LogManager pLogger, InetSocketAddress pAddress, int pQueueSize, int pBatchSize)
+      throws IOException {
+    logger = pLogger;
+    queueSize = pQueueSize;
+    batchSize = pBatchSize;
+    server = new ServerSocket();
+    server.bind(pAddress);
+    startDaemon(this::acceptConnections, "BlockSummaryHub-accept");
+  }
+
+  /** The address the hub listens on. Connect to it with {@link SocketBlockSummaryConnection}. */
+  public InetSocketAddress getAddress() {
+    return new InetSocketAddress(server.getInetAddress(), server.getLocalPort());
+  }
+
+  private void acceptConnections() {
+    while (!closed) {
+      try {
+        Socket socket = server.accept();
+        socket.setTcpNoDelay(true);
+        Peer peer = new Peer(socket);
+        peers.add(peer);
+        // the connection may only start to send after it is guaranteed to receive all broadcasts
+        peer.output.writeInt(MessageFrames.HANDSHAKE);
+        peer.output.flush();
+        startDaemon(peer::forwardIncoming, "BlockSummaryHub-read-" + socket.getPort());
+        startDaemon(peer::writeOutgoing, "BlockSummaryHub-write-" + socket.getPort());
+      } catch (IOException e) {
+        if (!closed) {
+          logger.logUserException(Level.WARNING, e, "Could not accept connection to message hub");
+        }
+      }
+    }
+  }
+
+  private static void startDaemon(Runnable pRunnable, String pName) {
+    Thread thread = new Thread(pRunnable, pName);
+    thread.setDaemon(true);
+    thread.start();
+  }
+
+  private void remove(Peer pPeer) {
+    if (peers.remove(pPeer)) {
+      pPeer.closed = true;
+      // frames for a removed connection are obsolete, readers may still add some concurrently
+      do {
+        pPeer.outgoing.clear();
+      } while (!pPeer.outgoing.offer(MessageFrames.END_OF_STREAM));
+    }
+  }
+
+  @Override
+  public void close() throws IOException {
+    closed = true;
+    server.close();
+    for (Peer peer : peers) {
+      remove(peer);
+      peer.socket.close();
+    }
+  }
+
+  private class Peer {
+
+    private final Socket socket;
+    private final DataInputStream input;
+    private final DataOutputStream output;
+    private final BlockingQueue<ByteBuffer> outgoing;
+    private volatile boolean closed;
+
+    private Peer(Socket pSocket) throws IOException {
+      socket = pSocket;
+      input = new DataInputStream(new BufferedInputStream(socket.getInputStream()));
+      output = new DataOutputStream(new BufferedOutputStream(socket.getOutputStream()));
+      outgoing = new ArrayBlockingQueue<>(queueSize);
+    }
+
+    private void forwardIncoming() {
+      try {
+        ByteBuffer frame;
+        while ((frame = MessageFrames.readFrame(input)) != null) {
+          for (Peer receiver : peers) {
+            MessageFrames.put(receiver.outgoing, frame, () -> receiver.closed);
+          }
+        }
+      } catch (SocketException e) {
+        // socket was closed locally
+      } catch (IOException e) {
+        logger.logUserException(Level.WARNING, e, "Connection to message hub failed");
+      } catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+      } finally {
+        remove(this);
+      }
+    }
+
+    private void writeOutgoing() {
+      try {
+        while (MessageFrames.writeBatch(outgoing, output, batchSize)) {
+          // continue until the connection is removed
+        }
+        socket.close();
+      } catch (IOException e) {
+        if (!closed) {
+          logger.logUserException(Level.WARNING, e, "Connection to message hub failed");
+        }
+        remove(this);
+      } catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+      }
+    }
+  }
+}
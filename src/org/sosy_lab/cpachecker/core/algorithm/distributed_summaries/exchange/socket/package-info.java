@@ -0,0 +1,10 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/** Implements a connection over TCP sockets that allows actors to run in different processes */
+package org.sosy_lab.cpachecker.core.algorithm.distributed_summaries.exchange.socket;
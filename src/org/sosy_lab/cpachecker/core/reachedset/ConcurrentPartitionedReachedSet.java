@@ -0,0 +1,576 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import static com.google.common.base.Preconditions.checkArgument;
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.collect.AbstractIterator;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Iterators;
+import com.google.common.collect.Maps;
+import com.google.common.util.concurrent.Striped;
+import com.google.errorprone.annotations.concurrent.GuardedBy;
+import java.util.AbstractCollection;
+import java.util.AbstractSet;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.Iterator;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.ConcurrentSkipListMap;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.locks.Lock;
+import java.util.function.BiConsumer;
+import java.util.stream.Stream;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
+import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.waitlist.AbstractSortedWaitlist;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.statistics.AbstractStatValue;
+
+/**
+ * Thread-safe variant of {@link PartitionedReachedSet} that can be shared by several threads
+ * exploring the state space concurrently.
+ *
+ * <p>Modifications lock only the stripe that belongs to the partition key of the modified state,
+ * such that threads working on different partitions do not block each other. Reading a partition
+ * with {@link #getReached(AbstractState)} does not lock at all and returns a weakly-consistent
+ * view of the partition (in insertion order) that reflects concurrent modifications. The waitlist
+ * is guarded by its own lock, which is always acquired after a stripe lock and never before.
+ * Removing a state takes constant time apart from the removal from the waitlist and from the global
+ * insertion order, and partitions that become empty are dropped.
+ *
+ * <p>Iteration over the whole reached set is weakly consistent and in insertion order, like for
+ * the sequential implementations.
+ */
+public class ConcurrentPartitionedReachedSet implements ReachedSet {
+
+  private static final int DEFAULT_STRIPES = 64;
+
+  private record Entry(long index, Partition.Node node, Precision precision) {}
+
+  private final ConfigurableProgramAnalysis cpa;
+
+  private final ConcurrentMap<AbstractState, Entry> reached = new ConcurrentHashMap<>();
+
+  /** All states in insertion order, indexed by their insertion number. */
+  private final ConcurrentSkipListMap<Long, AbstractState> insertionOrder =
+      new ConcurrentSkipListMap<>();
+
+  private final AtomicLong insertionCounter = new AtomicLong();
+
+  /** The non-empty partitions. Each partition is only modified while holding its stripe lock. */
+  private final ConcurrentMap<Object, Partition> partitions = new ConcurrentHashMap<>();
+
+  private final Striped<Lock> stripes;
+
+  private final Waitlist waitlist;
+
+  // first and last state are tracked like in DefaultReachedSet, they have their own lock
+  // because states of different partitions may be added concurrently
+  private final Object boundaryLock = new Object();
+
+  @GuardedBy("boundaryLock")
+  private int numberOfStates = 0;
+
+  @GuardedBy("boundaryLock")
+  private @Nullable AbstractState firstState = null;
+
+  @GuardedBy("boundaryLock")
+  private @Nullable AbstractState lastState = null;
+
+  private final Set<AbstractState> unmodifiableReached = new ReachedView();
+
+  public ConcurrentPartitionedReachedSet(
+      ConfigurableProgramAnalysis pCpa, WaitlistFactory waitlistFactory) {
+    this(pCpa, waitlistFactory, DEFAULT_STRIPES);
+  }
+
+  public ConcurrentPartitionedReachedSet(
+      ConfigurableProgramAnalysis pCpa, WaitlistFactory waitlistFactory, int pNumberOfStripes) {
+    cpa = checkNotNull(pCpa);
+    checkArgument(pNumberOfStripes > 0, "number of stripes must be positive");
+    stripes = Striped.lock(pNumberOfStripes);
+    waitlist = waitlistFactory.createWaitlistInstance();
+  }
+
+  protected Object getPartitionKey(AbstractState pState) {
+    checkNotNull(pState);
+    assert pState instanceof Partitionable
+        : "Partitionable states necessary for ConcurrentPartitionedReachedSet";
+    return ((Partitionable) pState).getPartitionKey();
+  }
+
+  @Override
+  public void add(AbstractState state, Precision precision) {
+    add(state, precision, /* updateWaitlist= */ true);
+  }
+
+  @Override
+  public void addNoWaitlist(AbstractState state, Precision precision) {
+    add(state, precision, /* updateWaitlist= */ false);
+  }
+
+  private void add(AbstractState state, Precision precision, boolean updateWaitlist) {
+    checkNotNull(state);
+    checkNotNull(precision);
+    Object key = getPartitionKey(state);
+
+    Lock lock = stripes.get(key);
+    lock.lock();
+    try {
+      Entry previous = reached.get(state);
+
+      if (previous == null) {
+        // State wasn't already in the reached set.
+        long index = insertionCounter.getAndIncrement();
+        Partition partition = partitions.computeIfAbsent(key, k -> new Partition());
+        reached.put(state, new Entry(index, partition.append(state), precision));
+        insertionOrder.put(index, state);
+        synchronized (boundaryLock) {
+          if (numberOfStates++ == 0) {
+            firstState = state;
+          }
+          lastState = state;
+        }
+        if (updateWaitlist) {
+          synchronized (waitlist) {
+            waitlist.add(state);
+          }
+        }
+
+      } else if (!precision.equals(previous.precision())) {
+        // State was already in the reached set, this is only allowed with the same precision
+        // (cf. DefaultReachedSet).
+        throw new IllegalArgumentException(
+            "State added to reached set which is already contained, but with a different"
+                + " precision");
+      }
+    } finally {
+      lock.unlock();
+    }
+  }
+
+  @Override
+  public void addAll(Iterable<Pair<AbstractState, Precision>> toAdd) {
+    for (Pair<AbstractState, Precision> pair : toAdd) {
+      add(pair.getFirst(), pair.getSecond());
+    }
+  }
+
+  @Override
+  public void reAddToWaitlist(AbstractState s) {
+    checkNotNull(s);
+    checkArgument(reached.containsKey(s), "State has to be in the reached set");
+
+    synchronized (waitlist) {
+      if (!waitlist.contains(s)) {
+        waitlist.add(s);
+      }
+    }
+  }
+
+  @Override
+  public void updatePrecision(AbstractState s, Precision newPrecision) {
+    checkNotNull(s);
+    checkNotNull(newPrecision);
+
+    Lock lock = stripes.get(getPartitionKey(s));
+    lock.lock();
+    try {
+      Entry oldEntry = reached.get(s);
+      checkArgument(
+          oldEntry != null,
+          "State needs to be in the reached set in order to change the precision.");
+      reached.put(s, new Entry(oldEntry.index(), oldEntry.node(), newPrecision));
+    } finally {
+      lock.unlock();
+    }
+  }
+
+  @Override
+  public void remove(AbstractState state) {
+    checkNotNull(state);
+    Object key = getPartitionKey(state);
+
+    Lock lock = stripes.get(key);
+    lock.lock();
+    try {
+      synchronized (waitlist) {
+        waitlist.remove(state);
+      }
+      Entry entry = reached.remove(state);
+      if (entry == null) {
+        return;
+      }
+      insertionOrder.remove(entry.index());
+      Partition partition = partitions.get(key);
+      partition.unlink(entry.node());
+      if (partition.isEmpty()) {
+        partitions.remove(key);
+      }
+      synchronized (boundaryLock) {
+        numberOfStates--;
+        if (state.equals(firstState)) {
+          firstState = null;
+        }
+        if (state.equals(lastState)) {
+          lastState = null;
+        }
+      }
+    } finally {
+      lock.unlock();
+    }
+  }
+
+  @Override
+  public void removeAll(Iterable<? extends AbstractState> toRemove) {
+    for (AbstractState state : toRemove) {
+      remove(state);
+    }
+  }
+
+  @Override
+  public void removeOnlyFromWaitlist(AbstractState state) {
+    checkNotNull(state);
+    synchronized (waitlist) {
+      waitlist.remove(state);
+    }
+  }
+
+  @Override
+  public void clear() {
+    // lock all stripes in a fixed order to get a consistent empty state
+    for (int i = 0; i < stripes.size(); i++) {
+      stripes.getAt(i).lock();
+    }
+    try {
+      synchronized (waitlist) {
+        waitlist.clear();
+      }
+      reached.clear();
+      insertionOrder.clear();
+      partitions.clear();
+      insertionCounter.set(0);
+      synchronized (boundaryLock) {
+        numberOfStates = 0;
+        firstState = null;
+        lastState = null;
+      }
+    } finally {
+      for (int i = stripes.size() - 1; i >= 0; i--) {
+        stripes.getAt(i).unlock();
+      }
+    }
+  }
+
+  @Override
+  public void clearWaitlist() {
+    synchronized (waitlist) {
+      waitlist.clear();
+    }
+  }
+
+  @Override
+  public AbstractState popFromWaitlist() {
+    synchronized (waitlist) {
+      return waitlist.pop();
+    }
+  }
+
+  @Override
+  public Set<AbstractState> asCollection() {
+    return unmodifiableReached;
+  }
+
+  @Override
+  public Iterator<AbstractState> iterator() {
+    return unmodifiableReached.iterator();
+  }
+
+  @Override
+  public Stream<AbstractState> stream() {
+    return insertionOrder.values().stream();
+  }
+
+  @Override
+  public Collection<Precision> getPrecisions() {
+    return Collections.unmodifiableCollection(
+        Maps.transformValues(reached, Entry::precision).values());
+  }
+
+  /**
+   * Return the states of the partition of the given state. This method does not block, the
+   * returned collection is a live, weakly-consistent view of the partition.
+   */
+  @Override
+  public Collection<AbstractState> getReached(AbstractState pState) {
+    return getReachedForKey(getPartitionKey(pState));
+  }
+
+  @Override
+  public Collection<AbstractState> getReached(CFANode location) {
+    checkNotNull(location);
+    return asCollection();
+  }
+
+  /**
+   * Return a live, weakly-consistent view of the partition with the given key. The view stays
+   * valid if the partition becomes empty and is dropped, or if it is created anew.
+   */
+  protected Collection<AbstractState> getReachedForKey(@Nullable Object key) {
+    if (key == null) {
+      return ImmutableSet.of();
+    }
+    return new AbstractCollection<>() {
+
+      @Override
+      public Iterator<AbstractState> iterator() {
+        Partition partition = partitions.get(key);
+        return partition == null ? Collections.emptyIterator() : partition.iterator();
+      }
+
+      @Override
+      public int size() {
+        Partition partition = partitions.get(key);
+        return partition == null ? 0 : partition.size();
+      }
+
+      @Override
+      public boolean isEmpty() {
+        return size() == 0;
+      }
+    };
+  }
+
+  protected Set<?> getKeySet() {
+    return Collections.unmodifiableSet(partitions.keySet());
+  }
+
+  public int getNumberOfPartitions() {
+    return partitions.size();
+  }
+
+  @Override
+  public @Nullable AbstractState getFirstState() {
+    synchronized (boundaryLock) {
+      return firstState;
+    }
+  }
+
+  @Override
+  public @Nullable AbstractState getLastState() {
+    synchronized (boundaryLock) {
+      return lastState;
+    }
+  }
+
+  @Override
+  public boolean hasWaitingState() {
+    synchronized (waitlist) {
+      return !waitlist.isEmpty();
+    }
+  }
+
+  @Override
+  public Collection<AbstractState> getWaitlist() {
+    return new AbstractCollection<>() {
+
+      @Override
+      public Iterator<AbstractState> iterator() {
+        // iterate over a snapshot, the waitlist itself is not thread-safe
+        synchronized (waitlist) {
+          return Iterators.unmodifiableIterator(
+              ImmutableSet.copyOf(waitlist.iterator()).iterator());
+        }
+      }
+
+      @Override
+      public boolean contains(Object obj) {
+        synchronized (waitlist) {
+          return obj instanceof AbstractState && waitlist.contains((AbstractState) obj);
+        }
+      }
+
+      @Override
+      public boolean isEmpty() {
+        synchronized (waitlist) {
+          return waitlist.isEmpty();
+        }
+      }
+
+      @Override
+      public int size() {
+        synchronized (waitlist) {
+          return waitlist.size();
+        }
+      }
+
+      @Override
+      public String toString() {
+        synchronized (waitlist) {
+          return waitlist.toString();
+        }
+      }
+    };
+  }
+
+  @Override
+  public Precision getPrecision(AbstractState state) {
+    checkNotNull(state);
+    Entry entry = reached.get(state);
+    checkArgument(entry != null, "State not in reached set:\n%s", state);
+    return entry.precision();
+  }
+
+  @Override
+  public void forEach(BiConsumer<? super AbstractState, ? super Precision> pAction) {
+    for (AbstractState state : insertionOrder.values()) {
+      Entry entry = reached.get(state);
+      if (entry != null) {
+        pAction.accept(state, entry.precision());
+      }
+    }
+  }
+
+  @Override
+  public boolean contains(AbstractState state) {
+    checkNotNull(state);
+    return reached.containsKey(state);
+  }
+
+  @Override
+  public int size() {
+    return reached.size();
+  }
+
+  @Override
+  public boolean isEmpty() {
+    return reached.isEmpty();
+  }
+
+  @Override
+  public String toString() {
+    return insertionOrder.values().toString();
+  }
+
+  @Override
+  public ImmutableMap<String, AbstractStatValue> getStatistics() {
+    synchronized (waitlist) {
+      if (waitlist instanceof AbstractSortedWaitlist) {
+        return ImmutableMap.copyOf(((AbstractSortedWaitlist<?>) waitlist).getDelegationCounts());
+      }
+    }
+    return ImmutableMap.of();
+  }
+
+  @Override
+  public ConfigurableProgramAnalysis getCPA() {
+    return cpa;
+  }
+
+  /** Unmodifiable, weakly-consistent view on all reached states in insertion order. */
+  private final class ReachedView extends AbstractSet<AbstractState> {
+
+    @Override
+    public Iterator<AbstractState> iterator() {
+      return Iterators.unmodifiableIterator(insertionOrder.values().iterator());
+    }
+
+    @Override
+    public boolean contains(Object o) {
+      return o != null && reached.containsKey(o);
+    }
+
+    @Override
+    public int size() {
+      return reached.size();
+    }
+  }
+
+  /**
+   * The states of one partition in insertion order as doubly-linked list, such that a state can be
+   * unlinked in constant time given its node. Modifications need to hold the stripe lock of the
+   * partition. Iteration does not lock: it follows the volatile forward links and skips unlinked
+   * nodes, and unlinked nodes keep their forward link such that iterators positioned on them can
+   * continue.
+   */
+  private static final class Partition extends AbstractCollection<AbstractState> {
+
+    private static final class Node {
+      private final @Nullable AbstractState state;
+      private volatile @Nullable Node next = null;
+      private @Nullable Node prev = null;
+      private volatile boolean unlinked = false;
+
+      private Node(@Nullable AbstractState pState) {
+        state = pState;
+      }
+    }
+
+    private final Node head = new Node(null);
+    private Node tail = head;
+    private volatile int size = 0;
+
+    private Node append(AbstractState pState) {
+      Node node = new Node(pState);
+      node.prev = tail;
+      tail.next = node;
+      tail = node;
+      size++;
+      return node;
+    }
+
+    private void unlink(Node pNode) {
+      assert !pNode.unlinked;
+      pNode.unlinked = true;
+      Node prev = pNode.prev;
+      Node next = pNode.next;
+      prev.next = next;
+      if (next == null) {
+        tail = prev;
+      } else {
+        next.prev = prev;
+      }
+      size--;
+    }
+
+    @Override
+    public Iterator<AbstractState> iterator() {
+      return new AbstractIterator<>() {
+        private @Nullable Node current = head;
+
+        @Override
+        protected AbstractState computeNext() {
+          do {
+            current = current.next;
+            if (current == null) {
+              return endOfData();
+            }
+          } while (current.unlinked);
+          return current.state;
+        }
+      };
+    }
+
+    @Override
+    public int size() {
+      return size;
+    }
+  }
+}
@@ -0,0 +1,189 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Iterator;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.TraversalMethod;
+import org.sosy_lab.cpachecker.cpa.alwaystop.AlwaysTopCPA;
+
+public class ConcurrentPartitionedReachedSetTest {
+
+  private record TestState(int id, int key) implements AbstractState, Partitionable {
+    @Override
+    public Object getPartitionKey() {
+      return key;
+    }
+  }
+
+  private static final Precision PRECISION = SingletonPrecision.getInstance();
+
+  private ConcurrentPartitionedReachedSet reached;
+
+  @Before
+  public void setUp() {
+    reached = new ConcurrentPartitionedReachedSet(AlwaysTopCPA.INSTANCE, TraversalMethod.BFS, 4);
+  }
+
+  @Test
+  public void testCreatedByFactory() throws Exception {
+    ReachedSetFactory factory =
+        new ReachedSetFactory(
+            Configuration.builder()
+                .setOption("analysis.reachedSet", "CONCURRENTPARTITIONED")
+                .build(),
+            LogManager.createTestLogManager());
+    assertThat(factory.create(AlwaysTopCPA.INSTANCE))
+        .isInstanceOf(ConcurrentPartitionedReachedSet.class);
+  }
+
+  @Test
+  public void testPartitionsInInsertionOrder() {
+    TestState s1 = new TestState(1, 0);
+    TestState s2 = new TestState(2, 1);
+    TestState s3 = new TestState(3, 0);
+    TestState s4 = new TestState(4, 0);
+    reached.add(s1, PRECISION);
+    reached.add(s2, PRECISION);
+    reached.add(s3, PRECISION);
+    reached.add(s4, PRECISION);
+
+    assertThat(reached.asCollection()).containsExactly(s1, s2, s3, s4).inOrder();
+    assertThat(reached.getReached(s1)).containsExactly(s1, s3, s4).inOrder();
+    assertThat(reached.getReached(s2)).containsExactly(s2);
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(2);
+
+    reached.remove(s3);
+    assertThat(reached.getReached(s1)).containsExactly(s1, s4).inOrder();
+    assertThat(reached.getReached(s1)).hasSize(2);
+    assertThat(reached.asCollection()).containsExactly(s1, s2, s4).inOrder();
+    assertThat(reached.getWaitlist()).containsExactly(s1, s2, s4);
+  }
+
+  @Test
+  public void testEmptyPartitionsAreDropped() {
+    TestState s1 = new TestState(1, 0);
+    TestState s2 = new TestState(2, 1);
+    reached.add(s1, PRECISION);
+    reached.add(s2, PRECISION);
+    Collection<AbstractState> partition = reached.getReached(s2);
+
+    reached.remove(s2);
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(1);
+    assertThat(partition).isEmpty();
+
+    // a view of a dropped partition reflects that it is created anew
+    TestState s3 = new TestState(3, 1);
+    reached.add(s3, PRECISION);
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(2);
+    assertThat(partition).containsExactly(s3);
+  }
+
+  @Test
+  public void testIteratorSurvivesRemoval() {
+    TestState s1 = new TestState(1, 0);
+    TestState s2 = new TestState(2, 0);
+    TestState s3 = new TestState(3, 0);
+    reached.add(s1, PRECISION);
+    reached.add(s2, PRECISION);
+    reached.add(s3, PRECISION);
+
+    Iterator<AbstractState> it = reached.getReached(s1).iterator();
+    assertThat(it.next()).isEqualTo(s1);
+    reached.remove(s1);
+    reached.remove(s2);
+    assertThat(it.hasNext()).isTrue();
+    assertThat(it.next()).isEqualTo(s3);
+    assertThat(it.hasNext()).isFalse();
+  }
+
+  @Test
+  public void testFirstAndLastStateLikeDefaultReachedSet() {
+    DefaultReachedSet expected = new DefaultReachedSet(AlwaysTopCPA.INSTANCE, TraversalMethod.BFS);
+    List<TestState> states =
+        ImmutableList.of(new TestState(1, 0), new TestState(2, 1), new TestState(3, 0));
+
+    for (TestState state : states) {
+      reached.add(state, PRECISION);
+      expected.add(state, PRECISION);
+      assertThat(reached.getFirstState()).isEqualTo(expected.getFirstState());
+      assertThat(reached.getLastState()).isEqualTo(expected.getLastState());
+    }
+    for (TestState state : states) {
+      reached.remove(state);
+      expected.remove(state);
+      assertThat(reached.getFirstState()).isEqualTo(expected.getFirstState());
+      assertThat(reached.getLastState()).isEqualTo(expected.getLastState());
+    }
+
+    // the first state of an emptied reached set is the next added state
+    TestState s4 = new TestState(4, 2);
+    reached.add(s4, PRECISION);
+    expected.add(s4, PRECISION);
+    assertThat(reached.getFirstState()).isEqualTo(expected.getFirstState());
+    assertThat(reached.getFirstState()).isEqualTo(s4);
+  }
+
+  @Test
+  public void testConcurrentAddAndRemove() throws Exception {
+    final int threads = 4;
+    final int statesPerThread = 1000;
+    ExecutorService executor = Executors.newFixedThreadPool(threads);
+    try {
+      List<Future<?>> futures = new ArrayList<>();
+      for (int t = 0; t < threads; t++) {
+        final int thread = t;
+        futures.add(
+            executor.submit(
+                () -> {
+                  for (int i = 0; i < statesPerThread; i++) {
+                    TestState state = new TestState(thread * statesPerThread + i, i % 10);
+                    reached.add(state, PRECISION);
+                    if (i % 2 == 1) {
+                      reached.remove(state);
+                    }
+                  }
+                }));
+      }
+      for (Future<?> future : futures) {
+        future.get();
+      }
+    } finally {
+      executor.shutdownNow();
+    }
+
+    assertThat(reached.size()).isEqualTo(threads * statesPerThread / 2);
+    assertThat(reached.asCollection()).hasSize(threads * statesPerThread / 2);
+    assertThat(reached.getWaitlist()).hasSize(threads * statesPerThread / 2);
+    int sum = 0;
+    for (int key = 0; key < 10; key++) {
+      Collection<AbstractState> partition = reached.getReached(new TestState(-1, key));
+      assertThat(partition).hasSize(key % 2 == 0 ? threads * statesPerThread / 10 : 0);
+      sum += partition.size();
+    }
+    assertThat(sum).isEqualTo(reached.size());
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(5);
+  }
+}
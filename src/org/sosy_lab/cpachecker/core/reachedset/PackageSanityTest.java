@@ -15,6 +15,8 @@ import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.TraversalMethod;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
 import org.sosy_lab.cpachecker.cpa.alwaystop.AlwaysTopCPA;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
@@ -33,5 +35,6 @@ public class PackageSanityTest extends AbstractPackageSanityTests {
     setDefault(ConfigurableProgramAnalysis.class, AlwaysTopCPA.INSTANCE);
     setDefault(CFANode.class, CFANode.newDummyCFANode("test"));
     setDefault(StateSpacePartition.class, StateSpacePartition.getDefaultPartition());
+    setDefault(WaitlistFactory.class, TraversalMethod.BFS);
   }
 }
@@ -48,6 +48,8 @@ public class ReachedSetFactory {
     LOCATIONMAPPED,
     PARTITIONED,
     PSEUDOPARTITIONED,
+    CONCURRENTPARTITIONED,
+    CONCURRENTLOCATIONMAPPED,
     USAGE
   }
 
@@ -169,7 +171,10 @@ public class ReachedSetFactory {
               + " locations cannot be merged)\n"
               + "PARTITIONED: partitioning depending on CPAs (e.g Location, Callstack etc.)\n"
               + "PSEUDOPARTITIONED: based on PARTITIONED, uses additional info about the states'"
-              + " lattice (maybe faster for some special analyses which use merge_sep and stop_sep")
+              + " lattice (maybe faster for some special analyses which use merge_sep and stop_sep\n"
+              + "CONCURRENTPARTITIONED: thread-safe variant of PARTITIONED with lock striping per"
+              + " partition, for sharing one reached set between several threads\n"
+              + "CONCURRENTLOCATIONMAPPED: thread-safe variant of LOCATIONMAPPED")
   private ReachedSetType reachedSet = ReachedSetType.PARTITIONED;
 
   @Option(
@@ -270,6 +275,9 @@ public class ReachedSetFactory {
           case PARTITIONED -> new PartitionedReachedSet(cpa, waitlistFactory);
           case PSEUDOPARTITIONED -> new PseudoPartitionedReachedSet(cpa, waitlistFactory);
           case LOCATIONMAPPED -> new LocationMappedReachedSet(cpa, waitlistFactory);
+          case CONCURRENTPARTITIONED -> new ConcurrentPartitionedReachedSet(cpa, waitlistFactory);
+          case CONCURRENTLOCATIONMAPPED ->
+              new ConcurrentLocationMappedReachedSet(cpa, waitlistFactory);
           case USAGE -> new UsageReachedSet(cpa, waitlistFactory, usageConfig, logger);
           case NORMAL -> new DefaultReachedSet(cpa, waitlistFactory);
           default -> new DefaultReachedSet(cpa, waitlistFactory);
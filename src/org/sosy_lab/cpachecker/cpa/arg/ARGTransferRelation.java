@@ -39,23 +39,39 @@ public class ARGTransferRelation extends AbstractSingleWrapperTransferRelation {
 
     element.markExpanded();
 
-    AbstractState wrappedState = element.getWrappedState();
-    Collection<? extends AbstractState> successors;
+    return addSuccessorsToARG(element, getWrappedSuccessors(element, pPrecision));
+  }
+
+  /**
+   * Compute the successors of the wrapped state of the given state without changing the ARG. This
+   * may be called concurrently for several states if the wrapped transfer relation is thread-safe,
+   * the successors need to be passed to {@link #addSuccessorsToARG(ARGState, Collection)}
+   * afterwards.
+   */
+  public Collection<? extends AbstractState> getWrappedSuccessors(
+      ARGState pElement, Precision pPrecision) throws CPATransferException, InterruptedException {
     try {
-      successors = transferRelation.getAbstractSuccessors(wrappedState, pPrecision);
+      return transferRelation.getAbstractSuccessors(pElement.getWrappedState(), pPrecision);
     } catch (UnrecognizedCodeException e) {
       // setting parent of this unsupported code part
-      e.setParentState(element);
+      e.setParentState(pElement);
       throw e;
     }
+  }
 
-    if (successors.isEmpty()) {
+  /**
+   * Create the ARG states for the given successors of the wrapped state of the given state, and add
+   * them as children of the given state. This changes the ARG and is thus not thread-safe.
+   */
+  public Collection<ARGState> addSuccessorsToARG(
+      ARGState pElement, Collection<? extends AbstractState> pWrappedSuccessors) {
+    if (pWrappedSuccessors.isEmpty()) {
       return ImmutableSet.of();
     }
 
     ImmutableList.Builder<ARGState> wrappedSuccessors = ImmutableList.builder();
-    for (AbstractState absElement : successors) {
-      ARGState successorElem = new ARGState(absElement, element);
+    for (AbstractState absElement : pWrappedSuccessors) {
+      ARGState successorElem = new ARGState(absElement, pElement);
       wrappedSuccessors.add(successorElem);
     }
 
@@ -37,6 +37,7 @@ import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCacheAggressiveImpl;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCacheImpl;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMDataManager;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMDataManagerImpl;
+import org.sosy_lab.cpachecker.cpa.bam.cache.BAMPersistentCache;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 
@@ -90,11 +91,13 @@ public class BAMCPA extends AbstractBAMCPA implements StatisticsProvider, ProofC
       wrappedProofChecker = null;
     }
 
+    final BAMPersistentCache persistentCache =
+        new BAMPersistentCache(config, pLogger, pCfa, this, getReducer(), pReachedSetFactory);
     final BAMCache cache;
     if (aggressiveCaching) {
-      cache = new BAMCacheAggressiveImpl(config, getReducer(), logger);
+      cache = new BAMCacheAggressiveImpl(config, getReducer(), logger, persistentCache);
     } else {
-      cache = new BAMCacheImpl(config, getReducer(), logger);
+      cache = new BAMCacheImpl(config, getReducer(), logger, persistentCache);
     }
     data = new BAMDataManagerImpl(this, cache, pReachedSetFactory, pLogger);
 
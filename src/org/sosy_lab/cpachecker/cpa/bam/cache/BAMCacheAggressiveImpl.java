@@ -35,6 +35,15 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
     super(config, reducer, logger);
   }
 
+  public BAMCacheAggressiveImpl(
+      Configuration config,
+      Reducer reducer,
+      LogManager logger,
+      @Nullable BAMPersistentCache pPersistentCache)
+      throws InvalidConfigurationException {
+    super(config, reducer, logger, pPersistentCache);
+  }
+
   @Override
   protected @Nullable BAMCacheEntry getIfNotExistant(
       final AbstractState stateKey,
@@ -62,6 +71,11 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
     return super.getIfNotExistant(stateKey, precisionKey, context, hash);
   }
 
+  @Override
+  protected void onEviction(BAMCacheEntry pEntry) {
+    impreciseReachedCache.values().removeIf(entry -> entry == pEntry);
+  }
+
   /** Return the cache hit with the closest precision (used for aggressive caching). */
   private BAMCacheEntry lookForSimilarState(
       AbstractState pStateKey, Precision pPrecisionKey, Block pContext) {
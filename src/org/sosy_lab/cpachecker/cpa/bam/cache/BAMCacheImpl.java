@@ -12,12 +12,22 @@ import static com.google.common.base.Preconditions.checkNotNull;
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
 
 import com.google.common.collect.Collections2;
+import com.google.common.collect.ImmutableList;
 import java.io.PrintStream;
 import java.util.Collection;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.Iterator;
 import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
 import java.util.Map;
+import java.util.NavigableSet;
+import java.util.Set;
+import java.util.TreeSet;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -43,12 +53,52 @@ public class BAMCacheImpl implements BAMCache {
               + "for each cache miss to find the cause of the miss.")
   private boolean gatherCacheMissStatistics = false;
 
+  /** Strategies for choosing which cache entries are evicted first. */
+  enum EvictionPolicy {
+    /** least recently used entries first */
+    LRU,
+    /** entries with the largest reached-sets first, i.e., entries that free most memory */
+    LARGEST,
+    /** least frequently used entries first, ties are broken by recency */
+    LFU,
+  }
+
+  @Option(
+      secure = true,
+      name = "cacheLimit.entries",
+      description =
+          "Maximal number of entries in the BAM cache (0 for unlimited). If the limit is exceeded,"
+              + " finished entries are evicted according to 'cpa.bam.cacheLimit.evictionPolicy'.")
+  @IntegerOption(min = 0)
+  private int maxEntries = 0;
+
+  @Option(
+      secure = true,
+      name = "cacheLimit.states",
+      description =
+          "Maximal number of abstract states in all reached-sets of the BAM cache (0 for"
+              + " unlimited). If the limit is exceeded, finished entries are evicted according to"
+              + " 'cpa.bam.cacheLimit.evictionPolicy'.")
+  @IntegerOption(min = 0)
+  private int maxStates = 0;
+
+  @Option(
+      secure = true,
+      name = "cacheLimit.evictionPolicy",
+      description =
+          "Which entries of the BAM cache to evict first if a limit is exceeded: least recently"
+              + " used (LRU), largest reached-set (LARGEST), or least frequently used (LFU).")
+  private EvictionPolicy evictionPolicy = EvictionPolicy.LRU;
+
   private final Timer hashingTimer = new Timer();
   private final Timer equalsTimer = new Timer();
+  private final Timer evictionTimer = new Timer();
 
   private int cacheMisses = 0;
   private int partialCacheHits = 0;
   private int fullCacheHits = 0;
+  private int evictions = 0;
+  private long evictedStates = 0;
 
   private int abstractionCausedMisses = 0;
   private int precisionCausedMisses = 0;
@@ -57,15 +107,64 @@ public class BAMCacheImpl implements BAMCache {
   // we use LinkedHashMaps to avoid non-determinism
   protected final Map<AbstractStateHash, BAMCacheEntry> preciseReachedCache = new LinkedHashMap<>();
 
+  /** Usage information for eviction, only tracked if the cache is bounded. */
+  private final Map<AbstractStateHash, EntryUsage> usage = new HashMap<>();
+
+  /** The usage information of all entries, in the order in which they should be evicted. */
+  private final NavigableSet<EntryUsage> evictionQueue;
+
+  /**
+   * Entries whose analysis was not finished when their size was recorded. Their reached-sets may
+   * still grow, so their sizes are updated before each check of the limits.
+   */
+  private final Set<EntryUsage> growingEntries = new LinkedHashSet<>();
+
+  /** The sum of the recorded sizes of all entries. */
+  private long numStates = 0;
+
+  private long accessClock = 0;
+
+  /**
+   * Usage information of an entry. The fields that determine the eviction order must only be
+   * changed while the object is not in {@link #evictionQueue}.
+   */
+  private static final class EntryUsage {
+    private final AbstractStateHash hash;
+    private long lastAccess;
+    private int accesses = 0;
+    private int size = 0;
+
+    private EntryUsage(AbstractStateHash pHash) {
+      hash = pHash;
+    }
+  }
+
   protected BAMCacheEntry lastAnalyzedEntry = null;
   protected final Reducer reducer;
   protected final LogManager logger;
+  private final @Nullable BAMPersistentCache persistentCache;
 
   public BAMCacheImpl(Configuration config, Reducer reducer, LogManager logger)
       throws InvalidConfigurationException {
+    this(config, reducer, logger, null);
+  }
+
+  /**
+   * Create a cache that falls back to the given persistent cache on misses (if it is enabled), and
+   * stores all finished entries in it after the analysis.
+   */
+  public BAMCacheImpl(
+      Configuration config,
+      Reducer reducer,
+      LogManager logger,
+      @Nullable BAMPersistentCache pPersistentCache)
+      throws InvalidConfigurationException {
     config.inject(this, BAMCacheImpl.class);
     this.reducer = reducer;
     this.logger = logger;
+    persistentCache =
+        pPersistentCache != null && pPersistentCache.isEnabled() ? pPersistentCache : null;
+    evictionQueue = new TreeSet<>(getEvictionOrder());
   }
 
   protected AbstractStateHash getHashCode(
@@ -80,9 +179,113 @@ public class BAMCacheImpl implements BAMCache {
     BAMCacheEntry entry = new BAMCacheEntry(rs);
     // assert !preciseReachedCache.containsKey(hash);
     preciseReachedCache.put(hash, entry);
+    if (isBounded()) {
+      touch(hash);
+      evictIfNecessary();
+    }
     return entry;
   }
 
+  private boolean isBounded() {
+    return maxEntries > 0 || maxStates > 0;
+  }
+
+  private void touch(AbstractStateHash hash) {
+    EntryUsage entryUsage = usage.get(hash);
+    if (entryUsage == null) {
+      entryUsage = new EntryUsage(hash);
+      usage.put(hash, entryUsage);
+    } else {
+      evictionQueue.remove(entryUsage);
+    }
+    entryUsage.lastAccess = accessClock++;
+    entryUsage.accesses++;
+    updateSize(entryUsage);
+    evictionQueue.add(entryUsage);
+  }
+
+  /** Record the current size of an entry that is not in {@link #evictionQueue}. */
+  private void updateSize(EntryUsage pUsage) {
+    BAMCacheEntry entry = preciseReachedCache.get(pUsage.hash);
+    int size = entry.getReachedSet().size();
+    numStates += size - pUsage.size;
+    pUsage.size = size;
+    if (isFinished(entry)) {
+      growingEntries.remove(pUsage);
+    } else {
+      growingEntries.add(pUsage);
+    }
+  }
+
+  private static boolean isFinished(BAMCacheEntry pEntry) {
+    return pEntry.getExitStates() != null && !pEntry.getReachedSet().hasWaitingState();
+  }
+
+  /**
+   * An entry may only be evicted if its analysis is finished. Unfinished entries are either on the
+   * stack of the current BAM analysis or are partially analyzed after a refinement, and their
+   * reached-sets are still referenced. Evicting a finished entry is always sound, because the next
+   * access is just a cache miss and the block is analyzed again. Reached-sets of evicted entries
+   * that are still part of the main ARG stay reachable through {@link BAMDataManager}, such that
+   * refinement and counterexample reconstruction are not affected.
+   */
+  private boolean isEvictable(BAMCacheEntry pEntry) {
+    return pEntry != lastAnalyzedEntry && isFinished(pEntry);
+  }
+
+  private boolean isOverLimit() {
+    return (maxEntries > 0 && preciseReachedCache.size() > maxEntries)
+        || (maxStates > 0 && numStates > maxStates);
+  }
+
+  private void evictIfNecessary() {
+    // only unfinished entries change their size without being accessed
+    for (EntryUsage growing : ImmutableList.copyOf(growingEntries)) {
+      evictionQueue.remove(growing);
+      updateSize(growing);
+      evictionQueue.add(growing);
+    }
+    if (!isOverLimit()) {
+      return;
+    }
+
+    evictionTimer.start();
+    try {
+      Iterator<EntryUsage> candidates = evictionQueue.iterator();
+      while (isOverLimit() && candidates.hasNext()) {
+        EntryUsage candidate = candidates.next();
+        BAMCacheEntry entry = preciseReachedCache.get(candidate.hash);
+        if (!isEvictable(entry)) {
+          continue;
+        }
+        candidates.remove();
+        preciseReachedCache.remove(candidate.hash);
+        usage.remove(candidate.hash);
+        numStates -= candidate.size;
+        evictedStates += candidate.size;
+        evictions++;
+        onEviction(entry);
+      }
+      logger.log(Level.FINEST, "CACHE_EVICTION: cache has", preciseReachedCache.size(), "entries");
+    } finally {
+      evictionTimer.stop();
+    }
+  }
+
+  /** The order of eviction, ties are broken by recency, which is unique for each entry. */
+  private Comparator<EntryUsage> getEvictionOrder() {
+    Comparator<EntryUsage> byRecency = Comparator.comparingLong(u -> u.lastAccess);
+    return switch (evictionPolicy) {
+      case LRU -> byRecency;
+      case LARGEST ->
+          Comparator.<EntryUsage>comparingInt(u -> u.size).reversed().thenComparing(byRecency);
+      case LFU -> Comparator.<EntryUsage>comparingInt(u -> u.accesses).thenComparing(byRecency);
+    };
+  }
+
+  /** Called after an entry was evicted from the precise cache, e.g., to remove other references. */
+  protected void onEviction(@SuppressWarnings("unused") BAMCacheEntry pEntry) {}
+
   protected static boolean allStatesContainedInReachedSet(
       Collection<AbstractState> pElements, ReachedSet reached) {
     return reached.asCollection().containsAll(pElements);
@@ -120,10 +323,27 @@ public class BAMCacheImpl implements BAMCache {
     BAMCacheEntry result = preciseReachedCache.get(hash);
     if (result != null) {
       lastAnalyzedEntry = result;
+      if (isBounded()) {
+        touch(hash);
+      }
       logger.log(Level.FINEST, "CACHE_ACCESS: precise entry");
       return result;
     }
 
+    if (persistentCache != null) {
+      result = persistentCache.lookup(stateKey, precisionKey, context);
+      if (result != null) {
+        preciseReachedCache.put(hash, result);
+        lastAnalyzedEntry = result;
+        if (isBounded()) {
+          touch(hash);
+          evictIfNecessary();
+        }
+        logger.log(Level.FINEST, "CACHE_ACCESS: precise entry from persistent cache");
+        return result;
+      }
+    }
+
     return getIfNotExistant(stateKey, precisionKey, context, hash);
   }
 
@@ -184,7 +404,7 @@ public class BAMCacheImpl implements BAMCache {
   class AbstractStateHash {
 
     private final Object wrappedHash;
-    private final Block context;
+    final Block context;
     final AbstractState stateKey;
     final Precision precisionKey;
 
@@ -276,6 +496,19 @@ public class BAMCacheImpl implements BAMCache {
             + " ("
             + toPercent(fullCacheHits, sumCalls)
             + " of all calls)");
+    if (isBounded()) {
+      out.println(
+          "  Number of evicted entries:                         "
+              + evictions
+              + " (policy "
+              + evictionPolicy
+              + ", "
+              + evictedStates
+              + " states)");
+      out.println(
+          "  Number of entries in cache:                        " + preciseReachedCache.size());
+      out.println("  Time for eviction:                                 " + evictionTimer);
+    }
     if (gatherCacheMissStatistics) {
       out.println("Cause for cache misses:                              ");
       out.println(
@@ -309,6 +542,16 @@ public class BAMCacheImpl implements BAMCache {
             + " (Calls: "
             + hashingTimer.getNumberOfIntervals()
             + ")");
+    if (persistentCache != null) {
+      persistentCache.printStatistics(out);
+    }
+  }
+
+  @Override
+  public void writeOutputFiles(Result pResult, UnmodifiableReachedSet pReached) {
+    if (persistentCache != null) {
+      persistentCache.store(preciseReachedCache);
+    }
   }
 
   @Override
@@ -319,6 +562,10 @@ public class BAMCacheImpl implements BAMCache {
   @Override
   public void clear() {
     preciseReachedCache.clear();
+    usage.clear();
+    evictionQueue.clear();
+    growingEntries.clear();
+    numStates = 0;
     lastAnalyzedEntry = null;
   }
 }
@@ -0,0 +1,164 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.bam.cache;
+
+import static com.google.common.truth.Truth.assertThat;
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.when;
+
+import com.google.common.collect.ImmutableSet;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.Reducer;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
+import org.sosy_lab.cpachecker.cpa.alwaystop.AlwaysTopCPA;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCache.BAMCacheEntry;
+
+public class BAMCacheImplTest {
+
+  private static final Precision PRECISION = SingletonPrecision.getInstance();
+
+  private final Block block =
+      new Block(ImmutableSet.of(), ImmutableSet.of(), ImmutableSet.of(), ImmutableSet.of());
+
+  private final AbstractState keyA = new ARGState(null, null);
+  private final AbstractState keyB = new ARGState(null, null);
+  private final AbstractState keyC = new ARGState(null, null);
+  private final AbstractState keyMissing = new ARGState(null, null);
+
+  private Reducer reducer;
+  private ReachedSetFactory reachedSetFactory;
+
+  @Before
+  public void setUp() throws Exception {
+    reducer = mock(Reducer.class);
+    // keys are compared by identity of the states
+    when(reducer.getHashCodeForState(any(), any())).thenAnswer(i -> i.getArgument(0));
+    reachedSetFactory =
+        new ReachedSetFactory(
+            Configuration.builder().setOption("analysis.reachedSet", "NORMAL").build(),
+            LogManager.createTestLogManager());
+  }
+
+  private BAMCacheImpl createCache(String pLimit, int pValue, String pPolicy) throws Exception {
+    Configuration config =
+        Configuration.builder()
+            .setOption("cpa.bam.cacheLimit." + pLimit, Integer.toString(pValue))
+            .setOption("cpa.bam.cacheLimit.evictionPolicy", pPolicy)
+            .build();
+    return new BAMCacheImpl(config, reducer, LogManager.createTestLogManager());
+  }
+
+  private ReachedSet createReachedSet(int pSize) {
+    ReachedSet reached = reachedSetFactory.create(AlwaysTopCPA.INSTANCE);
+    for (int i = 0; i < pSize; i++) {
+      reached.add(new ARGState(null, null), PRECISION);
+    }
+    return reached;
+  }
+
+  private static void finish(BAMCacheEntry pEntry) {
+    ReachedSet reached = pEntry.getReachedSet();
+    reached.clearWaitlist();
+    pEntry.setExitStates(ImmutableSet.of(reached.getLastState()));
+  }
+
+  /** Put a finished entry of the given size into the cache. */
+  private void putFinished(BAMCacheImpl pCache, AbstractState pKey, int pSize) {
+    finish(pCache.put(pKey, PRECISION, block, createReachedSet(pSize)));
+  }
+
+  private boolean contains(BAMCacheImpl pCache, AbstractState pKey) {
+    return pCache.containsPreciseKey(pKey, PRECISION, block);
+  }
+
+  /** Access an entry, and afterwards reset the last analyzed entry, which is never evicted. */
+  private void access(BAMCacheImpl pCache, AbstractState pKey) {
+    assertThat(pCache.get(pKey, PRECISION, block)).isNotNull();
+    assertThat(pCache.get(keyMissing, PRECISION, block)).isNull();
+  }
+
+  @Test
+  public void testLeastRecentlyUsed() throws Exception {
+    BAMCacheImpl cache = createCache("entries", 2, "LRU");
+    putFinished(cache, keyA, 1);
+    putFinished(cache, keyB, 1);
+    access(cache, keyA);
+    access(cache, keyA);
+    access(cache, keyB);
+    putFinished(cache, keyC, 1);
+
+    assertThat(contains(cache, keyA)).isFalse();
+    assertThat(contains(cache, keyB)).isTrue();
+    assertThat(contains(cache, keyC)).isTrue();
+  }
+
+  @Test
+  public void testLeastFrequentlyUsed() throws Exception {
+    BAMCacheImpl cache = createCache("entries", 2, "LFU");
+    putFinished(cache, keyA, 1);
+    putFinished(cache, keyB, 1);
+    access(cache, keyA);
+    access(cache, keyA);
+    access(cache, keyB);
+    putFinished(cache, keyC, 1);
+
+    assertThat(contains(cache, keyA)).isTrue();
+    assertThat(contains(cache, keyB)).isFalse();
+    assertThat(contains(cache, keyC)).isTrue();
+  }
+
+  @Test
+  public void testLargest() throws Exception {
+    BAMCacheImpl cache = createCache("states", 6, "LARGEST");
+    putFinished(cache, keyA, 1);
+    putFinished(cache, keyB, 5);
+    assertThat(contains(cache, keyA)).isTrue();
+    assertThat(contains(cache, keyB)).isTrue();
+
+    putFinished(cache, keyC, 1);
+    assertThat(contains(cache, keyA)).isTrue();
+    assertThat(contains(cache, keyB)).isFalse();
+    assertThat(contains(cache, keyC)).isTrue();
+  }
+
+  @Test
+  public void testUnfinishedEntriesAreNotEvicted() throws Exception {
+    BAMCacheImpl cache = createCache("entries", 1, "LRU");
+    cache.put(keyA, PRECISION, block, createReachedSet(1));
+    cache.put(keyB, PRECISION, block, createReachedSet(1));
+    assertThat(contains(cache, keyA)).isTrue();
+    assertThat(contains(cache, keyB)).isTrue();
+  }
+
+  @Test
+  public void testGrowingEntryIsCounted() throws Exception {
+    BAMCacheImpl cache = createCache("states", 5, "LRU");
+    // the reached-set of an entry is filled after it was put into the cache
+    BAMCacheEntry entryA = cache.put(keyA, PRECISION, block, createReachedSet(1));
+    for (int i = 0; i < 9; i++) {
+      entryA.getReachedSet().add(new ARGState(null, null), PRECISION);
+    }
+    finish(entryA);
+    assertThat(contains(cache, keyA)).isTrue();
+
+    putFinished(cache, keyB, 1);
+    assertThat(contains(cache, keyA)).isFalse();
+    assertThat(contains(cache, keyB)).isTrue();
+  }
+}
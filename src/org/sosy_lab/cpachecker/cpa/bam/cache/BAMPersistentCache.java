@@ -0,0 +1,689 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.bam.cache;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.google.common.base.Strings;
+import com.google.common.collect.ArrayListMultimap;
+import com.google.common.collect.HashMultimap;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.Iterables;
+import com.google.common.collect.ListMultimap;
+import com.google.common.collect.SetMultimap;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.io.BufferedOutputStream;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.io.OutputStream;
+import java.io.PrintStream;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Set;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.AAstNode;
+import org.sosy_lab.cpachecker.cfa.ast.AIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.ARightHandSide;
+import org.sosy_lab.cpachecker.cfa.ast.ASimpleDeclaration;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.types.Type;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.core.CPAchecker;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.Reducer;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCache.BAMCacheEntry;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.globalinfo.SerializationInfoStorage;
+
+/**
+ * Persistent storage for finished block summaries of BAM, such that a later run of CPAchecker on
+ * the same (or a slightly changed) program can reuse them instead of re-analyzing the block.
+ *
+ * <p>Each summary is stored as the serialized reached-set of the block together with its exit
+ * states, and with the serialized reduced initial state and precision as key. A summary is only
+ * used for a block with the same SHA-256 hash of the configuration and of the block's CFA (nodes,
+ * edges, and the declarations and types they refer to, which also covers all nested blocks and
+ * callees, see {@link #computeBlockHash(Block)}). Among the summaries
+ * of a block, the key is matched like in {@link BAMCacheImpl}, i.e., by comparing the result of
+ * {@link Reducer#getHashCodeForState} for the deserialized key with the one for the current state
+ * and precision. The bytes of the serialized key are never compared, because Java serialization
+ * does not produce a canonical encoding (e.g., for hash-based collections).
+ *
+ * <p>Blocks that are known from the previous run (by the functions of their call nodes) but whose
+ * code changed are reported as invalidated, and their summaries are dropped when the file is
+ * written again. ARG states of a reused summary get fresh state ids, such that they are ordered
+ * after all states that were created before in the current run.
+ *
+ * <p>The file is memory-mapped when it is read, and only the index is parsed eagerly. Keys of a
+ * block are deserialized on the first lookup for the block, and the payload of a summary only if
+ * its key matches. Abstract states and precisions that are not serializable are not persisted.
+ *
+ * <p>File layout (all integers big-endian): magic, version, configuration hash, the number of
+ * blocks followed by (block id, block hash) pairs, the number of entries followed by (block hash,
+ * key length, payload length) triples, and finally the keys and payloads in the order of the index.
+ */
+@Options(prefix = "cpa.bam.persistentCache")
+public class BAMPersistentCache {
+
+  private static final int MAGIC = 0x42414D43; // "BAMC"
+  private static final int VERSION = 3;
+  private static final int HASH_BYTES = 32; // SHA-256
+
+  @Option(
+      name = "file",
+      description =
+          "File for storing block summaries of BAM across several runs of CPAchecker. If the file"
+              + " exists, it is read at startup, and cache misses of BAM are looked up in it."
+              + " After the analysis, all finished block summaries are written back into the"
+              + " file. Summaries are only reused for the same configuration and for blocks whose"
+              + " code did not change. Leave empty to disable the persistent cache.")
+  @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
+  private @Nullable Path file = null;
+
+  /** Position of the key and payload of a stored summary in the mapped file. */
+  private record Slot(HashCode blockHash, int keyOffset, int keyLength, int payloadLength) {
+    int payloadOffset() {
+      return keyOffset + keyLength;
+    }
+  }
+
+  private final LogManager logger;
+  private final CFA cfa;
+  private final ConfigurableProgramAnalysis bamCpa;
+  private final Reducer reducer;
+  private final ReachedSetFactory reachedSetFactory;
+  private final HashCode configHash;
+
+  private final Map<Block, HashCode> blockHashes = new HashMap<>();
+
+  /** Block hashes from the previous run, indexed by block identifier. */
+  private final SetMultimap<String, HashCode> previousBlockHashes = HashMultimap.create();
+
+  private final Set<String> invalidatedBlocks = new LinkedHashSet<>();
+
+  /** Stored summaries from the previous run, indexed by block hash. */
+  private final ListMultimap<HashCode, Slot> index = ArrayListMultimap.create();
+
+  /** Deserialized keys (as returned by the reducer), null if a key could not be deserialized. */
+  private final Map<Slot, Optional<Object>> deserializedKeys = new HashMap<>();
+
+  private @Nullable MappedByteBuffer mappedFile = null;
+
+  private final Timer loadTimer = new Timer();
+  private final Timer lookupTimer = new Timer();
+  private final Timer storeTimer = new Timer();
+  private int lookups = 0;
+  private int hits = 0;
+  private int unserializableKeys = 0;
+  private int unserializableEntries = 0;
+  private int corruptEntries = 0;
+  private int storedEntries = 0;
+
+  public BAMPersistentCache(
+      Configuration pConfig,
+      LogManager pLogger,
+      CFA pCfa,
+      ConfigurableProgramAnalysis pBamCpa,
+      Reducer pReducer,
+      ReachedSetFactory pReachedSetFactory)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    cfa = pCfa;
+    bamCpa = pBamCpa;
+    reducer = pReducer;
+    reachedSetFactory = pReachedSetFactory;
+    configHash =
+        Hashing.sha256()
+            .newHasher()
+            .putString(CPAchecker.getPlainVersion(), UTF_8)
+            .putString(pConfig.asPropertiesString(), UTF_8)
+            .putString(pCfa.getMachineModel().name(), UTF_8)
+            .hash();
+
+    if (file != null && Files.isRegularFile(file)) {
+      loadTimer.start();
+      try {
+        loadIndex(file);
+      } catch (IOException | RuntimeException e) {
+        // a broken cache must never break the analysis
+        logger.logUserException(
+            Level.WARNING, e, "Could not read persistent BAM cache, ignoring it");
+        index.clear();
+        previousBlockHashes.clear();
+        mappedFile = null;
+      } finally {
+        loadTimer.stop();
+      }
+    }
+  }
+
+  public boolean isEnabled() {
+    return file != null;
+  }
+
+  private void loadIndex(Path pFile) throws IOException {
+    try (FileChannel channel = FileChannel.open(pFile, StandardOpenOption.READ)) {
+      mappedFile = channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size());
+    }
+    ByteBuffer buffer = mappedFile;
+    if (buffer.getInt() != MAGIC || buffer.getInt() != VERSION) {
+      throw new IOException("File " + pFile + " is not a BAM cache of the current version");
+    }
+    if (!readHash(buffer).equals(configHash)) {
+      logger.log(Level.INFO, "Persistent BAM cache was created with a different configuration");
+      mappedFile = null;
+      return;
+    }
+
+    int numBlocks = buffer.getInt();
+    for (int i = 0; i < numBlocks; i++) {
+      byte[] id = new byte[buffer.getInt()];
+      buffer.get(id);
+      previousBlockHashes.put(new String(id, UTF_8), readHash(buffer));
+    }
+
+    int numEntries = buffer.getInt();
+    List<HashCode> entryBlocks = new ArrayList<>(numEntries);
+    int[] keyLengths = new int[numEntries];
+    int[] payloadLengths = new int[numEntries];
+    for (int i = 0; i < numEntries; i++) {
+      entryBlocks.add(readHash(buffer));
+      keyLengths[i] = buffer.getInt();
+      payloadLengths[i] = buffer.getInt();
+    }
+    int offset = buffer.position();
+    for (int i = 0; i < numEntries; i++) {
+      Slot slot = new Slot(entryBlocks.get(i), offset, keyLengths[i], payloadLengths[i]);
+      offset += keyLengths[i] + payloadLengths[i];
+      if (offset > buffer.limit()) {
+        throw new IOException("File " + pFile + " is truncated");
+      }
+      index.put(slot.blockHash(), slot);
+    }
+    logger.log(Level.FINE, "Loaded index of persistent BAM cache with", numEntries, "entries");
+  }
+
+  private static HashCode readHash(ByteBuffer pBuffer) {
+    byte[] bytes = new byte[HASH_BYTES];
+    pBuffer.get(bytes);
+    return HashCode.fromBytes(bytes);
+  }
+
+  /**
+   * Identify a block independently of node numbers, such that a changed block can be recognized as
+   * the same block in the next run. Loop blocks in the same function share an identifier.
+   */
+  private static String getBlockId(Block pBlock) {
+    return String.join(
+        ",",
+        ImmutableList.sortedCopyOf(
+            pBlock.getCallNodes().stream().map(CFANode::getFunctionName).distinct().toList()));
+  }
+
+  private HashCode getBlockHash(Block pBlock) {
+    HashCode hash = blockHashes.get(pBlock);
+    if (hash == null) {
+      hash = computeBlockHash(pBlock);
+      blockHashes.put(pBlock, hash);
+      String id = getBlockId(pBlock);
+      if (previousBlockHashes.containsKey(id) && !previousBlockHashes.containsEntry(id, hash)) {
+        invalidatedBlocks.add(id);
+      }
+    }
+    return hash;
+  }
+
+  /**
+   * Compute a hash of the code of a block that does not depend on node numbers or file locations.
+   * Nodes are identified by their position in a breadth-first traversal of the block from its call
+   * nodes, so changes before the block in the file do not change the hash. The hash covers the
+   * declarations and the canonical types that the edges refer to, such that, e.g., changing the
+   * type of a global variable changes the hash of every block that uses the variable.
+   */
+  @VisibleForTesting
+  static HashCode computeBlockHash(Block pBlock) {
+    Set<CFANode> blockNodes = pBlock.getNodes();
+    Map<CFANode, Integer> ids = new HashMap<>();
+    List<CFANode> traversal = new ArrayList<>(blockNodes.size());
+    // nodes that are not reachable from the call nodes follow in the order of their numbers,
+    // which does not change if only code before the block changes
+    for (CFANode start : Iterables.concat(pBlock.getCallNodes(), blockNodes)) {
+      if (ids.containsKey(start)) {
+        continue;
+      }
+      ids.put(start, ids.size());
+      Deque<CFANode> waitlist = new ArrayDeque<>();
+      waitlist.add(start);
+      while (!waitlist.isEmpty()) {
+        CFANode node = waitlist.poll();
+        traversal.add(node);
+        for (CFANode successor : CFAUtils.successorsOf(node)) {
+          if (blockNodes.contains(successor) && !ids.containsKey(successor)) {
+            ids.put(successor, ids.size());
+            waitlist.add(successor);
+          }
+        }
+      }
+    }
+
+    Hasher hasher = Hashing.sha256().newHasher();
+    for (CFANode node : traversal) {
+      hasher
+          .putInt(ids.get(node))
+          .putString(node.getFunctionName(), UTF_8)
+          .putBoolean(pBlock.isCallNode(node))
+          .putBoolean(pBlock.isReturnNode(node));
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        CFANode successor = edge.getSuccessor();
+        if (ids.containsKey(successor)) {
+          hasher.putInt(ids.get(successor));
+        } else {
+          hasher.putInt(-1).putString(successor.getFunctionName(), UTF_8);
+        }
+        hasher
+            .putString(edge.getEdgeType().name(), UTF_8)
+            .putString(edge.getDescription(), UTF_8);
+        for (AAstNode astNode : CFAUtils.getAstNodesFromCfaEdge(edge)) {
+          putReferences(hasher, astNode);
+        }
+      }
+    }
+    return hasher.hash();
+  }
+
+  /** Add the declarations and types that the given AST refers to. */
+  private static void putReferences(Hasher pHasher, AAstNode pAstNode) {
+    for (AAstNode astNode : CFAUtils.traverseRecursively(pAstNode)) {
+      if (astNode instanceof AIdExpression idExpression && idExpression.getDeclaration() != null) {
+        putDeclaration(pHasher, idExpression.getDeclaration());
+      } else if (astNode instanceof ASimpleDeclaration declaration) {
+        putDeclaration(pHasher, declaration);
+      }
+      if (astNode instanceof ARightHandSide rightHandSide) {
+        putType(pHasher, rightHandSide.getExpressionType());
+      }
+    }
+  }
+
+  private static void putDeclaration(Hasher pHasher, ASimpleDeclaration pDeclaration) {
+    pHasher.putString(Strings.nullToEmpty(pDeclaration.getQualifiedName()), UTF_8);
+    putType(pHasher, pDeclaration.getType());
+  }
+
+  private static void putType(Hasher pHasher, Type pType) {
+    // the canonical type of a struct contains the types of its members
+    Type type = pType instanceof CType cType ? cType.getCanonicalType() : pType;
+    pHasher.putString(type.toASTString(""), UTF_8);
+  }
+
+  private static AbstractState unwrapKey(AbstractState pStateKey) {
+    // the reduced initial state is the root of the block's ARG,
+    // do not serialize the whole ARG as part of the key
+    return pStateKey instanceof ARGState argState ? argState.getWrappedState() : pStateKey;
+  }
+
+  /** Serialize the key of a summary, or return null if the key cannot be serialized. */
+  private @Nullable byte[] serializeKey(AbstractState pStateKey, Precision pPrecisionKey) {
+    ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+    try (ObjectOutputStream out = new ObjectOutputStream(bytes)) {
+      out.writeObject(unwrapKey(pStateKey));
+      out.writeObject(pPrecisionKey);
+    } catch (IOException e) {
+      logger.logDebugException(e, "Could not serialize key for persistent BAM cache");
+      unserializableKeys++;
+      return null;
+    }
+    return bytes.toByteArray();
+  }
+
+  /**
+   * Return the key of a stored summary in the form that is compared by {@link BAMCacheImpl}, or
+   * empty if the key cannot be deserialized.
+   */
+  private Optional<Object> getStoredKey(Slot pSlot) {
+    return deserializedKeys.computeIfAbsent(
+        pSlot,
+        slot -> {
+          byte[] bytes = new byte[slot.keyLength()];
+          mappedFile.get(slot.keyOffset(), bytes);
+          try (ObjectInputStream in = new ObjectInputStream(new ByteArrayInputStream(bytes))) {
+            AbstractState state = (AbstractState) in.readObject();
+            Precision precision = (Precision) in.readObject();
+            return Optional.of(reducer.getHashCodeForState(state, precision));
+          } catch (IOException | ClassNotFoundException | ClassCastException e) {
+            logger.logDebugException(e, "Could not deserialize key of persistent BAM cache");
+            corruptEntries++;
+            return Optional.empty();
+          }
+        });
+  }
+
+  /** Find the stored summary of the given block whose key is equal to the given key. */
+  private @Nullable Slot findSlot(Object pKey, HashCode pBlockHash) {
+    for (Slot slot : index.get(pBlockHash)) {
+      if (getStoredKey(slot).map(pKey::equals).orElse(false)) {
+        return slot;
+      }
+    }
+    return null;
+  }
+
+  /**
+   * Look up a finished block summary from a previous run. The returned entry has a fresh reached
+   * set that contains the deserialized ARG of the block, and its exit states are set.
+   */
+  @Nullable BAMCacheEntry lookup(AbstractState pStateKey, Precision pPrecisionKey, Block pContext) {
+    if (index.isEmpty()) {
+      return null;
+    }
+    lookupTimer.start();
+    SerializationInfoStorage.storeSerializationInformation(bamCpa, cfa);
+    try {
+      lookups++;
+      HashCode blockHash = getBlockHash(pContext);
+      Slot slot =
+          findSlot(reducer.getHashCodeForState(unwrapKey(pStateKey), pPrecisionKey), blockHash);
+      if (slot == null) {
+        return null;
+      }
+      BAMCacheEntry entry = deserializeEntry(slot);
+      if (entry == null) {
+        // do not try again
+        index.remove(blockHash, slot);
+        return null;
+      }
+      hits++;
+      return entry;
+    } finally {
+      SerializationInfoStorage.clear();
+      lookupTimer.stop();
+    }
+  }
+
+  private @Nullable BAMCacheEntry deserializeEntry(Slot pSlot) {
+    byte[] payload = new byte[pSlot.payloadLength()];
+    mappedFile.get(pSlot.payloadOffset(), payload);
+
+    List<AbstractState> states;
+    List<Precision> precisions;
+    List<Integer> exitStatePositions;
+    try (ObjectInputStream in = new ObjectInputStream(new ByteArrayInputStream(payload))) {
+      int numStates = in.readInt();
+      states = new ArrayList<>(numStates);
+      precisions = new ArrayList<>(numStates);
+      for (int i = 0; i < numStates; i++) {
+        states.add((AbstractState) in.readObject());
+        precisions.add((Precision) in.readObject());
+      }
+      int numExitStates = in.readInt();
+      exitStatePositions = new ArrayList<>(numExitStates);
+      for (int i = 0; i < numExitStates; i++) {
+        exitStatePositions.add(in.readInt());
+      }
+    } catch (IOException | ClassNotFoundException | ClassCastException e) {
+      logger.logDebugException(e, "Could not deserialize entry of persistent BAM cache");
+      corruptEntries++;
+      return null;
+    }
+
+    states = reviveARG(states);
+    ReachedSet reached = reachedSetFactory.create(bamCpa);
+    for (int i = 0; i < states.size(); i++) {
+      reached.add(states.get(i), precisions.get(i));
+    }
+    Set<AbstractState> exitStates = new LinkedHashSet<>();
+    for (int position : exitStatePositions) {
+      exitStates.add(states.get(position));
+    }
+
+    // the block was completely analyzed in the previous run
+    reached.clearWaitlist();
+    BAMCacheEntry entry = new BAMCacheEntry(reached);
+    entry.setExitStates(exitStates);
+    if (reached.getFirstState() instanceof ARGState root) {
+      entry.setRootOfBlock(root);
+    }
+    return entry;
+  }
+
+  /**
+   * Replace the deserialized ARG states in the given list by copies with fresh state ids. The
+   * deserialized states keep the ids of the previous run, which collide with ids of the current run
+   * and would break the ordering of ARG states by creation. The copies are created in the order of
+   * the original ids, and parent, child, and coverage relations between the given states are
+   * restored. States that are no ARG states are kept.
+   */
+  static List<AbstractState> reviveARG(List<AbstractState> pStates) {
+    Map<ARGState, ARGState> copies = new LinkedHashMap<>();
+    for (ARGState state : ImmutableList.sortedCopyOf(Iterables.filter(pStates, ARGState.class))) {
+      ARGState copy = new ARGState(state.getWrappedState(), null);
+      copy.makeTwinOf(state);
+      copies.put(state, copy);
+    }
+    for (Map.Entry<ARGState, ARGState> e : copies.entrySet()) {
+      for (ARGState parent : e.getKey().getParents()) {
+        ARGState parentCopy = copies.get(parent);
+        if (parentCopy != null) {
+          e.getValue().addParent(parentCopy);
+        }
+      }
+    }
+    for (Map.Entry<ARGState, ARGState> e : copies.entrySet()) {
+      if (e.getKey().isCovered()) {
+        ARGState coveringCopy = copies.get(e.getKey().getCoveringState());
+        if (coveringCopy != null) {
+          e.getValue().setCovered(coveringCopy);
+        }
+      }
+    }
+    List<AbstractState> result = new ArrayList<>(pStates.size());
+    for (AbstractState state : pStates) {
+      result.add(state instanceof ARGState argState ? copies.get(argState) : state);
+    }
+    return result;
+  }
+
+  private @Nullable byte[] serializeEntry(BAMCacheEntry pEntry) {
+    ReachedSet reached = pEntry.getReachedSet();
+    Map<AbstractState, Integer> positions = new HashMap<>();
+    ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+    try (ObjectOutputStream out = new ObjectOutputStream(bytes)) {
+      out.writeInt(reached.size());
+      for (AbstractState state : reached) {
+        positions.put(state, positions.size());
+        out.writeObject(state);
+        out.writeObject(reached.getPrecision(state));
+      }
+      out.writeInt(pEntry.getExitStates().size());
+      for (AbstractState exitState : pEntry.getExitStates()) {
+        out.writeInt(positions.get(exitState));
+      }
+    } catch (IOException e) {
+      logger.logDebugException(e, "Could not serialize entry for persistent BAM cache");
+      unserializableEntries++;
+      return null;
+    }
+    return bytes.toByteArray();
+  }
+
+  private static boolean isFinished(BAMCacheEntry pEntry) {
+    return pEntry.getExitStates() != null
+        && !pEntry.getReachedSet().hasWaitingState()
+        && pEntry.getExitStates().stream().noneMatch(s -> ((ARGState) s).isDestroyed());
+  }
+
+  /** A summary of the current run that is written into the cache file. */
+  private static final class NewEntry {
+    private final HashCode blockHash;
+    private final byte[] key;
+    private final byte[] payload;
+
+    private NewEntry(HashCode pBlockHash, byte[] pKey, byte[] pPayload) {
+      blockHash = pBlockHash;
+      key = pKey;
+      payload = pPayload;
+    }
+  }
+
+  /**
+   * Write all finished summaries of the current run and all still valid summaries of the previous
+   * run back into the cache file. The file is replaced atomically.
+   *
+   * @param pEntries the entries of the in-memory cache, with the key from which they were created
+   */
+  void store(Map<BAMCacheImpl.AbstractStateHash, BAMCacheEntry> pEntries) {
+    if (file == null) {
+      return;
+    }
+    storeTimer.start();
+    SerializationInfoStorage.storeSerializationInformation(bamCpa, cfa);
+    try {
+      Set<Slot> oldEntries = new LinkedHashSet<>(index.values());
+      List<NewEntry> newEntries = new ArrayList<>();
+      for (Map.Entry<BAMCacheImpl.AbstractStateHash, BAMCacheEntry> e : pEntries.entrySet()) {
+        if (!isFinished(e.getValue())) {
+          continue;
+        }
+        BAMCacheImpl.AbstractStateHash cacheKey = e.getKey();
+        HashCode blockHash = getBlockHash(cacheKey.context);
+        byte[] key = serializeKey(cacheKey.stateKey, cacheKey.precisionKey);
+        if (key == null) {
+          continue;
+        }
+        byte[] payload = serializeEntry(e.getValue());
+        if (payload != null) {
+          newEntries.add(new NewEntry(blockHash, key, payload));
+          // the new entry supersedes a stored entry with the same key
+          oldEntries.remove(
+              findSlot(
+                  reducer.getHashCodeForState(unwrapKey(cacheKey.stateKey), cacheKey.precisionKey),
+                  blockHash));
+        }
+      }
+
+      // summaries of changed blocks are not needed anymore
+      Set<HashCode> staleBlockHashes = new LinkedHashSet<>();
+      for (String id : invalidatedBlocks) {
+        staleBlockHashes.addAll(previousBlockHashes.get(id));
+      }
+      oldEntries.removeIf(slot -> staleBlockHashes.contains(slot.blockHash()));
+
+      SetMultimap<String, HashCode> blocks = HashMultimap.create(previousBlockHashes);
+      blocks.keySet().removeAll(invalidatedBlocks);
+      blockHashes.forEach((block, hash) -> blocks.put(getBlockId(block), hash));
+
+      Path tmpFile = file.resolveSibling(file.getFileName() + ".tmp");
+      try (OutputStream os = Files.newOutputStream(tmpFile);
+          DataOutputStream out = new DataOutputStream(new BufferedOutputStream(os))) {
+        out.writeInt(MAGIC);
+        out.writeInt(VERSION);
+        out.write(configHash.asBytes());
+
+        out.writeInt(blocks.size());
+        for (Map.Entry<String, HashCode> block : blocks.entries()) {
+          byte[] id = block.getKey().getBytes(UTF_8);
+          out.writeInt(id.length);
+          out.write(id);
+          out.write(block.getValue().asBytes());
+        }
+
+        out.writeInt(oldEntries.size() + newEntries.size());
+        for (Slot old : oldEntries) {
+          out.write(old.blockHash().asBytes());
+          out.writeInt(old.keyLength());
+          out.writeInt(old.payloadLength());
+        }
+        for (NewEntry fresh : newEntries) {
+          out.write(fresh.blockHash.asBytes());
+          out.writeInt(fresh.key.length);
+          out.writeInt(fresh.payload.length);
+        }
+
+        for (Slot old : oldEntries) {
+          byte[] keyAndPayload = new byte[old.keyLength() + old.payloadLength()];
+          mappedFile.get(old.keyOffset(), keyAndPayload);
+          out.write(keyAndPayload);
+        }
+        for (NewEntry fresh : newEntries) {
+          out.write(fresh.key);
+          out.write(fresh.payload);
+        }
+      }
+      Files.move(
+          tmpFile, file, StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+      storedEntries = oldEntries.size() + newEntries.size();
+
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write persistent BAM cache");
+    } finally {
+      SerializationInfoStorage.clear();
+      storeTimer.stop();
+    }
+  }
+
+  void printStatistics(PrintStream out) {
+    out.println("Persistent cache file:                               " + file);
+    out.println("  Number of entries from previous runs:              " + index.size());
+    out.println(
+        "  Number of persistent cache hits:                   "
+            + hits
+            + " ("
+            + toPercent(hits, lookups)
+            + " of all lookups)");
+    out.println("  Number of invalidated blocks:                      " + invalidatedBlocks.size());
+    out.println("  Number of unserializable keys:                     " + unserializableKeys);
+    out.println("  Number of unserializable entries:                  " + unserializableEntries);
+    if (corruptEntries > 0) {
+      out.println("  Number of unreadable entries:                      " + corruptEntries);
+    }
+    out.println("  Number of stored entries:                          " + storedEntries);
+    out.println("  Time for loading index:                            " + loadTimer);
+    out.println("  Time for lookups:                                  " + lookupTimer);
+    out.println("  Time for storing:                                  " + storeTimer);
+  }
+}
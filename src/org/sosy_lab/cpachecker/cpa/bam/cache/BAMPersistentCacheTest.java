@@ -0,0 +1,168 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.bam.cache;
+
+import static com.google.common.truth.Truth.assertThat;
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.collect.FluentIterable;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.hash.HashCode;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.io.PrintStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.util.test.CPATestRunner;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+import org.sosy_lab.cpachecker.util.test.TestResults;
+
+public class BAMPersistentCacheTest {
+
+  private static final String CONFIG = "config/valueAnalysis-bam.properties";
+  private static final String PROGRAM = "test/programs/bam/persistent-cache.c";
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  @Test
+  public void testRevivedStatesGetFreshIds() throws Exception {
+    ARGState root = new ARGState(null, null);
+    ARGState left = new ARGState(null, root);
+    ARGState right = new ARGState(null, root);
+    ARGState leftChild = new ARGState(null, left);
+    leftChild.setCovered(right);
+    right.markExpanded();
+
+    ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+    try (ObjectOutputStream out = new ObjectOutputStream(bytes)) {
+      for (ARGState state : ImmutableList.of(root, left, right, leftChild)) {
+        out.writeObject(state);
+      }
+    }
+    List<AbstractState> deserialized = new ArrayList<>();
+    try (ObjectInputStream in =
+        new ObjectInputStream(new ByteArrayInputStream(bytes.toByteArray()))) {
+      for (int i = 0; i < 4; i++) {
+        deserialized.add((AbstractState) in.readObject());
+      }
+    }
+    // deserialized states keep the ids of the serialized states
+    assertThat(((ARGState) deserialized.get(0)).getStateId()).isEqualTo(root.getStateId());
+
+    ARGState current = new ARGState(null, null);
+    List<AbstractState> revived = BAMPersistentCache.reviveARG(deserialized);
+    assertThat(revived).hasSize(4);
+    ARGState newRoot = (ARGState) revived.get(0);
+    ARGState newLeft = (ARGState) revived.get(1);
+    ARGState newRight = (ARGState) revived.get(2);
+    ARGState newLeftChild = (ARGState) revived.get(3);
+
+    for (AbstractState state : revived) {
+      assertThat(deserialized).doesNotContain(state);
+      assertThat(current.isOlderThan((ARGState) state)).isTrue();
+    }
+    assertThat(revived).isInStrictOrder();
+    assertThat(newRoot.getParents()).isEmpty();
+    assertThat(newRoot.getChildren()).containsExactly(newLeft, newRight).inOrder();
+    assertThat(newLeft.getChildren()).containsExactly(newLeftChild);
+    assertThat(newLeftChild.getCoveringState()).isSameInstanceAs(newRight);
+    assertThat(newRight.wasExpanded()).isTrue();
+    assertThat(newLeft.wasExpanded()).isFalse();
+  }
+
+  /** Compute the hash of a block that consists of the function f of the given program. */
+  private static HashCode hashOfFunctionF(String... pProgram) throws Exception {
+    CFA cfa = TestDataTools.makeCFA(pProgram);
+    FunctionEntryNode entry = cfa.getFunctionHead("f");
+    Block block =
+        new Block(
+            ImmutableSet.of(),
+            ImmutableSet.of(entry),
+            ImmutableSet.of(entry.getExitNode().orElseThrow()),
+            FluentIterable.from(cfa.nodes()).filter(node -> node.getFunctionName().equals("f")));
+    return BAMPersistentCache.computeBlockHash(block);
+  }
+
+  @Test
+  public void testBlockHash() throws Exception {
+    HashCode original =
+        hashOfFunctionF("int x;", "int f() { return x + 1; }", "int main() { f(); }");
+
+    // the edges of f are the same, but the type of the global variable differs
+    assertThat(hashOfFunctionF("char x;", "int f() { return x + 1; }", "int main() { f(); }"))
+        .isNotEqualTo(original);
+
+    // code before f changes the node numbers and locations of f, but not its hash
+    assertThat(
+            hashOfFunctionF(
+                "int y;",
+                "int g() { if (y) { return 1; } return y; }",
+                "int x;",
+                "int f() { return x + 1; }",
+                "int main() { g(); f(); }"))
+        .isEqualTo(original);
+  }
+
+  private TestResults run(Path pCacheFile) throws Exception {
+    Configuration config =
+        TestDataTools.configurationForTest()
+            .loadFromFile(CONFIG)
+            .setOption("analysis.algorithm.CEGAR", "false")
+            .setOption("cpa.bam.persistentCache.file", pCacheFile.toString())
+            .build();
+    TestResults results = CPATestRunner.run(config, PROGRAM);
+    results.getCheckerResult().writeOutputFiles();
+    return results;
+  }
+
+  private static int getStatistic(TestResults pResults, String pName) {
+    ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+    try (PrintStream out = new PrintStream(bytes, true, UTF_8)) {
+      pResults.getCheckerResult().printStatistics(out);
+    }
+    Matcher matcher =
+        Pattern.compile(Pattern.quote(pName) + ":\\s+(\\d+)").matcher(bytes.toString(UTF_8));
+    assertThat(matcher.find()).isTrue();
+    return Integer.parseInt(matcher.group(1));
+  }
+
+  @Test
+  public void testRoundTrip() throws Exception {
+    Path cacheFile = tempFolder.getRoot().toPath().resolve("bam.cache");
+
+    TestResults first = run(cacheFile);
+    first.assertIsSafe();
+    assertThat(Files.isRegularFile(cacheFile)).isTrue();
+    int stored = getStatistic(first, "Number of stored entries");
+    assertThat(stored).isGreaterThan(0);
+
+    // the second run reuses the summaries and stores them again, without duplicates
+    TestResults second = run(cacheFile);
+    second.assertIsSafe();
+    assertThat(getStatistic(second, "Number of entries from previous runs")).isEqualTo(stored);
+    assertThat(getStatistic(second, "Number of persistent cache hits")).isGreaterThan(0);
+    assertThat(getStatistic(second, "Number of stored entries")).isEqualTo(stored);
+  }
+}
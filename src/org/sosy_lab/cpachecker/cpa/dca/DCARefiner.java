@@ -267,7 +267,8 @@ public class DCARefiner implements Refiner, StatisticsProvider, AutoCloseable {
             pLogger,
             pNotifier,
             new PredicateAbstractionStatistics(),
-            TrivialInvariantSupplier.INSTANCE);
+            TrivialInvariantSupplier.INSTANCE,
+            null);
 
     itpAutomatonBuilder =
         new InterpolationAutomatonBuilder(
@@ -58,6 +58,15 @@ public final class OctagonCPA implements ConfigurableProgramAnalysis {
       description = "this option determines which initial precision should be used")
   private String precisionType = "STATIC_FULL";
 
+  @Option(
+      secure = true,
+      name = "memoizeClosure",
+      description =
+          "keep a reference to the closure of every octagon in its Java object."
+              + " The closure is cached by the native library in any case,"
+              + " this only avoids a native call for every request.")
+  private boolean memoizeClosure = true;
+
   private final AbstractDomain abstractDomain;
   private final TransferRelation transferRelation;
   private final MergeOperator mergeOperator;
@@ -80,9 +89,9 @@ public final class OctagonCPA implements ConfigurableProgramAnalysis {
     OctagonDomain octagonDomain = new OctagonDomain(logger);
 
     if (octagonLibrary.equals("FLOAT")) {
-      octagonManager = new OctagonFloatManager();
+      octagonManager = new OctagonFloatManager(memoizeClosure);
     } else {
-      octagonManager = new OctagonIntManager();
+      octagonManager = new OctagonIntManager(memoizeClosure);
     }
 
     transferRelation = new OctagonTransferRelation(logger, cfa.getLoopStructure().orElseThrow());
@@ -31,7 +31,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
 import org.sosy_lab.cpachecker.util.Pair;
-import org.sosy_lab.cpachecker.util.octagon.NumArray;
+import org.sosy_lab.cpachecker.util.octagon.NumBuffer;
 import org.sosy_lab.cpachecker.util.octagon.Octagon;
 import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
@@ -340,21 +340,17 @@ public class OctagonState implements AbstractState {
       return this;
     }
 
-    NumArray arr = oct.getNumArray(octagonManager);
     int varIdx = getVariableIndexFor(leftVarName);
 
     if (varIdx == -1) {
       return this;
     }
 
-    OctagonState newState =
-        new OctagonState(
-            octagonManager.assingVar(octagon, varIdx, arr),
-            HashBiMap.create(variableToIndexMap),
-            new HashMap<>(variableToTypeMap),
-            logger);
-    octagonManager.num_clear_n(arr, oct.size());
-    return newState;
+    return new OctagonState(
+        octagonManager.assignVar(octagon, varIdx, oct.getNumBuffer()),
+        HashBiMap.create(variableToIndexMap),
+        new HashMap<>(variableToTypeMap),
+        logger);
   }
 
   /**
@@ -368,44 +364,35 @@ public class OctagonState implements AbstractState {
       return this;
     }
 
-    NumArray arr = oct.getNumArray(octagonManager);
     int varIdx = getVariableIndexFor(leftVarName);
 
     if (varIdx == -1) {
       return this;
     }
 
-    OctagonState newState =
-        new OctagonState(
-            octagonManager.intervAssingVar(octagon, varIdx, arr),
-            HashBiMap.create(variableToIndexMap),
-            new HashMap<>(variableToTypeMap),
-            logger);
-    octagonManager.num_clear_n(arr, oct.size());
-    return newState;
+    return new OctagonState(
+        octagonManager.intervAssignVar(octagon, varIdx, oct.getNumBuffer()),
+        HashBiMap.create(variableToIndexMap),
+        new HashMap<>(variableToTypeMap),
+        logger);
   }
 
   /** Helper method for all addXXXXConstraint methods */
   private OctagonState addConstraint(
       BinaryConstraints cons, int leftIndex, int rightIndex, OctagonNumericValue constantValue) {
-    NumArray arr = octagonManager.init_num_t(4);
-    octagonManager.num_set_int(arr, 0, cons.getNumber());
-    octagonManager.num_set_int(arr, 1, leftIndex);
-    octagonManager.num_set_int(arr, 2, rightIndex);
+    NumBuffer constraint =
+        new NumBuffer(4).putInt(cons.getNumber()).putInt(leftIndex).putInt(rightIndex);
     if (constantValue instanceof OctagonDoubleValue) {
-      octagonManager.num_set_float(arr, 3, constantValue.getValue().doubleValue());
+      constraint.putFloat(constantValue.getValue().doubleValue());
     } else {
-      octagonManager.num_set_int(arr, 3, constantValue.getValue().longValue());
+      constraint.putInt(constantValue.getValue().longValue());
     }
 
-    OctagonState newState =
-        new OctagonState(
-            octagonManager.addBinConstraint(octagon, 1, arr),
-            HashBiMap.create(variableToIndexMap),
-            new HashMap<>(variableToTypeMap),
-            logger);
-    octagonManager.num_clear_n(arr, 4);
-    return newState;
+    return new OctagonState(
+        octagonManager.addBinConstraints(octagon, constraint),
+        HashBiMap.create(variableToIndexMap),
+        new HashMap<>(variableToTypeMap),
+        logger);
   }
 
   /**
@@ -11,8 +11,7 @@ package org.sosy_lab.cpachecker.cpa.octagon.coefficients;
 import org.sosy_lab.cpachecker.cpa.octagon.OctagonState;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
-import org.sosy_lab.cpachecker.util.octagon.NumArray;
-import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
+import org.sosy_lab.cpachecker.util.octagon.NumBuffer;
 
 /**
  * Class for representing Coeffecients which show the value of a variable dependant on all other
@@ -21,8 +20,8 @@ import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
 @SuppressWarnings("rawtypes")
 public interface IOctagonCoefficients {
 
-  /** Creates a NumArray out of the coefficient array. */
-  NumArray getNumArray(OctagonManager manager);
+  /** Creates a NumBuffer out of the coefficient array. */
+  NumBuffer getNumBuffer();
 
   /** Returns the size of the coefficient list. */
   int size();
@@ -16,8 +16,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonDoubleValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
-import org.sosy_lab.cpachecker.util.octagon.NumArray;
-import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
+import org.sosy_lab.cpachecker.util.octagon.NumBuffer;
 
 @SuppressWarnings("rawtypes")
 public class OctagonIntervalCoefficients extends AOctagonCoefficients {
@@ -402,32 +401,28 @@ public class OctagonIntervalCoefficients extends AOctagonCoefficients {
   }
 
   @Override
-  public NumArray getNumArray(OctagonManager manager) {
-    NumArray arr = manager.init_num_t(coefficients.length * 2);
-    for (int i = 0; i < coefficients.length; i++) {
-      OctagonNumericValue low = coefficients[i].getLow();
-      OctagonNumericValue high = coefficients[i].getHigh();
+  public NumBuffer getNumBuffer() {
+    NumBuffer buffer = new NumBuffer(coefficients.length * 2);
+    for (OctagonInterval coefficient : coefficients) {
+      OctagonNumericValue low = coefficient.getLow();
+      OctagonNumericValue high = coefficient.getHigh();
 
-      if (low.isInfinite()) {
-        manager.num_set_inf(arr, i * 2 + 1);
+      if (high.isInfinite()) {
+        buffer.putInfinity();
+      } else if (high instanceof OctagonDoubleValue) {
+        buffer.putFloat(high.getValue().doubleValue());
       } else {
-        if (low instanceof OctagonDoubleValue) {
-          manager.num_set_float(arr, i * 2 + 1, low.getValue().doubleValue() * -1);
-        } else {
-          manager.num_set_int(arr, i * 2 + 1, low.getValue().longValue() * -1);
-        }
+        buffer.putInt(high.getValue().longValue());
       }
 
-      if (high.isInfinite()) {
-        manager.num_set_inf(arr, i * 2);
+      if (low.isInfinite()) {
+        buffer.putInfinity();
+      } else if (low instanceof OctagonDoubleValue) {
+        buffer.putFloat(low.getValue().doubleValue() * -1);
       } else {
-        if (high instanceof OctagonDoubleValue) {
-          manager.num_set_float(arr, i * 2, high.getValue().doubleValue());
-        } else {
-          manager.num_set_int(arr, i * 2, high.getValue().longValue());
-        }
+        buffer.putInt(low.getValue().longValue() * -1);
       }
     }
-    return arr;
+    return buffer;
   }
 }
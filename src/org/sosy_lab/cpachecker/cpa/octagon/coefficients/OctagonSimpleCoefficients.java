@@ -16,8 +16,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonDoubleValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
-import org.sosy_lab.cpachecker.util.octagon.NumArray;
-import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
+import org.sosy_lab.cpachecker.util.octagon.NumBuffer;
 
 @SuppressWarnings("rawtypes")
 public class OctagonSimpleCoefficients extends AOctagonCoefficients {
@@ -408,15 +407,15 @@ public class OctagonSimpleCoefficients extends AOctagonCoefficients {
 
   /** {@inheritDoc} */
   @Override
-  public NumArray getNumArray(OctagonManager manager) {
-    NumArray arr = manager.init_num_t(coefficients.length);
-    for (int i = 0; i < coefficients.length; i++) {
-      if (coefficients[i] instanceof OctagonDoubleValue) {
-        manager.num_set_float(arr, i, coefficients[i].getValue().doubleValue());
+  public NumBuffer getNumBuffer() {
+    NumBuffer buffer = new NumBuffer(coefficients.length);
+    for (OctagonNumericValue coefficient : coefficients) {
+      if (coefficient instanceof OctagonDoubleValue) {
+        buffer.putFloat(coefficient.getValue().doubleValue());
       } else {
-        manager.num_set_int(arr, i, coefficients[i].getValue().longValue());
+        buffer.putInt(coefficient.getValue().longValue());
       }
     }
-    return arr;
+    return buffer;
   }
 }
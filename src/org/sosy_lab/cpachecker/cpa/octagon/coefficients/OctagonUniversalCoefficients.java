@@ -11,8 +11,7 @@ package org.sosy_lab.cpachecker.cpa.octagon.coefficients;
 import org.sosy_lab.cpachecker.cpa.octagon.OctagonState;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
-import org.sosy_lab.cpachecker.util.octagon.NumArray;
-import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
+import org.sosy_lab.cpachecker.util.octagon.NumBuffer;
 
 @SuppressWarnings("rawtypes")
 public final class OctagonUniversalCoefficients extends AOctagonCoefficients {
@@ -75,7 +74,7 @@ public final class OctagonUniversalCoefficients extends AOctagonCoefficients {
   }
 
   @Override
-  public NumArray getNumArray(OctagonManager manager) {
+  public NumBuffer getNumBuffer() {
     return null;
   }
 
@@ -0,0 +1,186 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.predicate;
+
+import static com.google.common.base.Preconditions.checkArgument;
+import static com.google.common.base.Preconditions.checkState;
+
+import com.google.common.collect.ImmutableList;
+import java.util.ArrayList;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer.TimerWrapper;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
+import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
+
+/**
+ * Long-lived incremental prover environments for the computation of predicate abstractions.
+ *
+ * <p>Without this, each abstraction computation creates a fresh prover environment and asserts the
+ * whole formula. With this, the formula is split into its conjuncts, which are asserted on separate
+ * levels of the prover stack of a session. The next abstraction computation in the same session
+ * pops only the conjuncts after the longest common prefix with its own conjuncts, and pushes the
+ * rest. The solver thus keeps what it has learned about the common prefix. There is either a
+ * single session, which follows the exploration along a path, or one session per abstraction
+ * location.
+ *
+ * <p>A session is used by at most one abstraction computation at a time. If it is busy (because
+ * several threads share this instance), the caller has to fall back to a fresh prover environment.
+ */
+final class AbstractionProverSessions implements AutoCloseable {
+
+  enum ProverReuse {
+    /** Create a fresh prover environment for each abstraction computation. */
+    NONE,
+    /** Use a single session for all abstraction computations. */
+    PER_PATH,
+    /** Use one session per abstraction location. */
+    PER_LOCATION,
+  }
+
+  /** A prover environment together with the conjuncts on its stack, one per level. */
+  final class Session {
+
+    private final ProverEnvironment prover =
+        solver.newProverEnvironment(ProverOptions.GENERATE_ALL_SAT);
+    private final List<BooleanFormula> stack = new ArrayList<>();
+    private boolean inUse = false;
+
+    /**
+     * Bring the prover stack into a state where exactly the conjuncts of the given formula are
+     * asserted, and return the prover. Additional levels that the caller pushes are removed when
+     * the session is released.
+     */
+    ProverEnvironment assertFormula(BooleanFormula pFormula) throws InterruptedException {
+      List<BooleanFormula> conjuncts =
+          ImmutableList.copyOf(bfmgr.toConjunctionArgs(pFormula, true));
+
+      int common = 0;
+      while (common < stack.size()
+          && common < conjuncts.size()
+          && stack.get(common).equals(conjuncts.get(common))) {
+        common++;
+      }
+      while (stack.size() > common) {
+        prover.pop();
+        stack.remove(stack.size() - 1);
+      }
+
+      assertionTimer.start();
+      try {
+        for (BooleanFormula conjunct : conjuncts.subList(common, conjuncts.size())) {
+          prover.push(conjunct);
+          stack.add(conjunct);
+        }
+      } finally {
+        assertionTimer.stop();
+      }
+      stats.numIncrementalConjunctsAsserted.addAndGet(conjuncts.size() - common);
+      stats.numIncrementalConjunctsReused.addAndGet(common);
+      return prover;
+    }
+
+    private void cleanUp() throws InterruptedException {
+      while (prover.size() > stack.size()) {
+        prover.pop();
+      }
+    }
+  }
+
+  private final Solver solver;
+  private final BooleanFormulaManagerView bfmgr;
+  private final ProverReuse mode;
+  private final int maxSessions;
+  private final PredicateAbstractionStatistics stats;
+  private final TimerWrapper assertionTimer;
+
+  /** Sessions in least-recently-used order, the key is null for {@link ProverReuse#PER_PATH}. */
+  private final Map<Object, Session> sessions = new LinkedHashMap<>(16, 0.75f, true);
+
+  AbstractionProverSessions(
+      Solver pSolver, ProverReuse pMode, int pMaxSessions, PredicateAbstractionStatistics pStats) {
+    checkArgument(pMode != ProverReuse.NONE);
+    checkArgument(pMaxSessions > 0, "at least one prover session is necessary");
+    solver = pSolver;
+    bfmgr = pSolver.getFormulaManager().getBooleanFormulaManager();
+    mode = pMode;
+    maxSessions = pMaxSessions;
+    stats = pStats;
+    assertionTimer = stats.incrementalAssertionTime.getNewTimer();
+  }
+
+  /**
+   * Get the session for an abstraction computation at the given location, or null if the session
+   * is currently in use. The session needs to be released with {@link #release(Session, boolean)}.
+   */
+  synchronized @Nullable Session acquire(@Nullable Object pLocation) {
+    Object key = mode == ProverReuse.PER_LOCATION ? pLocation : null;
+    Session session = sessions.get(key);
+    if (session == null) {
+      session = new Session();
+      session.inUse = true;
+      sessions.put(key, session);
+      evictSessions();
+      return session;
+    }
+    if (session.inUse) {
+      return null;
+    }
+    session.inUse = true;
+    return session;
+  }
+
+  /** Close the least-recently-used sessions that are not in use if there are too many. */
+  private void evictSessions() {
+    Iterator<Session> it = sessions.values().iterator();
+    while (sessions.size() > maxSessions && it.hasNext()) {
+      Session session = it.next();
+      if (!session.inUse) {
+        session.prover.close();
+        it.remove();
+      }
+    }
+  }
+
+  /**
+   * Release a session after an abstraction computation. If the computation did not finish
+   * successfully, the state of the prover is unknown and the session is discarded.
+   */
+  synchronized void release(Session pSession, boolean pSuccess) throws InterruptedException {
+    checkState(pSession.inUse);
+    pSession.inUse = false;
+    if (pSuccess) {
+      try {
+        pSession.cleanUp();
+        return;
+      } catch (InterruptedException e) {
+        discard(pSession);
+        throw e;
+      }
+    }
+    discard(pSession);
+  }
+
+  private void discard(Session pSession) {
+    pSession.prover.close();
+    sessions.values().removeIf(session -> session == pSession);
+  }
+
+  @Override
+  public synchronized void close() {
+    sessions.values().forEach(session -> session.prover.close());
+    sessions.clear();
+  }
+}
@@ -14,6 +14,7 @@ import static com.google.common.base.Predicates.equalTo;
 import com.google.common.base.Functions;
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
@@ -63,6 +64,7 @@ import org.sosy_lab.cpachecker.util.predicates.regions.RegionCreator;
 import org.sosy_lab.cpachecker.util.predicates.regions.RegionCreator.RegionBuilder;
 import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.PersistentQueryCache;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.cpachecker.util.predicates.weakening.InductiveWeakeningManager;
 import org.sosy_lab.cpachecker.util.predicates.weakening.WeakeningOptions;
@@ -114,6 +116,12 @@ public class PredicateAbstractionManager {
   // 1: predicate is true
   private final Map<Pair<BooleanFormula, AbstractionPredicate>, Byte> cartesianAbstractionCache;
 
+  // cache for all of the above from previous runs, null if disabled
+  private final @Nullable PersistentQueryCache persistentCache;
+
+  // incremental prover environments, null if disabled
+  private final @Nullable AbstractionProverSessions proverSessions;
+
   // Statistics
   private final TimerWrapper trivialPredicatesTimer;
   private final TimerWrapper quantifierEliminationTimer;
@@ -135,7 +143,8 @@ public class PredicateAbstractionManager {
       LogManager pLogger,
       ShutdownNotifier pShutdownNotifier,
       PredicateAbstractionStatistics pAbstractionStats,
-      InvariantSupplier pInvariantsSupplier) {
+      InvariantSupplier pInvariantsSupplier,
+      @Nullable AbstractionProverSessions pProverSessions) {
     shutdownNotifier = pShutdownNotifier;
 
     options = pOptions;
@@ -148,6 +157,7 @@ public class PredicateAbstractionManager {
     solver = pSolver;
     invariantSupplier = pInvariantsSupplier;
     stats = pAbstractionStats;
+    proverSessions = pProverSessions;
 
     if (options.isCartesianAbstraction()) {
       options.setAbstractionType(AbstractionType.CARTESIAN);
@@ -176,6 +186,8 @@ public class PredicateAbstractionManager {
       cartesianAbstractionCache = null;
     }
 
+    persistentCache = options.isUseCache() ? pSolver.getPersistentQueryCache() : null;
+
     abstractionStorage = pAbstractionStorage;
 
     trivialPredicatesTimer = stats.trivialPredicatesTime.getNewTimer();
@@ -314,6 +326,9 @@ public class PredicateAbstractionManager {
 
     // caching
     Pair<BooleanFormula, ImmutableSet<BooleanFormula>> absKey = null;
+    // Invariants are not part of the key, and they might not hold anymore for a changed program.
+    final boolean usePersistentCache =
+        persistentCache != null && invariantSupplier == TrivialInvariantSupplier.INSTANCE;
     if (options.isUseCache()) {
       ImmutableSet<BooleanFormula> instantiatedPreds =
           Collections3.transformedImmutableSetCopy(
@@ -360,6 +375,24 @@ public class PredicateAbstractionManager {
             pathFormula,
             noAbstractionReuse);
       }
+
+      if (usePersistentCache) {
+        BooleanFormula persistentResult =
+            persistentCache.getAbstraction(
+                f, instantiatedPreds, options.getAbstractionType().name());
+        if (persistentResult != null) {
+          result =
+              makeAbstractionFormula(
+                  amgr.convertFormulaToRegion(persistentResult), ssa, pathFormula);
+          abstractionCache.put(absKey, result);
+          logger.log(
+              Level.FINEST, "Abstraction", currentAbstractionId, "was cached in a previous run");
+          logger.log(Level.ALL, "Abstraction result is", result.asFormula());
+          stats.numCallsAbstractionCached.incrementAndGet();
+          stats.numCallsAbstractionPersistentCached.incrementAndGet();
+          return result;
+        }
+      }
     }
 
     // Compute result for those predicates
@@ -402,7 +435,11 @@ public class PredicateAbstractionManager {
       abs = rmgr.makeAnd(abs, buildCartesianAbstractionUsingWeakening(f, ssa, remainingPredicates));
 
     } else {
-      abs = rmgr.makeAnd(abs, computeAbstraction(f, remainingPredicates, instantiator));
+      abs =
+          rmgr.makeAnd(
+              abs,
+              computeAbstraction(
+                  ImmutableSet.copyOf(locations), f, remainingPredicates, instantiator));
     }
 
     AbstractionFormula result = makeAbstractionFormula(abs, ssa, pathFormula);
@@ -413,6 +450,11 @@ public class PredicateAbstractionManager {
       if (result.isFalse()) {
         unsatisfiabilityCache.add(f);
       }
+
+      if (usePersistentCache) {
+        persistentCache.storeAbstraction(
+            f, absKey.getSecond(), options.getAbstractionType().name(), result.asFormula());
+      }
     }
 
     long abstractionTime =
@@ -457,13 +499,20 @@ public class PredicateAbstractionManager {
       stats.numCallsAbstractionCached.incrementAndGet();
       return bfmgr.makeFalse();
     }
+    if (persistentCache != null
+        && Boolean.TRUE.equals(persistentCache.isUnsat(ImmutableList.of(pF)))) {
+      unsatisfiabilityCache.add(pF);
+      stats.numCallsAbstractionCached.incrementAndGet();
+      stats.numCallsAbstractionPersistentCached.incrementAndGet();
+      return bfmgr.makeFalse();
+    }
 
     final Function<BooleanFormula, BooleanFormula> dummyInstantiator = Functions.identity();
 
     final Collection<AbstractionPredicate> predicates =
         getRelevantPredicates(pPredicates, pF, dummyInstantiator);
 
-    Region abs = computeAbstraction(pF, predicates, dummyInstantiator);
+    Region abs = computeAbstraction(null, pF, predicates, dummyInstantiator);
 
     BooleanFormula symbolicAbs = amgr.convertRegionToFormula(abs);
 
@@ -473,6 +522,9 @@ public class PredicateAbstractionManager {
 
     if (bfmgr.isFalse(symbolicAbs)) {
       unsatisfiabilityCache.add(pF);
+      if (persistentCache != null) {
+        persistentCache.storeUnsat(ImmutableList.of(pF), true);
+      }
     }
 
     return symbolicAbs;
@@ -730,6 +782,8 @@ public class PredicateAbstractionManager {
   /**
    * Actually compute an abstraction of a formula, without fancy caching etc.
    *
+   * @param sessionKey The location(s) of the abstraction, used for choosing an incremental prover
+   *     session if these are enabled.
    * @param f The formula to be abstracted.
    * @param remainingPredicates The set of predicates. Each predicate that is handled will be
    *     removed from the set.
@@ -737,63 +791,88 @@ public class PredicateAbstractionManager {
    *     should yield the same SSA indices that f has (or none, if f has no SSA indices).
    * @return An over-approximation of f using the predicates from remainingPredicates.
    */
+  private Region computeAbstraction(
+      final @Nullable Object sessionKey,
+      final BooleanFormula f,
+      final Collection<AbstractionPredicate> remainingPredicates,
+      final Function<BooleanFormula, BooleanFormula> instantiator)
+      throws SolverException, InterruptedException {
+    AbstractionProverSessions.Session session =
+        proverSessions == null ? null : proverSessions.acquire(sessionKey);
+    if (session == null) {
+      try (ProverEnvironment thmProver =
+          solver.newProverEnvironment(ProverOptions.GENERATE_ALL_SAT)) {
+        thmProver.push(f);
+        return computeAbstraction(f, thmProver, remainingPredicates, instantiator);
+      }
+    }
+
+    boolean success = false;
+    try {
+      Region abs =
+          computeAbstraction(f, session.assertFormula(f), remainingPredicates, instantiator);
+      success = true;
+      return abs;
+    } finally {
+      proverSessions.release(session, success);
+    }
+  }
+
+  /** Compute an abstraction of a formula that is already asserted on the given prover. */
   private Region computeAbstraction(
       final BooleanFormula f,
+      final ProverEnvironment thmProver,
       final Collection<AbstractionPredicate> remainingPredicates,
       final Function<BooleanFormula, BooleanFormula> instantiator)
       throws SolverException, InterruptedException {
     Region abs = rmgr.makeTrue();
 
-    try (ProverEnvironment thmProver =
-        solver.newProverEnvironment(ProverOptions.GENERATE_ALL_SAT)) {
-      thmProver.push(f);
+    if (remainingPredicates.isEmpty()) {
+      stats.numSatCheckAbstractions.incrementAndGet();
 
-      if (remainingPredicates.isEmpty()) {
-        stats.numSatCheckAbstractions.incrementAndGet();
+      abstractionSolveTimer.start();
+      boolean feasibility;
+      try {
+        feasibility = !thmProver.isUnsat();
+      } finally {
+        abstractionSolveTimer.stop();
+      }
+
+      if (!feasibility) {
+        abs = rmgr.makeFalse();
+      }
 
-        abstractionSolveTimer.start();
-        boolean feasibility;
+    } else {
+      if (options.getAbstractionType() != AbstractionType.BOOLEAN) {
+        // First do cartesian abstraction if desired
+        cartesianAbstractionTimer.start();
         try {
-          feasibility = !thmProver.isUnsat();
+          abs =
+              rmgr.makeAnd(
+                  abs,
+                  computeCartesianAbstraction(f, thmProver, remainingPredicates, instantiator));
         } finally {
-          abstractionSolveTimer.stop();
-        }
-
-        if (!feasibility) {
-          abs = rmgr.makeFalse();
+          cartesianAbstractionTimer.stop();
         }
+      }
 
-      } else {
-        if (options.getAbstractionType() != AbstractionType.BOOLEAN) {
-          // First do cartesian abstraction if desired
-          cartesianAbstractionTimer.start();
-          try {
-            abs =
-                rmgr.makeAnd(
-                    abs,
-                    computeCartesianAbstraction(f, thmProver, remainingPredicates, instantiator));
-          } finally {
-            cartesianAbstractionTimer.stop();
-          }
+      if (options.getAbstractionType() != AbstractionType.CARTESIAN
+          && !remainingPredicates.isEmpty()) {
+        // Last do boolean abstraction if desired and necessary
+        stats.numBooleanAbsPredicates.addAndGet(remainingPredicates.size());
+        booleanAbstractionTimer.start();
+        try {
+          abs =
+              rmgr.makeAnd(
+                  abs, computeBooleanAbstraction(thmProver, remainingPredicates, instantiator));
+        } finally {
+          booleanAbstractionTimer.stop();
         }
 
-        if (options.getAbstractionType() != AbstractionType.CARTESIAN
-            && !remainingPredicates.isEmpty()) {
-          // Last do boolean abstraction if desired and necessary
-          stats.numBooleanAbsPredicates.addAndGet(remainingPredicates.size());
-          booleanAbstractionTimer.start();
-          try {
-            abs =
-                rmgr.makeAnd(
-                    abs, computeBooleanAbstraction(thmProver, remainingPredicates, instantiator));
-          } finally {
-            booleanAbstractionTimer.stop();
-          }
-
-          // Warning:
-          // buildBooleanAbstraction() does not clean up thmProver, so do not use it here.
-          // remainingPredicates is now empty.
-        }
+        // Warning:
+        // buildBooleanAbstraction() does not clean up thmProver, so do not use it here
+        // (the caller either closes it or pops it back to the asserted formula).
+        // remainingPredicates is now empty.
       }
     }
     return abs;
@@ -844,8 +923,16 @@ public class PredicateAbstractionManager {
       while (predicateIt.hasNext()) {
         final AbstractionPredicate p = predicateIt.next();
         Pair<BooleanFormula, AbstractionPredicate> cacheKey = Pair.of(f, p);
-        if (options.isUseCache() && cartesianAbstractionCache.containsKey(cacheKey)) {
-          byte predVal = cartesianAbstractionCache.get(cacheKey);
+        Byte cachedPredVal = options.isUseCache() ? cartesianAbstractionCache.get(cacheKey) : null;
+        if (cachedPredVal == null && persistentCache != null) {
+          cachedPredVal =
+              persistentCache.getPredicateValue(f, instantiator.apply(p.getSymbolicAtom()));
+          if (cachedPredVal != null) {
+            cartesianAbstractionCache.put(cacheKey, cachedPredVal);
+          }
+        }
+        if (cachedPredVal != null) {
+          byte predVal = cachedPredVal;
           stats.numCartesianAbsPredicatesCached.incrementAndGet();
 
           abstractionBddConstructionTimer.start();
@@ -908,6 +995,9 @@ public class PredicateAbstractionManager {
           if (options.isUseCache()) {
             cartesianAbstractionCache.put(cacheKey, predVal);
           }
+          if (persistentCache != null) {
+            persistentCache.storePredicateValue(f, predTrue, predVal);
+          }
         }
       }
 
@@ -11,9 +11,11 @@ package org.sosy_lab.cpachecker.cpa.predicate;
 import java.nio.file.Path;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.cpachecker.cpa.predicate.AbstractionProverSessions.ProverReuse;
 import org.sosy_lab.cpachecker.cpa.predicate.PredicateAbstractionManager.AbstractionType;
 
 @Options(prefix = "cpa.predicate")
@@ -32,6 +34,25 @@ public class PredicateAbstractionManagerOptions {
       description = "whether to use Boolean or Cartesian abstraction or both")
   private AbstractionType abstractionType = AbstractionType.BOOLEAN;
 
+  @Option(
+      secure = true,
+      name = "abstraction.proverReuse",
+      description =
+          "Keep prover environments alive across abstraction computations and assert only the"
+              + " conjuncts of the abstracted formula that differ from the previous computation,"
+              + " using push and pop. PER_PATH uses a single prover environment, PER_LOCATION one"
+              + " per abstraction location.")
+  private ProverReuse proverReuse = ProverReuse.NONE;
+
+  @Option(
+      secure = true,
+      name = "abstraction.maxProverSessions",
+      description =
+          "Maximal number of prover environments that are kept alive for"
+              + " cpa.predicate.abstraction.proverReuse=PER_LOCATION.")
+  @IntegerOption(min = 1)
+  private int maxProverSessions = 16;
+
   @Option(
       secure = true,
       name = "abstraction.dumpHardQueries",
@@ -94,6 +115,14 @@ public class PredicateAbstractionManagerOptions {
     abstractionType = pCartesian;
   }
 
+  ProverReuse getProverReuse() {
+    return proverReuse;
+  }
+
+  int getMaxProverSessions() {
+    return maxProverSessions;
+  }
+
   boolean isDumpHardAbstractions() {
     return dumpHardAbstractions;
   }
@@ -26,6 +26,9 @@ public class PredicateAbstractionStatistics {
   // result was cached, no computation
   final AtomicInteger numCallsAbstractionCached = new AtomicInteger(0);
 
+  // result was cached in the persistent cache of a previous run, counted also as cached
+  final AtomicInteger numCallsAbstractionPersistentCached = new AtomicInteger(0);
+
   // loop was cached, no new computation
   final AtomicInteger numInductivePathFormulaCacheUsed = new AtomicInteger(0);
 
@@ -38,6 +41,10 @@ public class PredicateAbstractionStatistics {
   final AtomicInteger numCartesianAbsPredicatesCached = new AtomicInteger(0);
   final AtomicInteger numBooleanAbsPredicates = new AtomicInteger(0);
 
+  // conjuncts pushed onto and kept on the stack of incremental prover sessions
+  final AtomicInteger numIncrementalConjunctsAsserted = new AtomicInteger(0);
+  final AtomicInteger numIncrementalConjunctsReused = new AtomicInteger(0);
+
   final ThreadSafeTimerContainer abstractionReuseTime =
       new ThreadSafeTimerContainer("Abstraction reuse");
   final ThreadSafeTimerContainer abstractionReuseImplicationTime =
@@ -62,6 +69,9 @@ public class PredicateAbstractionStatistics {
   final ThreadSafeTimerContainer abstractionSolveTime =
       new ThreadSafeTimerContainer("Time for abstraction solving");
 
+  final ThreadSafeTimerContainer incrementalAssertionTime =
+      new ThreadSafeTimerContainer("Time for incremental assertions");
+
   long allSatCount = 0;
   int maxAllSatCount = 0;
 
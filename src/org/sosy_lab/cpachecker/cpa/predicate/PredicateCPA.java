@@ -13,6 +13,7 @@ import java.util.Collection;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.configuration.Configuration;
@@ -41,6 +42,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.pcc.ProofChecker;
 import org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets;
 import org.sosy_lab.cpachecker.core.specification.Specification;
+import org.sosy_lab.cpachecker.cpa.predicate.AbstractionProverSessions.ProverReuse;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateAbstractionsStorage;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
@@ -152,6 +154,7 @@ public class PredicateCPA
   private final PredicateAbstractionsStorage abstractionStorage;
   private final PredicateAbstractionStatistics abstractionStats =
       new PredicateAbstractionStatistics();
+  private final @Nullable AbstractionProverSessions proverSessions;
 
   // path formulas for PCC
   private final Map<PredicateAbstractState, PathFormula> computedPathFormulaePcc = new HashMap<>();
@@ -210,6 +213,16 @@ public class PredicateCPA
             config, logger, pShutdownNotifier, pCfa, specification, pAggregatedReachedSets);
 
     abstractionOptions = new PredicateAbstractionManagerOptions(config);
+    if (abstractionOptions.getProverReuse() != ProverReuse.NONE) {
+      proverSessions =
+          new AbstractionProverSessions(
+              solver,
+              abstractionOptions.getProverReuse(),
+              abstractionOptions.getMaxProverSessions(),
+              abstractionStats);
+    } else {
+      proverSessions = null;
+    }
     abstractionStorage =
         new PredicateAbstractionsStorage(
             abstractionOptions.getReuseAbstractionsFrom(),
@@ -313,7 +326,8 @@ public class PredicateCPA
         abstractionStats,
         invariantsManager.appendToAbstractionFormula()
             ? invariantsManager
-            : TrivialInvariantSupplier.INSTANCE);
+            : TrivialInvariantSupplier.INSTANCE,
+        proverSessions);
   }
 
   public PathFormulaManager getPathFormulaManager() {
@@ -371,6 +385,10 @@ public class PredicateCPA
 
   @Override
   public void close() {
+    if (proverSessions != null) {
+      // prover environments need to be closed before the solver
+      proverSessions.close();
+    }
     solver.close();
   }
 
@@ -294,6 +294,12 @@ class PredicateCPAStatistics implements Statistics {
       out.println(
           "  Times result was cached:         "
               + valueWithPercentage(as.numCallsAbstractionCached, as.numCallsAbstraction));
+      if (as.numCallsAbstractionPersistentCached.get() > 0) {
+        out.println(
+            "    from previous runs:            "
+                + valueWithPercentage(
+                    as.numCallsAbstractionPersistentCached, as.numCallsAbstraction));
+      }
       out.println(
           "  Times cartesian abs was used:    "
               + valueWithPercentage(
@@ -402,6 +408,13 @@ class PredicateCPAStatistics implements Statistics {
             "  Avg number of models for allsat:        "
                 + div(as.allSatCount, as.booleanAbstractionTime.getNumberOfIntervals()));
       }
+      if (as.incrementalAssertionTime.getNumberOfIntervals() > 0) {
+        int asserted = as.numIncrementalConjunctsAsserted.get();
+        int reused = as.numIncrementalConjunctsReused.get();
+        out.println(
+            "Number of conjuncts reused on prover stack: "
+                + valueWithPercentage(reused, asserted + reused));
+      }
     }
     out.println();
 
@@ -436,6 +449,12 @@ class PredicateCPAStatistics implements Statistics {
       if (as.booleanAbstractionTime.getNumberOfIntervals() > 0) {
         out.println("    Boolean abstraction:             " + as.booleanAbstractionTime);
       }
+      if (as.incrementalAssertionTime.getNumberOfIntervals() > 0) {
+        out.println("    Incremental assertions:          " + as.incrementalAssertionTime);
+        out.println(
+            "      Estimated saved time:          "
+                + estimateSavedAssertionTime(as).formatAs(SECONDS));
+      }
       if (as.abstractionReuseTime.getNumberOfIntervals() > 0) {
         out.println("    Abstraction reuse:              " + as.abstractionReuseTime);
         out.println("    Abstraction reuse implication:  " + as.abstractionReuseImplicationTime);
@@ -491,4 +510,17 @@ class PredicateCPAStatistics implements Statistics {
     rmgr.printStatistics(out);
     solver.printStatistics(out);
   }
+
+  /**
+   * The conjuncts that were kept on the stack of an incremental prover session did not need to be
+   * asserted again, estimate the time for this with the average time per asserted conjunct.
+   */
+  private static TimeSpan estimateSavedAssertionTime(PredicateAbstractionStatistics as) {
+    int asserted = as.numIncrementalConjunctsAsserted.get();
+    if (asserted == 0) {
+      return TimeSpan.ofNanos(0);
+    }
+    long nanosPerConjunct = as.incrementalAssertionTime.getSumTime().asNanos() / asserted;
+    return TimeSpan.ofNanos(nanosPerConjunct * as.numIncrementalConjunctsReused.get());
+  }
 }
@@ -8,6 +8,9 @@
 
 package org.sosy_lab.cpachecker.cpa.smg.join;
 
+import com.google.common.collect.HashMultiset;
+import com.google.common.collect.Multiset;
+import java.util.Collections;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.Map.Entry;
@@ -20,6 +23,9 @@ public class SMGNodeMapping {
   private final Map<SMGObject, SMGObject> object_map = new HashMap<>();
   private final Map<SMGValue, SMGValue> value_map = new HashMap<>();
 
+  // The targets of object_map, such that matching objects does not need to search all mappings
+  private final Multiset<SMGObject> mappedObjects = HashMultiset.create();
+
   @Override
   public int hashCode() {
     return Objects.hash(object_map, value_map);
@@ -37,6 +43,7 @@ public class SMGNodeMapping {
   public SMGNodeMapping(SMGNodeMapping origin) {
     object_map.putAll(origin.object_map);
     value_map.putAll(origin.value_map);
+    mappedObjects.addAll(origin.mappedObjects);
   }
 
   public SMGValue get(SMGValue i) {
@@ -48,7 +55,11 @@ public class SMGNodeMapping {
   }
 
   public void map(SMGObject key, SMGObject value) {
-    object_map.put(key, value);
+    SMGObject oldValue = object_map.put(key, value);
+    if (oldValue != null) {
+      mappedObjects.remove(oldValue);
+    }
+    mappedObjects.add(value);
   }
 
   public void map(SMGValue key, SMGValue value) {
@@ -66,9 +77,13 @@ public class SMGNodeMapping {
   }
 
   public void removeValue(SMGObject value) {
+    if (!mappedObjects.contains(value)) {
+      return;
+    }
     for (Entry<SMGObject, SMGObject> entry : object_map.entrySet()) {
       if (entry.getValue().equals(value)) {
         object_map.remove(entry.getKey());
+        mappedObjects.remove(value);
         return;
       }
     }
@@ -83,11 +98,11 @@ public class SMGNodeMapping {
   }
 
   public boolean containsValue(SMGObject value) {
-    return object_map.containsValue(value);
+    return mappedObjects.contains(value);
   }
 
   public Set<Entry<SMGObject, SMGObject>> getObject_mapEntrySet() {
-    return object_map.entrySet();
+    return Collections.unmodifiableSet(object_map.entrySet());
   }
 
   public Set<Entry<SMGValue, SMGValue>> getValue_mapEntrySet() {
@@ -1292,4 +1292,37 @@ public class SMGCPAEqualityTest extends SMGCPATest0 {
     // Compare the 2 states from before and now
     assertThat(currentState.isLessOrEqual(stateW1Left)).isTrue();
   }
+
+  /*
+   * Covered states need to have the same fingerprint, even if their heap is abstracted differently,
+   * while states with a different number of variables are ruled out by the fingerprint.
+   */
+  @Test
+  public void fingerprintOfCoveredStatesTest() throws CPAException, InterruptedException {
+    SMGState emptyState = currentState;
+    buildConcreteListReturnFstAndLstPointer(false, sllSize, 3);
+    SMGState stateWithSmallerList =
+        new SMGCPAAbstractionManager(currentState, 3, new SMGCPAStatistics())
+            .findAndAbstractLists();
+    currentState = emptyState;
+    buildConcreteListReturnFstAndLstPointer(false, sllSize, 6);
+    SMGState stateWithBiggerList =
+        new SMGCPAAbstractionManager(currentState, 3, new SMGCPAStatistics())
+            .findAndAbstractLists();
+
+    SMGState stateWithBiggerListWOLast = stateWithBiggerList.copyAndRemoveStackVariable("last");
+    SMGState stateWithSmallerListWOLast = stateWithSmallerList.copyAndRemoveStackVariable("last");
+    assertThat(stateWithBiggerListWOLast.isLessOrEqual(stateWithSmallerListWOLast)).isTrue();
+    assertThat(stateWithBiggerListWOLast.getPseudoPartitionKey())
+        .isEqualTo(stateWithSmallerListWOLast.getPseudoPartitionKey());
+
+    SMGState stateWithoutPointers = stateWithSmallerListWOLast.copyAndRemoveStackVariable("first");
+    assertThat(stateWithBiggerListWOLast.isLessOrEqual(stateWithoutPointers)).isFalse();
+    assertThat(
+            stateWithBiggerListWOLast
+                .getMemoryModel()
+                .getFingerprint()
+                .compareTo(stateWithoutPointers.getMemoryModel().getFingerprint()))
+        .isLessThan(0);
+  }
 }
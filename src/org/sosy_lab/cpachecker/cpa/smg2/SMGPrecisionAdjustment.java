@@ -14,8 +14,11 @@ import com.google.common.base.Function;
 import com.google.common.collect.ImmutableSet;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 import java.io.PrintStream;
+import java.util.Collections;
 import java.util.Map.Entry;
 import java.util.Optional;
+import java.util.Set;
+import java.util.WeakHashMap;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.IntegerOption;
@@ -212,6 +215,13 @@ public class SMGPrecisionAdjustment implements PrecisionAdjustment {
   private final StatTimer totalAbstraction;
   private final StatTimer totalEnforcePath;
 
+  // Memory models in which the list abstraction found nothing to abstract. States often share
+  // their memory model with their predecessors (e.g., in loops that do not modify the heap), so we
+  // do not need to search them for lists again. Weak, so that memory models of states that are not
+  // used anymore can be collected.
+  private final Set<SymbolicProgramConfiguration> memoryModelsWithoutListsToAbstract =
+      Collections.newSetFromMap(new WeakHashMap<>());
+
   @SuppressFBWarnings(value = "URF_UNREAD_FIELD", justification = "false alarm")
   private boolean performPrecisionBasedAbstraction = false;
 
@@ -280,13 +290,19 @@ public class SMGPrecisionAdjustment implements PrecisionAdjustment {
       totalEnforcePath.stop();
     }
 
-    if (options.abstractLinkedLists && checkAbstractListAt(location)) {
+    if (options.abstractLinkedLists
+        && checkAbstractListAt(location)
+        && !memoryModelsWithoutListsToAbstract.contains(resultState.getMemoryModel())) {
       // Abstract Lists at loop heads
       try {
+        SMGState stateBeforeListAbstraction = resultState;
         resultState =
             new SMGCPAAbstractionManager(
                     resultState, options.getListAbstractionMinimumLengthThreshhold(), stats)
                 .findAndAbstractLists();
+        if (resultState.getMemoryModel() == stateBeforeListAbstraction.getMemoryModel()) {
+          memoryModelsWithoutListsToAbstract.add(resultState.getMemoryModel());
+        }
       } catch (SMGException e) {
         // Do nothing. This should never happen anyway
         throw new RuntimeException(e);
@@ -56,6 +56,7 @@ import org.sosy_lab.cpachecker.core.defaults.LatticeAbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractQueryableState;
 import org.sosy_lab.cpachecker.core.interfaces.Graphable;
 import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
+import org.sosy_lab.cpachecker.core.interfaces.PseudoPartitionable;
 import org.sosy_lab.cpachecker.cpa.constraints.constraint.Constraint;
 import org.sosy_lab.cpachecker.cpa.constraints.domain.ConstraintsState;
 import org.sosy_lab.cpachecker.cpa.smg.join.SMGJoinStatus;
@@ -115,6 +116,7 @@ public class SMGState
     implements ImmutableForgetfulState<SMGInformation>,
         LatticeAbstractState<SMGState>,
         Partitionable,
+        PseudoPartitionable,
         AbstractQueryableState,
         Graphable {
 
@@ -1241,6 +1243,12 @@ public class SMGState
       return false;
     }
 
+    // Transfers that do not change the memory share it with their successors, so the memory of
+    // states reached on different paths is often the same object. Then there is nothing to match.
+    if (memoryModel == pOther.memoryModel && errorInfo.equals(pOther.errorInfo)) {
+      return true;
+    }
+
     // We may not forget any errors already found
     if (!copyAndPruneUnreachable()
         .checkErrorEqualityForTwoStates(pOther.copyAndPruneUnreachable())) {
@@ -5004,6 +5012,17 @@ public class SMGState
     return getMemoryModel().getSmg().getNumberOfAbstractedLists() * 100000 + getSize();
   }
 
+  @Override
+  public Comparable<?> getPseudoPartitionKey() {
+    return memoryModel.getFingerprint();
+  }
+
+  @Override
+  public @Nullable Object getPseudoHashCode() {
+    // All states with an equal fingerprint are candidates for the coverage check
+    return null;
+  }
+
   // TODO: To be replaced with a better structure, i.e. union-find
   // This is mutable on purpose!
   public static class EqualityCache<V> {
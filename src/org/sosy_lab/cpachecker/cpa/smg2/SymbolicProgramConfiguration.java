@@ -16,11 +16,14 @@ import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableBiMap;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Lists;
 import com.google.common.collect.Sets;
 import java.math.BigInteger;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Map;
 import java.util.Map.Entry;
 import java.util.Optional;
@@ -41,6 +44,7 @@ import org.sosy_lab.cpachecker.cpa.smg2.util.SMGException;
 import org.sosy_lab.cpachecker.cpa.smg2.util.SMGHasValueEdgesAndSPC;
 import org.sosy_lab.cpachecker.cpa.smg2.util.SMGObjectsAndValues;
 import org.sosy_lab.cpachecker.cpa.smg2.util.SPCAndSMGObjects;
+import org.sosy_lab.cpachecker.cpa.smg2.util.SPCFingerprint;
 import org.sosy_lab.cpachecker.cpa.smg2.util.ValueAndValueSize;
 import org.sosy_lab.cpachecker.cpa.smg2.util.value.ValueWrapper;
 import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
@@ -120,6 +124,9 @@ public class SymbolicProgramConfiguration {
   // Throws exception on reading this object (i.e. because we know we can't handle this)
   private Set<SMGObject> readBlacklist;
 
+  // Computed lazily, see getFingerprint()
+  private @Nullable SPCFingerprint fingerprint = null;
+
   private SymbolicProgramConfiguration(
       SMG pSmg,
       PersistentMap<String, SMGObject> pGlobalVariableMapping,
@@ -374,6 +381,25 @@ public class SymbolicProgramConfiguration {
     return size;
   }
 
+  /**
+   * Returns a cheap fingerprint of this memory model that can be used to rule out that this memory
+   * model is less or equal to another memory model. See {@link SPCFingerprint} for details.
+   */
+  public SPCFingerprint getFingerprint() {
+    if (fingerprint == null) {
+      // Same order as in getFunctionDeclarationsFromStackFrames(), i.e., top-most frame first
+      List<Boolean> stackFramesWithReturnValue = new ArrayList<>();
+      for (StackFrame frame : stackVariableMapping) {
+        stackFramesWithReturnValue.add(
+            frame.getReturnObject().isPresent()
+                && !smg.getEdges(frame.getReturnObject().orElseThrow()).isEmpty());
+      }
+      fingerprint =
+          SPCFingerprint.of(getNumberOfVariables(), Lists.reverse(stackFramesWithReturnValue));
+    }
+    return fingerprint;
+  }
+
   /**
    * Tries to check for inequality of 2 {@link SMGValue}s used in the SMG of this {@link
    * SymbolicProgramConfiguration}. This does NOT check the (concrete) CValues of the entered
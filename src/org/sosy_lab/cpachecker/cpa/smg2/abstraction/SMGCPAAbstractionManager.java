@@ -9,11 +9,12 @@
 package org.sosy_lab.cpachecker.cpa.smg2.abstraction;
 
 import com.google.common.annotations.VisibleForTesting;
+import com.google.common.collect.HashMultimap;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.SetMultimap;
 import java.math.BigInteger;
 import java.util.ArrayList;
-import java.util.Collection;
 import java.util.Comparator;
 import java.util.HashMap;
 import java.util.HashSet;
@@ -48,6 +49,12 @@ public class SMGCPAAbstractionManager {
 
   private final SMGCPAStatistics statistics;
 
+  // For each object, the offsets of pointers towards it that are saved in valid heap objects of the
+  // same size, i.e., the potential next pointers of previous list elements. Computed once, as the
+  // state does not change while searching for candidates.
+  private @Nullable SetMultimap<SMGObject, BigInteger> offsetsOfPointersFromSameSizeHeapObjects =
+      null;
+
   public SMGCPAAbstractionManager(
       SMGState pState, int pMinimumLengthForListsForAbstraction, SMGCPAStatistics pStatistics) {
     state = pState;
@@ -394,8 +401,7 @@ public class SMGCPAAbstractionManager {
         continue;
       }
       Optional<SMGCandidate> possibleCandidate =
-          getSLLinkedCandidatesForObject(
-              heapObj, smg, alreadyVisited, state.getMemoryModel().getHeapObjects());
+          getSLLinkedCandidatesForObject(heapObj, smg, alreadyVisited);
       if (possibleCandidate.isPresent()) {
         candidates.add(possibleCandidate.orElseThrow());
       }
@@ -621,10 +627,7 @@ public class SMGCPAAbstractionManager {
 
   /* Search for followup segments based on potential root. If we find a object that is already processed in the candidatesMap, we take and remove it from the map, link it to the current segment, and return the new segment. */
   private Optional<SMGCandidate> getSLLinkedCandidatesForObject(
-      SMGObject potentialRoot,
-      SMG pInputSmg,
-      Set<SMGObject> pAlreadyVisited,
-      Collection<SMGObject> heapObjects)
+      SMGObject potentialRoot, SMG pInputSmg, Set<SMGObject> pAlreadyVisited)
       throws SMGException {
     Set<SMGObject> thisAlreadyVisited = new HashSet<>(pAlreadyVisited);
     if (thisAlreadyVisited.contains(potentialRoot) || !pInputSmg.isValid(potentialRoot)) {
@@ -664,8 +667,7 @@ public class SMGCPAAbstractionManager {
         // Valid candidate found!
         // Make sure it's a "root" by checking all pointers towards this root
         // The only valid pointers towards this root are from the followup or non heap objects
-        if (pInputSmg.hasPotentialListObjectsWithPointersToObject(
-            potentialRoot, nfo, heapObjects)) {
+        if (!hasPointerFromSameSizeHeapObjectAtOffset(potentialRoot, nfo, pInputSmg)) {
           pAlreadyVisited.add(potentialRoot);
           return Optional.of(new SMGCandidate(potentialRoot, nfo));
         }
@@ -674,6 +676,33 @@ public class SMGCPAAbstractionManager {
     return Optional.empty();
   }
 
+  /*
+   * Checks if there are valid heap objects that point to the given target object and might be
+   * lists (== size and fitting nfo).
+   */
+  private boolean hasPointerFromSameSizeHeapObjectAtOffset(
+      SMGObject targetObject, BigInteger suspectedNfo, SMG pInputSmg) {
+    if (offsetsOfPointersFromSameSizeHeapObjects == null) {
+      // Index all pointers at once instead of searching the whole heap for each target
+      offsetsOfPointersFromSameSizeHeapObjects = HashMultimap.create();
+      for (SMGObject heapObj : state.getMemoryModel().getHeapObjects()) {
+        if (!pInputSmg.isValid(heapObj)) {
+          continue;
+        }
+        for (SMGHasValueEdge hve : pInputSmg.getEdges(heapObj)) {
+          Optional<SMGPointsToEdge> maybePointsToEdge = pInputSmg.getPTEdge(hve.hasValue());
+          if (maybePointsToEdge.isPresent()) {
+            SMGObject target = maybePointsToEdge.orElseThrow().pointsTo();
+            if (heapObj.isSizeEqual(target)) {
+              offsetsOfPointersFromSameSizeHeapObjects.put(target, hve.getOffset());
+            }
+          }
+        }
+      }
+    }
+    return offsetsOfPointersFromSameSizeHeapObjects.containsEntry(targetObject, suspectedNfo);
+  }
+
   private boolean followupHasNextPointerToValid(
       SMGObject potentialFollowup,
       BigInteger nfoOfPrev,
@@ -0,0 +1,98 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.smg2.util;
+
+import com.google.common.base.Preconditions;
+import com.google.common.collect.ImmutableList;
+import java.util.List;
+import java.util.Objects;
+import org.sosy_lab.cpachecker.cpa.smg2.SymbolicProgramConfiguration;
+
+/**
+ * A cheap summary of a {@link SymbolicProgramConfiguration} that is used as pseudo-partition key
+ * (see {@link org.sosy_lab.cpachecker.core.interfaces.PseudoPartitionable}) for SMG states, so that
+ * the expensive shape comparison of the coverage check is only done for candidates that might
+ * cover a state.
+ *
+ * <p>The fingerprint only consists of properties that the coverage check requires to match: the
+ * number of variables, and for the stack frames that are compared (starting with the top-most
+ * frame) whether they hold a return value. If this fingerprint is greater than the fingerprint of
+ * another memory model, the other memory model has fewer stack frames that match the first frames
+ * of this memory model. Properties of the heap (e.g. the number of objects or list segments) are
+ * not part of the fingerprint, as concrete memory may be covered by abstracted list segments and
+ * unreachable memory is ignored.
+ */
+public final class SPCFingerprint implements Comparable<SPCFingerprint> {
+
+  private final int numberOfVariables;
+
+  // for each stack frame, top-most first, whether the frame holds a return value
+  private final ImmutableList<Boolean> stackFramesWithReturnValue;
+
+  private SPCFingerprint(int pNumberOfVariables, List<Boolean> pStackFramesWithReturnValue) {
+    numberOfVariables = pNumberOfVariables;
+    stackFramesWithReturnValue = ImmutableList.copyOf(pStackFramesWithReturnValue);
+  }
+
+  public static SPCFingerprint of(
+      int pNumberOfVariables, List<Boolean> pStackFramesWithReturnValue) {
+    Preconditions.checkNotNull(pStackFramesWithReturnValue);
+    return new SPCFingerprint(pNumberOfVariables, pStackFramesWithReturnValue);
+  }
+
+  public int getNumberOfVariables() {
+    return numberOfVariables;
+  }
+
+  public int getNumberOfStackFrames() {
+    return stackFramesWithReturnValue.size();
+  }
+
+  /**
+   * Returns a positive number if a memory model with this fingerprint might be less or equal to a
+   * memory model with the other fingerprint while not having the same fingerprint, i.e., both have
+   * the same number of variables and the stack frames of the other are a proper prefix of the stack
+   * frames of this fingerprint. Returns zero for equal fingerprints and a negative number
+   * otherwise. This is not a total order, but it is all that is needed for pseudo-partitioning.
+   */
+  @Override
+  public int compareTo(SPCFingerprint pOther) {
+    if (equals(pOther)) {
+      return 0;
+    }
+    if (numberOfVariables == pOther.numberOfVariables
+        && getNumberOfStackFrames() > pOther.getNumberOfStackFrames()
+        && stackFramesWithReturnValue
+            .subList(0, pOther.getNumberOfStackFrames())
+            .equals(pOther.stackFramesWithReturnValue)) {
+      return 1;
+    }
+    return -1;
+  }
+
+  @Override
+  public boolean equals(Object pObj) {
+    if (this == pObj) {
+      return true;
+    }
+    return pObj instanceof SPCFingerprint other
+        && numberOfVariables == other.numberOfVariables
+        && stackFramesWithReturnValue.equals(other.stackFramesWithReturnValue);
+  }
+
+  @Override
+  public int hashCode() {
+    return Objects.hash(numberOfVariables, stackFramesWithReturnValue);
+  }
+
+  @Override
+  public String toString() {
+    return "[" + numberOfVariables + ", " + stackFramesWithReturnValue + "]";
+  }
+}
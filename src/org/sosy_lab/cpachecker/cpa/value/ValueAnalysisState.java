@@ -170,6 +170,10 @@ public final class ValueAnalysisState
 
     ValueAndType valueAndType = new ValueAndType(checkNotNull(valueToAdd), pType);
     ValueAndType oldValueAndType = constantsMap.get(pMemLoc);
+    if (valueAndType.equals(oldValueAndType)) {
+      // Re-assigning the same value is common (e.g., in loops), avoid copying the map
+      return;
+    }
     if (oldValueAndType != null) {
       hashCode -= (pMemLoc.hashCode() ^ oldValueAndType.hashCode());
     }
@@ -235,11 +239,11 @@ public final class ValueAnalysisState
   @Override
   public ValueAnalysisInformation forget(MemoryLocation pMemoryLocation) {
 
-    if (!constantsMap.containsKey(pMemoryLocation)) {
+    ValueAndType value = constantsMap.get(pMemoryLocation);
+    if (value == null) {
       return ValueAnalysisInformation.EMPTY;
     }
 
-    ValueAndType value = constantsMap.get(pMemoryLocation);
     constantsMap = constantsMap.removeAndCopy(pMemoryLocation);
     hashCode -= (pMemoryLocation.hashCode() ^ value.hashCode());
 
@@ -369,14 +373,20 @@ public final class ValueAnalysisState
    */
   @Override
   public ValueAnalysisState join(ValueAnalysisState reachedState) {
-    PersistentMap<MemoryLocation, ValueAndType> newConstantsMap = PathCopyingPersistentTreeMap.of();
+    if (constantsMap == reachedState.constantsMap) {
+      return reachedState;
+    }
+
+    // Start with the reached state and only remove the differing entries, such that the new map
+    // shares most of its structure with the reached state
+    PersistentMap<MemoryLocation, ValueAndType> newConstantsMap = reachedState.constantsMap;
 
     for (Entry<MemoryLocation, ValueAndType> otherEntry : reachedState.constantsMap.entrySet()) {
       MemoryLocation key = otherEntry.getKey();
       ValueAndType value = otherEntry.getValue();
 
-      if (Objects.equals(value, constantsMap.get(key))) {
-        newConstantsMap = newConstantsMap.putAndCopy(key, value);
+      if (!Objects.equals(value, constantsMap.get(key))) {
+        newConstantsMap = newConstantsMap.removeAndCopy(key);
       }
     }
 
@@ -398,6 +408,10 @@ public final class ValueAnalysisState
    */
   @Override
   public boolean isLessOrEqual(ValueAnalysisState other) {
+    // states often share their map with their predecessors
+    if (constantsMap == other.constantsMap) {
+      return true;
+    }
 
     // also, this element is not less or equal than the other element, if it contains less elements
     if (constantsMap.size() < other.constantsMap.size()) {
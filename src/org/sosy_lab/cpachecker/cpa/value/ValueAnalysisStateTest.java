@@ -0,0 +1,75 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.value;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
+import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+public class ValueAnalysisStateTest {
+
+  private static final MemoryLocation X = MemoryLocation.forLocalVariable("main", "x");
+  private static final MemoryLocation Y = MemoryLocation.forLocalVariable("main", "y");
+  private static final MemoryLocation G = MemoryLocation.forIdentifier("g");
+
+  private static ValueAnalysisState createState(long pX, long pY, long pG) {
+    ValueAnalysisState state = new ValueAnalysisState(MachineModel.LINUX32);
+    state.assignConstant(X, new NumericValue(pX), CNumericTypes.INT);
+    state.assignConstant(Y, new NumericValue(pY), CNumericTypes.INT);
+    state.assignConstant(G, new NumericValue(pG), CNumericTypes.INT);
+    return state;
+  }
+
+  @Test
+  public void testReassignAndForget() {
+    ValueAnalysisState state = createState(1, 2, 3);
+    ValueAnalysisState copy = ValueAnalysisState.copyOf(state);
+
+    copy.assignConstant(X, new NumericValue(1L), CNumericTypes.INT);
+    assertThat(copy).isEqualTo(state);
+    assertThat(copy.hashCode()).isEqualTo(state.hashCode());
+
+    copy.assignConstant(X, new NumericValue(5L), CNumericTypes.INT);
+    assertThat(copy).isNotEqualTo(state);
+    copy.assignConstant(X, new NumericValue(1L), CNumericTypes.INT);
+    assertThat(copy).isEqualTo(state);
+    assertThat(copy.hashCode()).isEqualTo(state.hashCode());
+
+    copy.forget(Y);
+    assertThat(copy.forget(Y).getAssignments()).isEmpty();
+    assertThat(copy.getTrackedMemoryLocations()).containsExactly(X, G);
+    assertThat(state.getTrackedMemoryLocations()).containsExactly(X, Y, G);
+  }
+
+  @Test
+  public void testJoinAndLessOrEqual() {
+    ValueAnalysisState state = createState(1, 2, 3);
+    ValueAnalysisState reached = createState(1, 4, 3);
+
+    assertThat(state.join(ValueAnalysisState.copyOf(state))).isEqualTo(state);
+    assertThat(state.isLessOrEqual(ValueAnalysisState.copyOf(state))).isTrue();
+
+    ValueAnalysisState joined = state.join(reached);
+    ValueAnalysisState expected = ValueAnalysisState.copyOf(state);
+    expected.forget(Y);
+    assertThat(joined).isEqualTo(expected);
+    assertThat(joined.hashCode()).isEqualTo(expected.hashCode());
+    assertThat(state.isLessOrEqual(joined)).isTrue();
+    assertThat(reached.isLessOrEqual(joined)).isTrue();
+    assertThat(joined.isLessOrEqual(state)).isFalse();
+    assertThat(state.isLessOrEqual(reached)).isFalse();
+
+    // the reached state is returned if it is already more abstract
+    assertThat(state.join(joined)).isSameInstanceAs(joined);
+  }
+}
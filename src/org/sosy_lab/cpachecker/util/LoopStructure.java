@@ -19,6 +19,7 @@ import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableCollection;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableListMultimap;
+import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.ImmutableSortedSet;
 import com.google.common.collect.Maps;
@@ -122,6 +123,20 @@ public final class LoopStructure implements Serializable {
       nodes = ImmutableSortedSet.<CFANode>naturalOrder().addAll(pNodes).add(loopHead).build();
     }
 
+    private Loop(ImmutableSet<CFANode> pLoopHeads, Set<CFANode> pNodes) {
+      loopHeads = pLoopHeads;
+      nodes = ImmutableSortedSet.<CFANode>naturalOrder().addAll(pNodes).addAll(pLoopHeads).build();
+    }
+
+    /**
+     * Recreate a loop with the given loop heads and nodes, e.g., a loop that was found in a
+     * previous run in a function that did not change since then.
+     */
+    public static Loop restore(Set<CFANode> pLoopHeads, Set<CFANode> pNodes) {
+      checkArgument(!pLoopHeads.isEmpty(), "loop without loop head");
+      return new Loop(ImmutableSet.copyOf(pLoopHeads), pNodes);
+    }
+
     private void computeSets() {
       if (innerLoopEdges != null) {
         assert incomingEdges != null;
@@ -462,10 +477,26 @@ public final class LoopStructure implements Serializable {
    * @throws ParserException If the structure of the CFA is too complex for determining loops.
    */
   public static LoopStructure getLoopStructure(MutableCFA cfa) throws ParserException {
+    return getLoopStructure(cfa, ImmutableMap.of());
+  }
+
+  /**
+   * Build loop-structure information for a CFA like {@link #getLoopStructure(MutableCFA)}, but
+   * take the loops of the functions in the given map from there instead of searching for them.
+   *
+   * @param pKnownLoops the loops of some functions, which must be the loops that {@link
+   *     #getLoopStructure(MutableCFA)} would find
+   * @throws ParserException If the structure of the CFA is too complex for determining loops.
+   */
+  public static LoopStructure getLoopStructure(
+      MutableCFA cfa, Map<String, ? extends Collection<Loop>> pKnownLoops) throws ParserException {
     ImmutableListMultimap.Builder<String, Loop> loops = ImmutableListMultimap.builder();
     for (String functionName : cfa.getAllFunctionNames()) {
-      NavigableSet<CFANode> nodes = cfa.getFunctionNodes(functionName);
-      Collection<Loop> functionLoops = findLoops(nodes, cfa.getLanguage());
+      Collection<Loop> functionLoops = pKnownLoops.get(functionName);
+      if (functionLoops == null) {
+        NavigableSet<CFANode> nodes = cfa.getFunctionNodes(functionName);
+        functionLoops = findLoops(nodes, cfa.getLanguage());
+      }
       loops.putAll(functionName, functionLoops);
     }
     return new LoopStructure(loops.build());
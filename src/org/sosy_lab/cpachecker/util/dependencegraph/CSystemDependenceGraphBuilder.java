@@ -8,23 +8,41 @@
 
 package org.sosy_lab.cpachecker.util.dependencegraph;
 
+import static com.google.common.base.Preconditions.checkNotNull;
+import static com.google.common.base.Preconditions.checkState;
+import static com.google.common.collect.FluentIterable.from;
+
+import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableListMultimap;
 import com.google.common.collect.ImmutableMultimap;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.io.PrintStream;
 import java.nio.file.Path;
+import java.util.ArrayDeque;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.Deque;
 import java.util.HashSet;
 import java.util.List;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.concurrent.TimeUnit;
+import java.util.function.BiConsumer;
+import java.util.function.Function;
+import java.util.function.Predicate;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownManager;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -72,7 +90,17 @@ import org.sosy_lab.cpachecker.util.resources.WalltimeLimit;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.statistics.StatTimer;
 
-/** Factory for creating a {@link SystemDependenceGraph} from a {@link CFA}. */
+/**
+ * Factory for creating a {@link SystemDependenceGraph} from a {@link CFA}.
+ *
+ * <p>The flow and control dependencies of the functions are independent of each other and can be
+ * computed in parallel (option <code>dependencegraph.threads</code>). They are inserted into the
+ * dependence graph in a fixed order, such that the result does not depend on the number of
+ * threads. The summary edges are computed afterwards on the whole graph.
+ *
+ * <p>For slicing, {@link #build(Collection)} creates a dependence graph that only contains the
+ * functions that may influence the given slicing criteria.
+ */
 @Options(prefix = "dependencegraph")
 public class CSystemDependenceGraphBuilder implements StatisticsProvider {
 
@@ -168,12 +196,32 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
   private List<PointerStateComputationMethod> pointerStateComputationMethods =
       ImmutableList.of(PointerStateComputationMethod.FLOW_SENSITIVE);
 
-  private final SystemDependenceGraph.Builder<
+  @Option(
+      secure = true,
+      name = "threads",
+      description =
+          "The number of threads for computing the flow and control dependencies of the functions"
+              + " in parallel (-1 for the number of available processors). The resulting"
+              + " dependence graph is the same for any number of threads.")
+  @IntegerOption(min = -1)
+  private int threads = 1;
+
+  private SystemDependenceGraph.Builder<
           AFunctionDeclaration, CFAEdge, MemoryLocation, CSystemDependenceGraph.Node>
       builder;
   private SystemDependenceGraph<MemoryLocation, CSystemDependenceGraph.Node> systemDependenceGraph =
       SystemDependenceGraph.empty();
   private String usedGlobalPointerState = "none";
+  private int functionCount = 0;
+
+  // shared by all dependence graphs created by this builder, computed by prepare()
+  private boolean prepared = false;
+  private @Nullable GlobalPointerState pointerState = null;
+  private @Nullable ForeignDefUseData foreignDefUseData = null;
+
+  // the last dependence graph created for slicing criteria, and the functions it contains
+  private @Nullable CSystemDependenceGraph lastSdgForCriteria = null;
+  private ImmutableSet<AFunctionDeclaration> lastFunctionsForCriteria = ImmutableSet.of();
 
   private enum PointerStateComputationMethod {
     FLOW_SENSITIVE,
@@ -205,15 +253,21 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     builder = SystemDependenceGraph.builder(CSystemDependenceGraph.Node::new);
   }
 
+  private int getThreads() {
+    if (threads == -1) {
+      return Runtime.getRuntime().availableProcessors();
+    }
+    return Math.max(threads, 1);
+  }
+
   private void insertDependencies(
-      CallGraph<AFunctionDeclaration> pCallGraph,
-      ImmutableSet<AFunctionDeclaration> pReachableFunctions)
-      throws CPAException, InterruptedException {
+      CallGraph<AFunctionDeclaration> pCallGraph, ImmutableList<FunctionEntryNode> pFunctions)
+      throws InterruptedException {
 
     if (considerFlowDeps) {
       flowDependenceTimer.start();
       try {
-        insertFlowDependencies(pReachableFunctions);
+        insertFlowDependencies(pFunctions);
       } finally {
         flowDependenceTimer.stop();
       }
@@ -222,7 +276,7 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     if (considerControlDeps) {
       controlDependenceTimer.start();
       try {
-        insertControlDependencies(pReachableFunctions);
+        insertControlDependencies(pFunctions);
       } finally {
         controlDependenceTimer.stop();
       }
@@ -240,24 +294,92 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     }
   }
 
+  /**
+   * Runs the pointer analysis that is shared by all dependence graphs created by this builder. This
+   * is done by {@link #build()} if necessary, but has to be done before calling {@link
+   * #build(Collection)}.
+   */
+  public void prepare() throws CPAException, InterruptedException {
+    if (prepared) {
+      return;
+    }
+
+    dependenceGraphConstructionTimer.start();
+    try {
+      if (considerFlowDeps) {
+        flowDependenceTimer.start();
+        try {
+          GlobalPointerState globalPointerState = createGlobalPointerState();
+          usedGlobalPointerState = globalPointerState.getClass().getSimpleName();
+
+          shutdownNotifier.shutdownIfNecessary();
+
+          foreignDefUseData = ForeignDefUseData.extract(cfa, defUseExtractor, globalPointerState);
+          pointerState = globalPointerState;
+        } finally {
+          flowDependenceTimer.stop();
+        }
+      }
+      prepared = true;
+    } finally {
+      dependenceGraphConstructionTimer.stop();
+    }
+  }
+
+  /** Creates the dependence graph of the whole program. */
   public CSystemDependenceGraph build() throws CPAException, InterruptedException {
+    prepare();
+    return build(function -> true);
+  }
+
+  /**
+   * Creates a dependence graph that is sufficient for slicing with the given criteria. It only
+   * contains the functions that may be executed before one of the criteria edges, because no other
+   * function can influence them. If the functions needed for the given criteria are already
+   * contained in the dependence graph created by the last call of this method, this dependence
+   * graph is returned again.
+   *
+   * <p>{@link #prepare()} has to be called before.
+   */
+  public CSystemDependenceGraph build(Collection<CFAEdge> pSlicingCriteria)
+      throws InterruptedException {
+    checkState(prepared, "prepare() has to be called before building for slicing criteria");
+
+    ImmutableSet<AFunctionDeclaration> functions = getFunctionsExecutedBefore(pSlicingCriteria);
+    if (lastSdgForCriteria != null && lastFunctionsForCriteria.containsAll(functions)) {
+      return lastSdgForCriteria;
+    }
+
+    lastSdgForCriteria = build(functions::contains);
+    lastFunctionsForCriteria = functions;
+    return lastSdgForCriteria;
+  }
+
+  private CSystemDependenceGraph build(Predicate<AFunctionDeclaration> pIsRelevantFunction)
+      throws InterruptedException {
 
     dependenceGraphConstructionTimer.start();
 
     try {
 
       CallGraph<AFunctionDeclaration> callGraph = CallGraphUtils.createCallGraph(cfa);
-      ImmutableSet<AFunctionDeclaration> reachableFunctions = ImmutableSet.of();
-      if (onlyReachableFunctions) {
-        AFunctionDeclaration mainFunction = cfa.getMainFunction().getFunction();
-        ImmutableSet.Builder<AFunctionDeclaration> reachableFunctionsBuilder =
-            ImmutableSet.builder();
-        reachableFunctionsBuilder.add(mainFunction);
-        reachableFunctionsBuilder.addAll(callGraph.getReachableFrom(ImmutableSet.of(mainFunction)));
-        reachableFunctions = reachableFunctionsBuilder.build();
-      }
-
-      insertDependencies(callGraph, reachableFunctions);
+      Predicate<AFunctionDeclaration> isIncludedFunction =
+          onlyReachableFunctions
+              ? pIsRelevantFunction.and(getReachableFunctions(callGraph)::contains)
+              : pIsRelevantFunction;
+      ImmutableList<FunctionEntryNode> functions =
+          from(cfa.entryNodes())
+              .filter(entryNode -> isIncludedFunction.test(entryNode.getFunction()))
+              .toList();
+      functionCount = functions.size();
+      logger.logf(
+          Level.FINE,
+          "Building dependence graph for %d of %d functions",
+          functions.size(),
+          cfa.entryNodes().size());
+
+      builder = SystemDependenceGraph.builder(CSystemDependenceGraph.Node::new);
+      insertDependencies(callGraph, functions);
       systemDependenceGraph = builder.build();
 
     } finally {
@@ -271,6 +393,91 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     return new CSystemDependenceGraph(systemDependenceGraph);
   }
 
+  private ImmutableSet<AFunctionDeclaration> getReachableFunctions(
+      CallGraph<AFunctionDeclaration> pCallGraph) {
+    AFunctionDeclaration mainFunction = cfa.getMainFunction().getFunction();
+    ImmutableSet.Builder<AFunctionDeclaration> reachableFunctionsBuilder = ImmutableSet.builder();
+    reachableFunctionsBuilder.add(mainFunction);
+    reachableFunctionsBuilder.addAll(pCallGraph.getReachableFrom(ImmutableSet.of(mainFunction)));
+    return reachableFunctionsBuilder.build();
+  }
+
+  /**
+   * Returns all functions that may be executed before one of the given edges, by a backwards
+   * traversal of the CFA that follows function calls and returns. For function call edges, the
+   * called function is included as well.
+   */
+  private static ImmutableSet<AFunctionDeclaration> getFunctionsExecutedBefore(
+      Collection<CFAEdge> pEdges) {
+
+    Set<AFunctionDeclaration> functions = new HashSet<>();
+    Set<CFANode> visited = new HashSet<>();
+    Deque<CFANode> waitlist = new ArrayDeque<>();
+
+    for (CFAEdge edge : pEdges) {
+      functions.add(edge.getSuccessor().getFunction());
+      if (visited.add(edge.getPredecessor())) {
+        waitlist.push(edge.getPredecessor());
+      }
+    }
+
+    while (!waitlist.isEmpty()) {
+      CFANode node = waitlist.pop();
+      functions.add(node.getFunction());
+      for (CFAEdge edge : CFAUtils.allEnteringEdges(node)) {
+        if (visited.add(edge.getPredecessor())) {
+          waitlist.push(edge.getPredecessor());
+        }
+      }
+    }
+
+    return ImmutableSet.copyOf(functions);
+  }
+
+  /**
+   * Computes a result for every given function and hands the results to the consumer in the order
+   * of the functions. The computations run in parallel if more than one thread is configured, so
+   * they must only read shared data. The consumer is always called in the current thread.
+   */
+  private <T> void forEachFunction(
+      List<FunctionEntryNode> pFunctions,
+      Function<FunctionEntryNode, T> pComputation,
+      BiConsumer<FunctionEntryNode, T> pConsumer)
+      throws InterruptedException {
+
+    int threadCount = Math.min(getThreads(), pFunctions.size());
+    if (threadCount <= 1) {
+      for (FunctionEntryNode entryNode : pFunctions) {
+        shutdownNotifier.shutdownIfNecessary();
+        pConsumer.accept(entryNode, pComputation.apply(entryNode));
+      }
+      return;
+    }
+
+    ExecutorService executor =
+        Executors.newFixedThreadPool(
+            threadCount,
+            new ThreadFactoryBuilder()
+                .setDaemon(true) // for killing hanging threads at program exit
+                .setNameFormat("dependence-graph-thread-%d")
+                .build());
+    try {
+      List<Future<T>> futures = new ArrayList<>(pFunctions.size());
+      for (FunctionEntryNode entryNode : pFunctions) {
+        futures.add(executor.submit(() -> pComputation.apply(entryNode)));
+      }
+      for (int i = 0; i < pFunctions.size(); i++) {
+        shutdownNotifier.shutdownIfNecessary();
+        pConsumer.accept(pFunctions.get(i), futures.get(i).get());
+      }
+    } catch (ExecutionException e) {
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError("unexpected exception during dependence computation", e);
+    } finally {
+      executor.shutdownNow();
+    }
+  }
+
   private static Optional<AFunctionDeclaration> getOptionalFunction(CFAEdge pEdge) {
 
     CFANode node =
@@ -695,20 +902,15 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     }
   }
 
-  private void insertFlowDependencies(ImmutableSet<AFunctionDeclaration> pReachableFunctions)
-      throws CPAException, InterruptedException {
-
-    GlobalPointerState pointerState = createGlobalPointerState();
-    if (pointerState != null) {
-      usedGlobalPointerState = pointerState.getClass().getSimpleName();
-    } else {
-      return;
-    }
+  /** A flow dependence found by {@link FlowDepAnalysis}, for inserting it later. */
+  private record FlowDependence(
+      CFAEdge defEdge, CFAEdge useEdge, MemoryLocation cause, boolean isDeclaration) {}
 
-    shutdownNotifier.shutdownIfNecessary();
+  private void insertFlowDependencies(ImmutableList<FunctionEntryNode> pFunctions)
+      throws InterruptedException {
 
-    ForeignDefUseData foreignDefUseData =
-        ForeignDefUseData.extract(cfa, defUseExtractor, pointerState);
+    GlobalPointerState globalPointerState = checkNotNull(pointerState);
+    ForeignDefUseData globalForeignDefUseData = checkNotNull(foreignDefUseData);
 
     ImmutableList<CFAEdge> globalEdges = getGlobalDeclarationEdges(cfa);
     ImmutableMultimap<String, CFAEdge> functionDeclarationEdges =
@@ -716,69 +918,77 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
     ImmutableMultimap<String, CFAEdge> complexTypeDeclarationEdges =
         getComplexTypeDeclarationEdges(globalEdges);
 
-    for (FunctionEntryNode entryNode : cfa.entryNodes()) {
-
-      shutdownNotifier.shutdownIfNecessary();
-
-      if (onlyReachableFunctions && !pReachableFunctions.contains(entryNode.getFunction())) {
-        continue;
-      }
-
-      DomTree<CFANode> domTree = DominanceUtils.createFunctionDomTree(entryNode);
-
-      insertFunctionDeclarationEdge(functionDeclarationEdges, entryNode);
-
-      DependenceConsumer dependenceConsumer =
-          (pDefEdge, pUseEdge, pCause, pIsDeclaration) ->
-              insertFlowDependency(
-                  pointerState, foreignDefUseData, pDefEdge, pUseEdge, pCause, pIsDeclaration);
-
-      boolean isMain = entryNode.equals(cfa.getMainFunction());
-
-      new FlowDepAnalysis(
-              domTree,
-              DomFrontiers.forDomTree(domTree),
-              entryNode,
-              isMain ? ImmutableList.of() : globalEdges,
-              defUseExtractor,
-              pointerState,
-              foreignDefUseData,
-              complexTypeDeclarationEdges,
-              dependenceConsumer)
-          .run();
-    }
+    // the analyses of the functions only collect the dependencies,
+    // inserting them into the dependence graph is not thread-safe
+    forEachFunction(
+        pFunctions,
+        entryNode -> {
+          DomTree<CFANode> domTree = DominanceUtils.createFunctionDomTree(entryNode);
+          List<FlowDependence> dependences = new ArrayList<>();
+          DependenceConsumer dependenceConsumer =
+              (pDefEdge, pUseEdge, pCause, pIsDeclaration) ->
+                  dependences.add(new FlowDependence(pDefEdge, pUseEdge, pCause, pIsDeclaration));
+
+          boolean isMain = entryNode.equals(cfa.getMainFunction());
+
+          new FlowDepAnalysis(
+                  domTree,
+                  DomFrontiers.forDomTree(domTree),
+                  entryNode,
+                  isMain ? ImmutableList.of() : globalEdges,
+                  defUseExtractor,
+                  globalPointerState,
+                  globalForeignDefUseData,
+                  complexTypeDeclarationEdges,
+                  dependenceConsumer)
+              .run();
+          return dependences;
+        },
+        (entryNode, dependences) -> {
+          insertFunctionDeclarationEdge(functionDeclarationEdges, entryNode);
+          for (FlowDependence dependence : dependences) {
+            insertFlowDependency(
+                globalPointerState,
+                globalForeignDefUseData,
+                dependence.defEdge(),
+                dependence.useEdge(),
+                dependence.cause(),
+                dependence.isDeclaration());
+          }
+        });
   }
 
-  private void insertControlDependencies(ImmutableSet<AFunctionDeclaration> pReachableFunctions) {
-
-    for (FunctionEntryNode entryNode : cfa.entryNodes()) {
-
-      if (onlyReachableFunctions && !pReachableFunctions.contains(entryNode.getFunction())) {
-        continue;
-      }
+  private void insertControlDependencies(ImmutableList<FunctionEntryNode> pFunctions)
+      throws InterruptedException {
+    forEachFunction(
+        pFunctions,
+        ControlDependenceBuilder::createPostDomTree,
+        (entryNode, postDomTree) -> insertControlDependencies(entryNode, postDomTree));
+  }
 
-      ControlDependenceBuilder.insertControlDependencies(
-          builder, entryNode, controlDepsTakeBothAssumptions);
+  private void insertControlDependencies(
+      FunctionEntryNode pEntryNode, DomTree<CFANode> pPostDomTree) {
+    ControlDependenceBuilder.insertControlDependencies(
+        builder, pEntryNode, pPostDomTree, controlDepsTakeBothAssumptions);
 
-      Optional<AFunctionDeclaration> procedure = Optional.of(entryNode.getFunction());
+    Optional<AFunctionDeclaration> procedure = Optional.of(pEntryNode.getFunction());
 
-      for (FunctionCallEdge edge : CFAUtils.enteringEdges(entryNode)) {
-        if (edge instanceof CFunctionCallEdge callEdge) {
+    for (FunctionCallEdge edge : CFAUtils.enteringEdges(pEntryNode)) {
+      if (edge instanceof CFunctionCallEdge callEdge) {
 
-          builder
-              .node(NodeType.ENTRY, procedure, Optional.empty(), Optional.empty())
-              .depends(EdgeType.CONTROL_DEPENDENCY, Optional.empty())
-              .on(NodeType.STATEMENT, procedure, Optional.of(callEdge), Optional.empty());
+        builder
+            .node(NodeType.ENTRY, procedure, Optional.empty(), Optional.empty())
+            .depends(EdgeType.CONTROL_DEPENDENCY, Optional.empty())
+            .on(NodeType.STATEMENT, procedure, Optional.of(callEdge), Optional.empty());
 
-          CFunctionSummaryEdge summaryEdge = callEdge.getSummaryEdge();
-          Optional<AFunctionDeclaration> callerProcedure =
-              Optional.of(callEdge.getPredecessor().getFunction());
+        CFunctionSummaryEdge summaryEdge = callEdge.getSummaryEdge();
+        Optional<AFunctionDeclaration> callerProcedure =
+            Optional.of(callEdge.getPredecessor().getFunction());
 
-          builder
-              .node(NodeType.STATEMENT, procedure, Optional.of(callEdge), Optional.empty())
-              .depends(EdgeType.CALL_EDGE, Optional.empty())
-              .on(NodeType.STATEMENT, callerProcedure, Optional.of(summaryEdge), Optional.empty());
-        }
+        builder
+            .node(NodeType.STATEMENT, procedure, Optional.of(callEdge), Optional.empty())
+            .depends(EdgeType.CALL_EDGE, Optional.empty())
+            .on(NodeType.STATEMENT, callerProcedure, Optional.of(summaryEdge), Optional.empty());
       }
     }
   }
@@ -825,6 +1035,7 @@ public class CSystemDependenceGraphBuilder implements StatisticsProvider {
               put(pOut, detailsIndentation, flowDependenceTimer);
               put(pOut, detailsIndentation, controlDependenceTimer);
               put(pOut, detailsIndentation, summaryEdgeTimer);
+              put(pOut, detailsIndentation, "Number of functions", String.valueOf(functionCount));
 
               for (var nodeType : SystemDependenceGraph.NodeType.values()) {
                 int nodeCount = systemDependenceGraph.getNodeCount(nodeType);
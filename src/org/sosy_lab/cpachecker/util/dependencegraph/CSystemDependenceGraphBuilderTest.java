@@ -0,0 +1,100 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.dependencegraph;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import java.util.Optional;
+import org.junit.Test;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.AFunctionDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class CSystemDependenceGraphBuilderTest {
+
+  private static final String[] PROGRAM = {
+    "int g;",
+    "void init() { g = 1; }",
+    "void check() { if (g != 1) { g = 3; } }",
+    "void cleanup() { g = 0; }",
+    "int main() { init(); check(); cleanup(); return g; }"
+  };
+
+  private static CSystemDependenceGraphBuilder createBuilder(CFA pCfa, int pThreads)
+      throws InvalidConfigurationException {
+    Configuration config =
+        TestDataTools.configurationForTest()
+            .setOption("dependencegraph.considerPointees", "false")
+            .setOption("dependencegraph.threads", String.valueOf(pThreads))
+            .build();
+    return new CSystemDependenceGraphBuilder(
+        pCfa, config, LogManager.createTestLogManager(), ShutdownNotifier.createDummy());
+  }
+
+  private static ImmutableSet<String> getProcedureNames(CSystemDependenceGraph pSdg) {
+    return pSdg.getNodes().stream()
+        .map(CSystemDependenceGraph.Node::getProcedure)
+        .flatMap(Optional::stream)
+        .map(AFunctionDeclaration::getName)
+        .collect(ImmutableSet.toImmutableSet());
+  }
+
+  @Test
+  public void testParallelBuildIsDeterministic()
+      throws InvalidConfigurationException, ParserException, CPAException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+
+    CSystemDependenceGraph sequential = createBuilder(cfa, 1).build();
+    CSystemDependenceGraph parallel = createBuilder(cfa, 4).build();
+
+    assertThat(ImmutableList.copyOf(parallel.getNodes()))
+        .containsExactlyElementsIn(sequential.getNodes())
+        .inOrder();
+    for (SystemDependenceGraph.EdgeType edgeType : SystemDependenceGraph.EdgeType.values()) {
+      assertThat(parallel.getEdgeCount(edgeType)).isEqualTo(sequential.getEdgeCount(edgeType));
+    }
+  }
+
+  @Test
+  public void testBuildForSlicingCriteria()
+      throws InvalidConfigurationException, ParserException, CPAException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    CFAEdge criterion =
+        CFAUtils.allEdges(cfa).stream()
+            .filter(edge -> edge.getRawStatement().equals("g = 3;"))
+            .findFirst()
+            .orElseThrow();
+
+    CSystemDependenceGraphBuilder builder = createBuilder(cfa, 1);
+    builder.prepare();
+    CSystemDependenceGraph sdg = builder.build(ImmutableList.of(criterion));
+
+    // cleanup() is only executed after the criterion and cannot influence it
+    assertThat(getProcedureNames(sdg)).containsExactly("main", "init", "check");
+    assertThat(getProcedureNames(createBuilder(cfa, 1).build()))
+        .containsExactly("main", "init", "check", "cleanup");
+  }
+
+  @Test(expected = IllegalStateException.class)
+  public void testBuildForSlicingCriteriaNeedsPreparation()
+      throws InvalidConfigurationException, ParserException, InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    createBuilder(cfa, 1).build(ImmutableList.of());
+  }
+}
@@ -63,6 +63,20 @@ final class ControlDependenceBuilder<N extends Node<AFunctionDeclaration, CFAEdg
         .filter(edge -> !ignoreFunctionEdge(edge));
   }
 
+  /**
+   * Create the post-DomTree of a function that is needed for computing its control dependencies.
+   * This does not access any SDG builder and can be done for several functions in parallel.
+   *
+   * @param pEntryNode the function (specified by its entry node) to create the post-DomTree for
+   * @return the post-DomTree of the function, empty if the function has no exit node
+   */
+  static DomTree<CFANode> createPostDomTree(FunctionEntryNode pEntryNode) {
+    return pEntryNode
+        .getExitNode()
+        .map(DominanceUtils::createFunctionPostDomTree)
+        .orElse(DomTree.empty());
+  }
+
   /**
    * Compute control dependencies for a specified function and insert them into a {@link
    * SystemDependenceGraph}.
@@ -70,32 +84,29 @@ final class ControlDependenceBuilder<N extends Node<AFunctionDeclaration, CFAEdg
    * @param pBuilder the SDG builder used to insert dependencies
    * @param pEntryNode the function (specified by its entry node) to compute control dependencies
    *     for
+   * @param pPostDomTree the post-DomTree of the function, see {@link #createPostDomTree}
    * @param pDependOnBothAssumptions whether to always depend on both assume edges of a branching,
    *     even if it would be sufficient to only depend on one of the assume edges
    */
   static void insertControlDependencies(
       SystemDependenceGraph.Builder<AFunctionDeclaration, CFAEdge, ?, ?> pBuilder,
       FunctionEntryNode pEntryNode,
+      DomTree<CFANode> pPostDomTree,
       boolean pDependOnBothAssumptions) {
 
     ControlDependenceBuilder<?> controlDependenceBuilder =
         new ControlDependenceBuilder<>(pBuilder, pEntryNode);
 
-    DomTree<CFANode> postDomTree =
-        pEntryNode
-            .getExitNode()
-            .map(DominanceUtils::createFunctionPostDomTree)
-            .orElse(DomTree.empty());
-    ImmutableSet<CFANode> postDomTreeNodes = ImmutableSet.copyOf(postDomTree);
+    ImmutableSet<CFANode> postDomTreeNodes = ImmutableSet.copyOf(pPostDomTree);
 
     controlDependenceBuilder.insertControlDependencies(
-        postDomTree, postDomTreeNodes, pDependOnBothAssumptions);
+        pPostDomTree, postDomTreeNodes, pDependOnBothAssumptions);
 
     NodeCollectingCFAVisitor nodeCollector = new NodeCollectingCFAVisitor();
     CFATraversal.dfs().ignoreFunctionCalls().traverse(pEntryNode, nodeCollector);
 
     controlDependenceBuilder.insertMissingControlDependencies(
-        postDomTree, postDomTreeNodes, nodeCollector.getVisitedNodes());
+        pPostDomTree, postDomTreeNodes, nodeCollector.getVisitedNodes());
 
     controlDependenceBuilder.insertEntryControlDependencies(nodeCollector.getVisitedNodes());
   }
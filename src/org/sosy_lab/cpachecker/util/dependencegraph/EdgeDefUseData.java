@@ -10,12 +10,12 @@ package org.sosy_lab.cpachecker.util.dependencegraph;
 
 import com.google.common.base.Equivalence;
 import com.google.common.collect.ImmutableSet;
-import java.util.HashMap;
 import java.util.HashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
 import org.sosy_lab.cpachecker.cfa.ast.AAstNode;
 import org.sosy_lab.cpachecker.cfa.ast.c.CAddressOfLabelExpression;
 import org.sosy_lab.cpachecker.cfa.ast.c.CArrayDesignator;
@@ -179,6 +179,7 @@ public final class EdgeDefUseData {
     EdgeDefUseData extract(CAstNode pAstNode);
   }
 
+  /** Extractor that caches the results of its delegate. It can be used by several threads. */
   public static final class CachingExtractor implements Extractor {
 
     private final Extractor delegateExtractor;
@@ -186,7 +187,7 @@ public final class EdgeDefUseData {
 
     public CachingExtractor(Extractor pDelegateExtractor) {
       delegateExtractor = pDelegateExtractor;
-      cache = new HashMap<>();
+      cache = new ConcurrentHashMap<>();
     }
 
     @Override
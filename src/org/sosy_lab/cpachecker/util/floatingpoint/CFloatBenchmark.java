@@ -0,0 +1,171 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.floatingpoint;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.function.BiFunction;
+import org.sosy_lab.common.annotations.SuppressForbidden;
+
+/**
+ * Micro benchmark comparing the implementations of {@link CFloat} for all arithmetic, cast, and
+ * comparison operations on <code>float</code>, <code>double</code>, and <code>long double</code>.
+ *
+ * <p>Run it with <code>ant benchmark-cfloat</code> or directly as main class, optionally with the
+ * number of measured rounds as argument. Each operation is first run for some warm-up rounds and
+ * then measured over the given rounds, the table shows the average time per operation. The native
+ * implementation is skipped if the native library is not available. Operations that an
+ * implementation does not support, which includes operations that are not implemented yet and
+ * return null, are shown as "n/a".
+ */
+public final class CFloatBenchmark {
+
+  private static final int WARMUP_ROUNDS = 50;
+  private static final int DEFAULT_ROUNDS = 200;
+
+  private static final ImmutableList<String> OPERANDS =
+      ImmutableList.of("1.5", "-2.25", "10", "0.375", "-7", "3", "1024.125", "-0.5");
+
+  private static final ImmutableMap<Integer, String> TYPES =
+      ImmutableMap.of(
+          CFloatNativeAPI.FP_TYPE_SINGLE, "float",
+          CFloatNativeAPI.FP_TYPE_DOUBLE, "double",
+          CFloatNativeAPI.FP_TYPE_LONG_DOUBLE, "long double");
+
+  private static final ImmutableMap<String, BiFunction<CFloat, CFloat, Object>> OPERATIONS =
+      ImmutableMap.<String, BiFunction<CFloat, CFloat, Object>>builder()
+          .put("add", CFloat::add)
+          .put("subtract", CFloat::subtract)
+          .put("multiply", CFloat::multiply)
+          .put("divideBy", CFloat::divideBy)
+          .put("powTo", CFloat::powTo)
+          .put("powToIntegral", (a, b) -> a.powToIntegral(3))
+          .put("sqrt", (a, b) -> a.abs().sqrt())
+          .put("round", (a, b) -> a.round())
+          .put("trunc", (a, b) -> a.trunc())
+          .put("ceil", (a, b) -> a.ceil())
+          .put("floor", (a, b) -> a.floor())
+          .put("abs", (a, b) -> a.abs())
+          .put("copySignFrom", CFloat::copySignFrom)
+          .put("castTo(float)", (a, b) -> a.castTo(CFloatNativeAPI.FP_TYPE_SINGLE))
+          .put("castTo(double)", (a, b) -> a.castTo(CFloatNativeAPI.FP_TYPE_DOUBLE))
+          .put("castTo(long double)", (a, b) -> a.castTo(CFloatNativeAPI.FP_TYPE_LONG_DOUBLE))
+          .put("castToOther(int)", (a, b) -> a.castToOther(CFloatNativeAPI.TYPE_INT))
+          .put("greaterThan", CFloat::greaterThan)
+          .put("isZero", (a, b) -> a.isZero())
+          .put("isNegative", (a, b) -> a.isNegative())
+          .buildOrThrow();
+
+  /** Keeps results alive such that the JIT compiler cannot remove the measured operations. */
+  @SuppressWarnings("unused")
+  private static volatile int sink;
+
+  private CFloatBenchmark() {}
+
+  private interface Implementation {
+    CFloat create(String pRep, int pType);
+  }
+
+  @SuppressForbidden("benchmark output")
+  public static void main(String[] args) {
+    int rounds = args.length > 0 ? Integer.parseInt(args[0]) : DEFAULT_ROUNDS;
+    run(rounds, System.out);
+  }
+
+  @SuppressWarnings("deprecation")
+  static void run(int pRounds, PrintStream pOut) {
+    Map<String, Implementation> implementations = new LinkedHashMap<>();
+    implementations.put("factory", CFloatFactory::create);
+    implementations.put("impl", CFloatImpl::new);
+    if (isNativeAvailable()) {
+      implementations.put("native", CFloatNative::new);
+    }
+
+    pOut.printf("%-22s %-12s", "operation", "type");
+    for (String name : implementations.keySet()) {
+      pOut.printf(" %14s", name + " ns/op");
+    }
+    pOut.println();
+
+    for (Map.Entry<String, BiFunction<CFloat, CFloat, Object>> operation : OPERATIONS.entrySet()) {
+      for (Map.Entry<Integer, String> type : TYPES.entrySet()) {
+        pOut.printf("%-22s %-12s", operation.getKey(), type.getValue());
+        for (Implementation implementation : implementations.values()) {
+          String time = measure(implementation, type.getKey(), operation.getValue(), pRounds);
+          pOut.printf(" %14s", time);
+        }
+        pOut.println();
+      }
+    }
+  }
+
+  private static String measure(
+      Implementation pImplementation,
+      int pType,
+      BiFunction<CFloat, CFloat, Object> pOperation,
+      int pRounds) {
+    List<CFloat> operands = new ArrayList<>(OPERANDS.size());
+    try {
+      for (String rep : OPERANDS) {
+        operands.add(pImplementation.create(rep, pType));
+      }
+      if (!isImplemented(operands, pOperation)) {
+        return "n/a";
+      }
+      runRounds(operands, pOperation, WARMUP_ROUNDS);
+      long start = System.nanoTime();
+      runRounds(operands, pOperation, pRounds);
+      long time = System.nanoTime() - start;
+      long count = (long) pRounds * operands.size() * operands.size();
+      return String.format("%.1f", (double) time / count);
+    } catch (IllegalArgumentException | UnsupportedOperationException e) {
+      // some implementations do not support all types and operations
+      return "n/a";
+    }
+  }
+
+  /** Unimplemented operations return null, measuring them would only measure the stub. */
+  private static boolean isImplemented(
+      List<CFloat> pOperands, BiFunction<CFloat, CFloat, Object> pOperation) {
+    for (CFloat a : pOperands) {
+      for (CFloat b : pOperands) {
+        if (pOperation.apply(a, b) == null) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  private static void runRounds(
+      List<CFloat> pOperands, BiFunction<CFloat, CFloat, Object> pOperation, int pRounds) {
+    int result = 0;
+    for (int round = 0; round < pRounds; round++) {
+      for (CFloat a : pOperands) {
+        for (CFloat b : pOperands) {
+          result += pOperation.apply(a, b).hashCode();
+        }
+      }
+    }
+    sink = result;
+  }
+
+  private static boolean isNativeAvailable() {
+    try {
+      return CFloatNativeAPI.ONE_SINGLE != null;
+    } catch (UnsatisfiedLinkError | ExceptionInInitializerError | NoClassDefFoundError e) {
+      return false;
+    }
+  }
+}
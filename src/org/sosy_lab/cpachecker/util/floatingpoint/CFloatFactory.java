@@ -0,0 +1,55 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.floatingpoint;
+
+/**
+ * Creates {@link CFloat} instances with the cheapest implementation for the requested type.
+ *
+ * <p><code>float</code> and <code>double</code> are represented by {@link CFloatIeee}, which
+ * computes with the Java types directly. Only x87 <code>long double</code>, which has no
+ * counterpart in Java, and literals that Java cannot parse use the general implementation {@link
+ * CFloatImpl}. {@link CFloatBenchmark} compares the costs of all implementations.
+ */
+public final class CFloatFactory {
+
+  private CFloatFactory() {}
+
+  /**
+   * Create a {@link CFloat} from a literal without suffix, e.g., <code>1.5</code>, <code>0x1p-3
+   * </code>, or <code>-inf</code>.
+   */
+  public static CFloat create(String pRep, int pType) {
+    if (CFloatIeee.isSupportedType(pType)) {
+      try {
+        return CFloatIeee.parse(pRep, pType);
+      } catch (NumberFormatException e) {
+        // not a Java floating point literal, try the general parser
+      }
+    }
+    return new CFloatImpl(pRep, pType);
+  }
+
+  /** Create a {@link CFloat} from its bit representation. */
+  static CFloat create(CFloatWrapper pWrapper, int pType) {
+    if (CFloatIeee.isSupportedType(pType)) {
+      return CFloatIeee.ofWrapper(pWrapper, pType);
+    }
+    return new CFloatImpl(pWrapper, pType);
+  }
+
+  /** Create a {@link CFloat} of type <code>float</code>. */
+  public static CFloat fromFloat(float pValue) {
+    return CFloatIeee.ofFloat(pValue);
+  }
+
+  /** Create a {@link CFloat} of type <code>double</code>. */
+  public static CFloat fromDouble(double pValue) {
+    return CFloatIeee.ofDouble(pValue);
+  }
+}
@@ -0,0 +1,405 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.floatingpoint;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import com.google.common.primitives.UnsignedLong;
+import java.math.BigDecimal;
+import java.math.BigInteger;
+import java.math.MathContext;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Implementation of {@link CFloat} for the types <code>float</code> and <code>double</code>, which
+ * are IEEE-754 binary32 and binary64 formats on all relevant platforms and thus identical to the
+ * Java types <code>float</code> and <code>double</code>.
+ *
+ * <p>The operations are computed directly by the Java arithmetic on the bit representation, which
+ * is much faster than {@link CFloatImpl} and does not need the native library like {@link
+ * CFloatNative}. Operations involving <code>long double</code> are delegated to {@link CFloatImpl}.
+ * {@link CFloatBenchmark} compares the costs of all implementations.
+ */
+final class CFloatIeee extends CFloat {
+
+  private static final int FLOAT_MANTISSA_BITS = 23;
+  private static final int DOUBLE_MANTISSA_BITS = 52;
+
+  /**
+   * Maximal number of digits of an exact power in {@link #powToIntegral(int)}. Larger powers are
+   * computed with {@link #POW_CONTEXT} instead.
+   */
+  private static final long MAX_EXACT_POW_DIGITS = 2000;
+
+  /** Far more digits than a double has, such that rounding the result is not affected. */
+  private static final MathContext POW_CONTEXT = new MathContext(64);
+
+  /** The raw bits, for <code>float</code> only the lower 32 bits are used. */
+  private final long bits;
+
+  private final int type;
+
+  private CFloatIeee(long pBits, int pType) {
+    bits = pBits;
+    type = pType;
+  }
+
+  static boolean isSupportedType(int pType) {
+    return pType == CFloatNativeAPI.FP_TYPE_SINGLE || pType == CFloatNativeAPI.FP_TYPE_DOUBLE;
+  }
+
+  static CFloatIeee ofFloat(float pValue) {
+    return new CFloatIeee(
+        Integer.toUnsignedLong(Float.floatToRawIntBits(pValue)), CFloatNativeAPI.FP_TYPE_SINGLE);
+  }
+
+  static CFloatIeee ofDouble(double pValue) {
+    return new CFloatIeee(Double.doubleToRawLongBits(pValue), CFloatNativeAPI.FP_TYPE_DOUBLE);
+  }
+
+  static CFloatIeee ofWrapper(CFloatWrapper pWrapper, int pType) {
+    checkArgument(isSupportedType(pType), "unsupported type %s", pType);
+    int mantissaBits =
+        pType == CFloatNativeAPI.FP_TYPE_SINGLE ? FLOAT_MANTISSA_BITS : DOUBLE_MANTISSA_BITS;
+    return new CFloatIeee((pWrapper.getExponent() << mantissaBits) | pWrapper.getMantissa(), pType);
+  }
+
+  /**
+   * Parse a C floating point literal without suffix, like <code>1.5</code>, <code>0x1p-3</code>,
+   * <code>inf</code>, or <code>-nan</code>.
+   */
+  static CFloatIeee parse(String pRep, int pType) {
+    checkArgument(isSupportedType(pType), "unsupported type %s", pType);
+    String rep = pRep.trim();
+    boolean negative = rep.startsWith("-");
+    String abs = negative || rep.startsWith("+") ? rep.substring(1) : rep;
+    double value;
+    if (abs.equalsIgnoreCase("nan")) {
+      value = Double.NaN;
+    } else if (abs.equalsIgnoreCase("inf") || abs.equalsIgnoreCase("infinity")) {
+      value = Double.POSITIVE_INFINITY;
+    } else if (pType == CFloatNativeAPI.FP_TYPE_SINGLE) {
+      // parse directly as float to avoid double rounding
+      float f = Float.parseFloat(abs);
+      return ofFloat(negative ? -f : f);
+    } else {
+      value = Double.parseDouble(abs);
+    }
+    value = Math.copySign(value, negative ? -1.0 : 1.0);
+    return pType == CFloatNativeAPI.FP_TYPE_SINGLE ? ofFloat((float) value) : ofDouble(value);
+  }
+
+  private boolean isSingle() {
+    return type == CFloatNativeAPI.FP_TYPE_SINGLE;
+  }
+
+  private float floatValue() {
+    return Float.intBitsToFloat((int) bits);
+  }
+
+  /** The value as double, which is exact for both types. */
+  private double doubleValue() {
+    return isSingle() ? floatValue() : Double.longBitsToDouble(bits);
+  }
+
+  private static CFloatIeee ofType(double pValue, int pType) {
+    return pType == CFloatNativeAPI.FP_TYPE_SINGLE ? ofFloat((float) pValue) : ofDouble(pValue);
+  }
+
+  /** Returns the operand as {@link CFloatIeee} if possible, or null for long double. */
+  private static @Nullable CFloatIeee asIeee(CFloat pOther) {
+    if (pOther instanceof CFloatIeee ieee) {
+      return ieee;
+    }
+    if (isSupportedType(pOther.getType())) {
+      return ofWrapper(pOther.copyWrapper(), pOther.getType());
+    }
+    return null;
+  }
+
+  /** The general implementation, used for all operations involving long double. */
+  private CFloat toGeneral() {
+    return new CFloatImpl(copyWrapper(), type);
+  }
+
+  @Override
+  public CFloat add(CFloat pSummand) {
+    CFloatIeee other = asIeee(pSummand);
+    if (other == null) {
+      return toGeneral().add(pSummand);
+    }
+    if (isSingle() && other.isSingle()) {
+      return ofFloat(floatValue() + other.floatValue());
+    }
+    return ofDouble(doubleValue() + other.doubleValue());
+  }
+
+  @Override
+  public CFloat add(CFloat... pSummands) {
+    CFloat result = this;
+    for (CFloat summand : pSummands) {
+      result = result.add(summand);
+    }
+    return result;
+  }
+
+  @Override
+  public CFloat multiply(CFloat pFactor) {
+    CFloatIeee other = asIeee(pFactor);
+    if (other == null) {
+      return toGeneral().multiply(pFactor);
+    }
+    if (isSingle() && other.isSingle()) {
+      return ofFloat(floatValue() * other.floatValue());
+    }
+    return ofDouble(doubleValue() * other.doubleValue());
+  }
+
+  @Override
+  public CFloat multiply(CFloat... pFactors) {
+    CFloat result = this;
+    for (CFloat factor : pFactors) {
+      result = result.multiply(factor);
+    }
+    return result;
+  }
+
+  @Override
+  public CFloat subtract(CFloat pSubtrahend) {
+    CFloatIeee other = asIeee(pSubtrahend);
+    if (other == null) {
+      return toGeneral().subtract(pSubtrahend);
+    }
+    if (isSingle() && other.isSingle()) {
+      return ofFloat(floatValue() - other.floatValue());
+    }
+    return ofDouble(doubleValue() - other.doubleValue());
+  }
+
+  @Override
+  public CFloat divideBy(CFloat pDivisor) {
+    CFloatIeee other = asIeee(pDivisor);
+    if (other == null) {
+      return toGeneral().divideBy(pDivisor);
+    }
+    if (isSingle() && other.isSingle()) {
+      return ofFloat(floatValue() / other.floatValue());
+    }
+    return ofDouble(doubleValue() / other.doubleValue());
+  }
+
+  @Override
+  public CFloat powTo(CFloat pExponent) {
+    CFloatIeee other = asIeee(pExponent);
+    if (other == null) {
+      return toGeneral().powTo(pExponent);
+    }
+    return ofType(StrictMath.pow(doubleValue(), other.doubleValue()), Math.max(type, other.type));
+  }
+
+  @Override
+  public CFloat powToIntegral(int pExponent) {
+    checkArgument(pExponent >= 0, "negative exponents are not supported");
+    double base = doubleValue();
+    // log2 of the absolute value of the result, only used to detect overflow and underflow
+    double log2 = pExponent * (Math.log(Math.abs(base)) / Math.log(2));
+    if (pExponent <= 1
+        || !Double.isFinite(base)
+        || base == 0
+        || Math.abs(base) == 1
+        || log2 > Double.MAX_EXPONENT + 8
+        || log2 < Double.MIN_EXPONENT - DOUBLE_MANTISSA_BITS - 8) {
+      // the result is exact or far out of range, so pow is correctly rounded
+      return ofType(Math.pow(base, pExponent), type);
+    }
+
+    // Compute the power exactly and round only once, rounding after each multiplication
+    // could be off by several ulps.
+    BigDecimal exact = new BigDecimal(base);
+    BigDecimal power =
+        exact.precision() * (long) pExponent <= MAX_EXACT_POW_DIGITS
+            ? exact.pow(pExponent)
+            : exact.pow(pExponent, POW_CONTEXT);
+    // BigDecimal has no negative zero, restore the sign of an underflow
+    double sign = base < 0 && pExponent % 2 == 1 ? -1.0 : 1.0;
+    if (isSingle()) {
+      return ofFloat(Math.copySign(power.floatValue(), (float) sign));
+    }
+    return ofDouble(Math.copySign(power.doubleValue(), sign));
+  }
+
+  @Override
+  public CFloat sqrt() {
+    // sqrt in double is correctly rounded, and rounding it to float is still correct
+    return ofType(Math.sqrt(doubleValue()), type);
+  }
+
+  @Override
+  public CFloat round() {
+    // C rounds half-way cases away from zero, unlike Math.round()
+    double value = doubleValue();
+    double abs = Math.abs(value);
+    double result = Math.floor(abs);
+    if (abs - result >= 0.5) {
+      result += 1.0;
+    }
+    return ofType(Math.copySign(result, value), type);
+  }
+
+  @Override
+  public CFloat trunc() {
+    double value = doubleValue();
+    return ofType(Math.copySign(Math.floor(Math.abs(value)), value), type);
+  }
+
+  @Override
+  public CFloat ceil() {
+    return ofType(Math.ceil(doubleValue()), type);
+  }
+
+  @Override
+  public CFloat floor() {
+    return ofType(Math.floor(doubleValue()), type);
+  }
+
+  @Override
+  public CFloat abs() {
+    return isSingle() ? ofFloat(Math.abs(floatValue())) : ofDouble(Math.abs(doubleValue()));
+  }
+
+  @Override
+  public boolean isZero() {
+    return doubleValue() == 0.0;
+  }
+
+  @Override
+  public boolean isOne() {
+    return doubleValue() == 1.0;
+  }
+
+  @Override
+  public boolean isNan() {
+    return Double.isNaN(doubleValue());
+  }
+
+  @Override
+  public boolean isInfinity() {
+    return Double.isInfinite(doubleValue());
+  }
+
+  @Override
+  public boolean isNegative() {
+    return isSingle() ? (int) bits < 0 : bits < 0;
+  }
+
+  @Override
+  public CFloat copySignFrom(CFloat pSource) {
+    if (type != pSource.getType()) {
+      throw new IllegalArgumentException(
+          "Type "
+              + type
+              + " of first argument and type "
+              + pSource.getType()
+              + " of second argument must not be different.");
+    }
+    boolean negative = pSource.isNegative();
+    if (isSingle()) {
+      return new CFloatIeee(negative ? bits | 0x80000000L : bits & 0x7FFFFFFFL, type);
+    }
+    return new CFloatIeee(negative ? bits | Long.MIN_VALUE : bits & Long.MAX_VALUE, type);
+  }
+
+  @Override
+  public CFloat castTo(int pToType) {
+    if (pToType == type) {
+      return this;
+    }
+    return switch (pToType) {
+      case CFloatNativeAPI.FP_TYPE_SINGLE -> ofFloat((float) doubleValue());
+      case CFloatNativeAPI.FP_TYPE_DOUBLE -> ofDouble(doubleValue());
+      default -> toGeneral().castTo(pToType);
+    };
+  }
+
+  /**
+   * Convert the value to an integer type, rounding toward zero. As Java has no unsigned types, the
+   * value for an unsigned type is returned as the next larger Java type, or as {@link BigInteger}
+   * for 64 bits. The result for values outside the range of the target type is undefined in C,
+   * here they are truncated to the width of the target type.
+   */
+  @Override
+  public Number castToOther(int pToType) {
+    double value = doubleValue();
+    return switch (pToType) {
+      case CFloatNativeAPI.TYPE_CHAR -> (byte) value;
+      case CFloatNativeAPI.TYPE_SHORT -> (short) value;
+      case CFloatNativeAPI.TYPE_INT -> (int) value;
+      case CFloatNativeAPI.TYPE_LONG, CFloatNativeAPI.TYPE_LONG_LONG -> (long) value;
+      case CFloatNativeAPI.TYPE_UCHAR -> (short) ((long) value & 0xFFL);
+      case CFloatNativeAPI.TYPE_USHORT -> (int) ((long) value & 0xFFFFL);
+      case CFloatNativeAPI.TYPE_UINT -> (long) value & 0xFFFFFFFFL;
+      case CFloatNativeAPI.TYPE_ULONG, CFloatNativeAPI.TYPE_ULONG_LONG ->
+          UnsignedLong.fromLongBits(toUnsignedLongBits(value)).bigIntegerValue();
+      default -> throw new IllegalArgumentException("Unsupported target type: " + pToType);
+    };
+  }
+
+  /** Values from 2^63 on do not fit into a signed long and are shifted before the conversion. */
+  private static long toUnsignedLongBits(double pValue) {
+    if (pValue < 0x1p63) {
+      return (long) pValue;
+    }
+    return (long) (pValue - 0x1p63) | Long.MIN_VALUE;
+  }
+
+  @Override
+  public CFloatWrapper copyWrapper() {
+    return getWrapper();
+  }
+
+  @Override
+  protected CFloatWrapper getWrapper() {
+    int mantissaBits = isSingle() ? FLOAT_MANTISSA_BITS : DOUBLE_MANTISSA_BITS;
+    long mantissa = bits & ((1L << mantissaBits) - 1);
+    return new CFloatWrapper(bits >>> mantissaBits, mantissa);
+  }
+
+  @Override
+  public int getType() {
+    return type;
+  }
+
+  @Override
+  public boolean greaterThan(CFloat pOther) {
+    CFloatIeee other = asIeee(pOther);
+    if (other == null) {
+      return toGeneral().greaterThan(pOther);
+    }
+    return doubleValue() > other.doubleValue();
+  }
+
+  /**
+   * Formats the exact decimal value without exponent and with trailing zeros removed, like {@link
+   * CFloatNative#toString()} and {@link CFloatImpl#toString()}. This is not the shortest
+   * representation that {@link Double#toString(double)} would give.
+   */
+  @Override
+  public String toString() {
+    double value = doubleValue();
+    String sign = isNegative() ? "-" : "";
+    if (Double.isNaN(value)) {
+      return sign + "nan";
+    } else if (Double.isInfinite(value)) {
+      return sign + "inf";
+    }
+    // BigDecimal is exact for doubles
+    String digits = new BigDecimal(Math.abs(value)).toPlainString();
+    return sign + (digits.contains(".") ? digits : digits + ".0");
+  }
+}
@@ -21,8 +21,29 @@ import org.sosy_lab.common.NativeLibraries;
 public class CFloatNativeAPI {
   private CFloatNativeAPI() {}
 
+  /** Whether the loaded library provides {@link #evaluateFp} (older builds do not). */
+  private static final boolean batchSupported;
+
   static {
     NativeLibraries.loadLibrary("FloatingPoints");
+    batchSupported = probeBatchSupport();
+  }
+
+  private static boolean probeBatchSupport() {
+    try {
+      evaluateFp(new int[0], new long[0], new long[0], new int[0]);
+      return true;
+    } catch (UnsatisfiedLinkError e) {
+      return false;
+    }
+  }
+
+  /**
+   * Whether {@link #evaluateFp} is available. The prebuilt library may be older than the sources,
+   * {@link CFloatNativeBatch} then evaluates the operations one by one.
+   */
+  public static boolean isBatchSupported() {
+    return batchSupported;
   }
 
   public enum CNativeType {
@@ -78,6 +99,21 @@ public class CFloatNativeAPI {
   public static final int TYPE_ULONG = 11;
   public static final int TYPE_ULONG_LONG = 12;
 
+  // Operations for evaluateFp, binary operations come first.
+  public static final int OP_ADD = 0;
+  public static final int OP_SUBTRACT = 1;
+  public static final int OP_MULTIPLY = 2;
+  public static final int OP_DIVIDE = 3;
+  public static final int OP_POW = 4;
+  public static final int OP_COPYSIGN = 5;
+  public static final int OP_SQRT = 6;
+  public static final int OP_ROUND = 7;
+  public static final int OP_TRUNC = 8;
+  public static final int OP_CEIL = 9;
+  public static final int OP_FLOOR = 10;
+  public static final int OP_ABS = 11;
+  public static final int OP_CAST = 12;
+
   static {
     ZERO_SINGLE = new CFloatImpl(createFp("0.0", FP_TYPE_SINGLE), FP_TYPE_SINGLE);
     ONE_SINGLE = new CFloatImpl(createFp("1.0", FP_TYPE_SINGLE), FP_TYPE_SINGLE);
@@ -148,4 +184,17 @@ public class CFloatNativeAPI {
   public static native CFloatWrapper castOtherToFp(Number value, int from_type, int to_fp_type);
 
   public static native Number castFpToOther(CFloatWrapper fp, int fp_from_type, int to_type);
+
+  /**
+   * Evaluate a sequence of operations with a single native call, without creating {@link
+   * CFloatWrapper} objects. Slot {@code i} holds the number with bit-masks {@code pExponents[i]}
+   * and {@code pMantissas[i]} and type {@code pTypes[i]}. Each operation is given by four entries
+   * of {@code pProgram}: one of the {@code OP_*} constants, the slot of the first operand, the slot
+   * of the second operand (the target type for {@link #OP_CAST}, ignored for other unary
+   * operations), and the slot for the result. Results are written into the arrays, so an operation
+   * can use the results of the operations before it. {@link CFloatNativeBatch} provides a more
+   * convenient interface. Check {@link #isBatchSupported()} before calling this method.
+   */
+  public static native void evaluateFp(
+      int[] pProgram, long[] pExponents, long[] pMantissas, int[] pTypes);
 }
@@ -0,0 +1,190 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.floatingpoint;
+
+import static com.google.common.base.Preconditions.checkArgument;
+import static com.google.common.base.Preconditions.checkElementIndex;
+import static com.google.common.base.Preconditions.checkState;
+
+import java.util.Arrays;
+
+/**
+ * Collects floating point operations such that they can be evaluated by {@link
+ * CFloatNativeAPI#evaluateFp} with a single call into the native library.
+ *
+ * <p>Operands and results are referenced by slots: {@link #add(CFloat)} stores a value and returns
+ * its slot, each operation returns the slot of its result. The results are available via {@link
+ * #get(int)} after {@link #evaluate()}. Example for computing {@code sqrt(a + b)}:
+ *
+ * <pre>{@code
+ * CFloatNativeBatch batch = new CFloatNativeBatch();
+ * int sum = batch.apply(CFloatNativeAPI.OP_ADD, batch.add(a), batch.add(b));
+ * int root = batch.apply(CFloatNativeAPI.OP_SQRT, sum);
+ * batch.evaluate();
+ * CFloat result = batch.get(root);
+ * }</pre>
+ *
+ * <p>If the native library does not provide {@link CFloatNativeAPI#evaluateFp}, the operations are
+ * evaluated one by one with the scalar operations of {@link CFloatNative}.
+ */
+public final class CFloatNativeBatch {
+
+  private static final int UNKNOWN_TYPE = -1;
+  private static final int INITIAL_CAPACITY = 16;
+
+  private long[] exponents = new long[INITIAL_CAPACITY];
+  private long[] mantissas = new long[INITIAL_CAPACITY];
+  private int[] types = new int[INITIAL_CAPACITY];
+  private int slots = 0;
+
+  private int[] program = new int[4 * INITIAL_CAPACITY];
+  private int programLength = 0;
+
+  /** Length of the prefix of the program that was already evaluated. */
+  private int evaluatedLength = 0;
+
+  /** Add a value and return its slot. */
+  public int add(CFloat pValue) {
+    CFloatWrapper wrapper = pValue.copyWrapper();
+    return newSlot(wrapper.getExponent(), wrapper.getMantissa(), pValue.getType());
+  }
+
+  /** Add a binary operation ({@code OP_ADD} to {@code OP_COPYSIGN}) and return its result slot. */
+  public int apply(int pOperation, int pFirst, int pSecond) {
+    checkArgument(
+        pOperation >= CFloatNativeAPI.OP_ADD && pOperation <= CFloatNativeAPI.OP_COPYSIGN,
+        "not a binary operation: %s",
+        pOperation);
+    checkElementIndex(pSecond, slots);
+    return addOperation(pOperation, pFirst, pSecond);
+  }
+
+  /** Add a unary operation ({@code OP_SQRT} to {@code OP_ABS}) and return its result slot. */
+  public int apply(int pOperation, int pOperand) {
+    checkArgument(
+        pOperation >= CFloatNativeAPI.OP_SQRT && pOperation <= CFloatNativeAPI.OP_ABS,
+        "not a unary operation: %s",
+        pOperation);
+    return addOperation(pOperation, pOperand, 0);
+  }
+
+  /** Add a cast to the floating point type {@code pToType} and return its result slot. */
+  public int castTo(int pOperand, int pToType) {
+    checkArgument(
+        pToType >= CFloatNativeAPI.FP_TYPE_SINGLE && pToType <= CFloatNativeAPI.FP_TYPE_LONG_DOUBLE,
+        "not a floating point type: %s",
+        pToType);
+    return addOperation(CFloatNativeAPI.OP_CAST, pOperand, pToType);
+  }
+
+  /** Evaluate all operations added since the last call with one native call. */
+  public void evaluate() {
+    if (evaluatedLength == programLength) {
+      return;
+    }
+    if (!CFloatNativeAPI.isBatchSupported()) {
+      evaluateScalar();
+      return;
+    }
+    // the native side expects arrays of exactly the used size
+    long[] exps = Arrays.copyOf(exponents, slots);
+    long[] mans = Arrays.copyOf(mantissas, slots);
+    int[] tps = Arrays.copyOf(types, slots);
+    CFloatNativeAPI.evaluateFp(
+        Arrays.copyOfRange(program, evaluatedLength, programLength), exps, mans, tps);
+    System.arraycopy(exps, 0, exponents, 0, slots);
+    System.arraycopy(mans, 0, mantissas, 0, slots);
+    System.arraycopy(tps, 0, types, 0, slots);
+    evaluatedLength = programLength;
+  }
+
+  private void evaluateScalar() {
+    for (int i = evaluatedLength; i < programLength; i += 4) {
+      CFloat operand = getSlot(program[i + 1]);
+      int argument = program[i + 2];
+      CFloat result =
+          switch (program[i]) {
+            case CFloatNativeAPI.OP_ADD -> operand.add(getSlot(argument));
+            case CFloatNativeAPI.OP_SUBTRACT -> operand.subtract(getSlot(argument));
+            case CFloatNativeAPI.OP_MULTIPLY -> operand.multiply(getSlot(argument));
+            case CFloatNativeAPI.OP_DIVIDE -> operand.divideBy(getSlot(argument));
+            case CFloatNativeAPI.OP_POW -> operand.powTo(getSlot(argument));
+            case CFloatNativeAPI.OP_COPYSIGN -> operand.copySignFrom(getSlot(argument));
+            case CFloatNativeAPI.OP_SQRT -> operand.sqrt();
+            case CFloatNativeAPI.OP_ROUND -> operand.round();
+            case CFloatNativeAPI.OP_TRUNC -> operand.trunc();
+            case CFloatNativeAPI.OP_CEIL -> operand.ceil();
+            case CFloatNativeAPI.OP_FLOOR -> operand.floor();
+            case CFloatNativeAPI.OP_ABS -> operand.abs();
+            case CFloatNativeAPI.OP_CAST -> operand.castTo(argument);
+            default -> throw new AssertionError("unknown operation " + program[i]);
+          };
+      CFloatWrapper wrapper = result.copyWrapper();
+      int target = program[i + 3];
+      exponents[target] = wrapper.getExponent();
+      mantissas[target] = wrapper.getMantissa();
+      types[target] = result.getType();
+    }
+    evaluatedLength = programLength;
+  }
+
+  /** Get the value of a slot, all operations have to be evaluated before. */
+  public CFloat get(int pSlot) {
+    checkState(evaluatedLength == programLength, "batch has to be evaluated first");
+    return getSlot(pSlot);
+  }
+
+  private CFloat getSlot(int pSlot) {
+    checkElementIndex(pSlot, slots);
+    return new CFloatNative(new CFloatWrapper(exponents[pSlot], mantissas[pSlot]), types[pSlot]);
+  }
+
+  /**
+   * Apply a binary operation element-wise to two vectors of equal length with a single native call.
+   */
+  public static CFloat[] map(int pOperation, CFloat[] pFirst, CFloat[] pSecond) {
+    checkArgument(pFirst.length == pSecond.length, "vectors must have the same length");
+    CFloatNativeBatch batch = new CFloatNativeBatch();
+    int[] results = new int[pFirst.length];
+    for (int i = 0; i < pFirst.length; i++) {
+      results[i] = batch.apply(pOperation, batch.add(pFirst[i]), batch.add(pSecond[i]));
+    }
+    batch.evaluate();
+    CFloat[] values = new CFloat[results.length];
+    for (int i = 0; i < results.length; i++) {
+      values[i] = batch.get(results[i]);
+    }
+    return values;
+  }
+
+  private int addOperation(int pOperation, int pOperand, int pArgument) {
+    checkElementIndex(pOperand, slots);
+    int target = newSlot(0, 0, UNKNOWN_TYPE);
+    if (programLength + 4 > program.length) {
+      program = Arrays.copyOf(program, 2 * program.length);
+    }
+    program[programLength++] = pOperation;
+    program[programLength++] = pOperand;
+    program[programLength++] = pArgument;
+    program[programLength++] = target;
+    return target;
+  }
+
+  private int newSlot(long pExponent, long pMantissa, int pType) {
+    if (slots == exponents.length) {
+      exponents = Arrays.copyOf(exponents, 2 * slots);
+      mantissas = Arrays.copyOf(mantissas, 2 * slots);
+      types = Arrays.copyOf(types, 2 * slots);
+    }
+    exponents[slots] = pExponent;
+    mantissas[slots] = pMantissa;
+    types[slots] = pType;
+    return slots++;
+  }
+}
@@ -9,7 +9,9 @@
 package org.sosy_lab.cpachecker.util.floatingpoint;
 
 import static com.google.common.truth.Truth.assertThat;
+import static com.google.common.truth.TruthJUnit.assume;
 
+import java.math.BigInteger;
 import org.junit.Ignore;
 import org.junit.Test;
 
@@ -170,6 +172,113 @@ public class CFloatTest {
     assertThat(zero.multiply(nZero).toString()).isEqualTo("-0.0");
   }
 
+  @Test
+  public void ieeeTest() {
+    for (int type : new int[] {CFloatNativeAPI.FP_TYPE_SINGLE, CFloatNativeAPI.FP_TYPE_DOUBLE}) {
+      CFloat a = CFloatIeee.parse("71236.262625", type);
+      CFloat b = CFloatIeee.parse("-2.5", type);
+      CFloat nA = new CFloatNative("71236.262625", type);
+      CFloat nB = new CFloatNative("-2.5", type);
+
+      assertThat(a.toString()).isEqualTo(nA.toString());
+      assertThat(a.add(b).toString()).isEqualTo(nA.add(nB).toString());
+      assertThat(a.multiply(b).toString()).isEqualTo(nA.multiply(nB).toString());
+      assertThat(a.divideBy(b).toString()).isEqualTo(nA.divideBy(nB).toString());
+      assertThat(a.sqrt().toString()).isEqualTo(nA.sqrt().toString());
+      assertThat(b.round().toString()).isEqualTo(nB.round().toString());
+      assertThat(b.trunc().toString()).isEqualTo(nB.trunc().toString());
+      assertThat(b.divideBy(CFloatIeee.parse("0", type)).toString())
+          .isEqualTo(nB.divideBy(new CFloatNative("0", type)).toString());
+      assertThat(a.castTo(CFloatNativeAPI.FP_TYPE_SINGLE).toString())
+          .isEqualTo(nA.castTo(CFloatNativeAPI.FP_TYPE_SINGLE).toString());
+      assertThat(a.copyWrapper().getExponent()).isEqualTo(nA.copyWrapper().getExponent());
+      assertThat(a.copyWrapper().getMantissa()).isEqualTo(nA.copyWrapper().getMantissa());
+    }
+
+    CFloat nZero = CFloatIeee.ofDouble(-0.0);
+    assertThat(nZero.toString()).isEqualTo("-0.0");
+    assertThat(nZero.isZero()).isTrue();
+    assertThat(CFloatIeee.parse("-inf", CFloatNativeAPI.FP_TYPE_SINGLE).toString())
+        .isEqualTo("-inf");
+  }
+
+  @Test
+  public void factoryTest() {
+    assertThat(CFloatFactory.create("0x1.8p1", CFloatNativeAPI.FP_TYPE_DOUBLE).toString())
+        .isEqualTo("3.0");
+    assertThat(CFloatFactory.create("0.1", CFloatNativeAPI.FP_TYPE_SINGLE).toString())
+        .isEqualTo(new CFloatNative("0.1", CFloatNativeAPI.FP_TYPE_SINGLE).toString());
+    assertThat(CFloatFactory.create("1.5", CFloatNativeAPI.FP_TYPE_LONG_DOUBLE))
+        .isInstanceOf(CFloatImpl.class);
+  }
+
+  @Test
+  public void ieeeCastToOtherTest() {
+    CFloat value = CFloatIeee.ofDouble(300.75);
+    assertThat(value.castToOther(CFloatNativeAPI.TYPE_INT)).isEqualTo(300);
+    assertThat(value.castToOther(CFloatNativeAPI.TYPE_UCHAR)).isEqualTo((short) 44);
+    assertThat(value.castToOther(CFloatNativeAPI.TYPE_UINT)).isEqualTo(300L);
+    assertThat(CFloatIeee.ofDouble(0x1.8p63).castToOther(CFloatNativeAPI.TYPE_ULONG))
+        .isEqualTo(BigInteger.ONE.shiftLeft(63).add(BigInteger.ONE.shiftLeft(62)));
+    assertThat(CFloatIeee.ofFloat(4e9f).castToOther(CFloatNativeAPI.TYPE_ULONG_LONG))
+        .isEqualTo(BigInteger.valueOf(4_000_000_000L));
+  }
+
+  @Test
+  public void ieeePowToIntegralTest() {
+    // repeated squaring would round after each multiplication and give 2.1970000000000005
+    assertThat(CFloatIeee.parse("1.3", CFloatNativeAPI.FP_TYPE_DOUBLE).powToIntegral(3).toString())
+        .isEqualTo(CFloatIeee.ofDouble(2.197).toString());
+    // and 2.8560993671417236 here
+    assertThat(CFloatIeee.parse("1.3", CFloatNativeAPI.FP_TYPE_SINGLE).powToIntegral(4).toString())
+        .isEqualTo(CFloatIeee.ofFloat(2.8560996055603027f).toString());
+
+    assertThat(CFloatIeee.ofDouble(-0.5).powToIntegral(1075).toString()).isEqualTo("-0.0");
+    assertThat(CFloatIeee.ofFloat(-1e-20f).powToIntegral(3).toString()).isEqualTo("-0.0");
+    assertThat(CFloatIeee.ofDouble(-2).powToIntegral(1025).toString()).isEqualTo("-inf");
+    assertThat(CFloatIeee.ofFloat(3).powToIntegral(0).toString()).isEqualTo("1.0");
+  }
+
+  @Test
+  public void batchTest() {
+    CFloat a = new CFloatNative("1.5", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    CFloat b = new CFloatNative("2.25", CFloatNativeAPI.FP_TYPE_SINGLE);
+
+    CFloatNativeBatch batch = new CFloatNativeBatch();
+    int sum = batch.apply(CFloatNativeAPI.OP_ADD, batch.add(a), batch.add(b));
+    int root = batch.apply(CFloatNativeAPI.OP_SQRT, sum);
+    int cast = batch.castTo(root, CFloatNativeAPI.FP_TYPE_LONG_DOUBLE);
+    batch.evaluate();
+
+    assertThat(batch.get(sum).toString()).isEqualTo(a.add(b).toString());
+    assertThat(batch.get(root).toString()).isEqualTo(a.add(b).sqrt().toString());
+    assertThat(batch.get(cast).getType()).isEqualTo(CFloatNativeAPI.FP_TYPE_LONG_DOUBLE);
+    assertThat(batch.get(cast).toString())
+        .isEqualTo(a.add(b).sqrt().castTo(CFloatNativeAPI.FP_TYPE_LONG_DOUBLE).toString());
+
+    CFloat[] products =
+        CFloatNativeBatch.map(
+            CFloatNativeAPI.OP_MULTIPLY, new CFloat[] {a, b}, new CFloat[] {b, b});
+    assertThat(products[0].toString()).isEqualTo(a.multiply(b).toString());
+    assertThat(products[1].toString()).isEqualTo(b.multiply(b).toString());
+  }
+
+  @Test
+  public void nativeBatchTest() {
+    // the prebuilt library may not provide the batched evaluation yet
+    assume().that(CFloatNativeAPI.isBatchSupported()).isTrue();
+    CFloat a = new CFloatNative("1.5", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    CFloat b = new CFloatNative("2.25", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    long[] exponents = {a.getExponent(), b.getExponent(), 0};
+    long[] mantissas = {a.getMantissa(), b.getMantissa(), 0};
+    int[] types = {CFloatNativeAPI.FP_TYPE_DOUBLE, CFloatNativeAPI.FP_TYPE_DOUBLE, -1};
+
+    CFloatNativeAPI.evaluateFp(
+        new int[] {CFloatNativeAPI.OP_MULTIPLY, 0, 1, 2}, exponents, mantissas, types);
+    CFloat product = new CFloatNative(new CFloatWrapper(exponents[2], mantissas[2]), types[2]);
+    assertThat(product.toString()).isEqualTo(a.multiply(b).toString());
+  }
+
   @Test
   public void additionTest() {
     CFloat ten = new CFloatImpl("10", CFloatNativeAPI.FP_TYPE_DOUBLE);
@@ -0,0 +1,138 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2022 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import com.google.common.base.Preconditions;
+import com.google.errorprone.annotations.CanIgnoreReturnValue;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Arrays;
+
+/**
+ * A sequence of octagon numbers on the Java heap. In contrast to {@link NumArray}, filling this
+ * buffer does not need a native call per number. {@link OctagonManager} passes the whole buffer to
+ * the octagon library with a single native call.
+ */
+public final class NumBuffer {
+
+  // encoding of entries in direct buffers, see org_sosy_lab_cpachecker_util_octagon_OctWrapper.c
+  static final int ENTRY_SIZE = 16;
+
+  private static final byte KIND_INT = 0;
+  private static final byte KIND_FLOAT = 1;
+  private static final byte KIND_INFINITY = 2;
+
+  private byte[] kinds;
+  private long[] values;
+  private int size = 0;
+
+  public NumBuffer(int pExpectedSize) {
+    kinds = new byte[pExpectedSize];
+    values = new long[pExpectedSize];
+  }
+
+  @CanIgnoreReturnValue
+  public NumBuffer putInt(long pValue) {
+    return put(KIND_INT, pValue);
+  }
+
+  @CanIgnoreReturnValue
+  public NumBuffer putFloat(double pValue) {
+    return put(KIND_FLOAT, Double.doubleToRawLongBits(pValue));
+  }
+
+  @CanIgnoreReturnValue
+  public NumBuffer putInfinity() {
+    return put(KIND_INFINITY, 0);
+  }
+
+  private NumBuffer put(byte pKind, long pValue) {
+    if (size == kinds.length) {
+      int capacity = Math.max(4, size * 2);
+      kinds = Arrays.copyOf(kinds, capacity);
+      values = Arrays.copyOf(values, capacity);
+    }
+    kinds[size] = pKind;
+    values[size] = pValue;
+    size++;
+    return this;
+  }
+
+  public int size() {
+    return size;
+  }
+
+  public boolean isInfinite(int pPos) {
+    return kind(pPos) == KIND_INFINITY;
+  }
+
+  public long getInt(int pPos) {
+    return switch (kind(pPos)) {
+      case KIND_INT -> values[pPos];
+      case KIND_FLOAT -> (long) Double.longBitsToDouble(values[pPos]);
+      default -> throw new IllegalStateException("infinite value at position " + pPos);
+    };
+  }
+
+  public double getFloat(int pPos) {
+    return switch (kind(pPos)) {
+      case KIND_INT -> values[pPos];
+      case KIND_FLOAT -> Double.longBitsToDouble(values[pPos]);
+      default -> Double.POSITIVE_INFINITY;
+    };
+  }
+
+  private byte kind(int pPos) {
+    Preconditions.checkElementIndex(pPos, size);
+    return kinds[pPos];
+  }
+
+  /** Write all entries into the given direct buffer, growing it if necessary. */
+  ByteBuffer writeTo(ByteBuffer pBuffer) {
+    ByteBuffer buffer = ensureCapacity(pBuffer, size);
+    for (int i = 0; i < size; i++) {
+      buffer.putInt(i * ENTRY_SIZE, kinds[i]);
+      buffer.putLong(i * ENTRY_SIZE + 8, values[i]);
+    }
+    return buffer;
+  }
+
+  /** Read {@code pSize} entries that the octagon library wrote into the given direct buffer. */
+  static NumBuffer readFrom(ByteBuffer pBuffer, int pSize) {
+    NumBuffer result = new NumBuffer(pSize);
+    for (int i = 0; i < pSize; i++) {
+      result.put((byte) pBuffer.getInt(i * ENTRY_SIZE), pBuffer.getLong(i * ENTRY_SIZE + 8));
+    }
+    return result;
+  }
+
+  static ByteBuffer ensureCapacity(ByteBuffer pBuffer, int pEntries) {
+    if (pBuffer.capacity() >= pEntries * ENTRY_SIZE) {
+      return pBuffer;
+    }
+    int capacity = Math.max(pEntries, pBuffer.capacity() / ENTRY_SIZE * 2);
+    return ByteBuffer.allocateDirect(capacity * ENTRY_SIZE).order(ByteOrder.nativeOrder());
+  }
+
+  /** Fallback for octagon libraries without batched operations. */
+  NumArray toNumArray(OctagonManager pManager, int pFrom, int pCount) {
+    Preconditions.checkPositionIndexes(pFrom, pFrom + pCount, size);
+    NumArray array = pManager.init_num_t(pCount);
+    for (int i = 0; i < pCount; i++) {
+      long value = values[pFrom + i];
+      switch (kinds[pFrom + i]) {
+        case KIND_INT -> pManager.num_set_int(array, i, value);
+        case KIND_FLOAT -> pManager.num_set_float(array, i, Double.longBitsToDouble(value));
+        case KIND_INFINITY -> pManager.num_set_inf(array, i);
+        default -> throw new AssertionError("unknown kind " + kinds[pFrom + i]);
+      }
+    }
+    return array;
+  }
+}
@@ -8,6 +8,8 @@
 
 package org.sosy_lab.cpachecker.util.octagon;
 
+import java.nio.ByteBuffer;
+
 @SuppressWarnings("AlmostJavadoc")
 class OctWrapper {
 
@@ -160,6 +162,37 @@ class OctWrapper {
   // oct_t*  oct_remove_dimensions( oct_t* m, var_t dimsup, bool destructive)
   static native long J_removeDimension(long oct, int k, boolean dest);
 
+  /* Batched operations */
+  // Numbers are passed in direct buffers (native byte order) with 16 bytes per number:
+  // int kind (0 = int, 1 = float, 2 = infinity), 4 bytes padding, long or double value.
+  // Libraries built before these functions existed do not provide them, so callers have to
+  // check J_batchSupported() and fall back to the functions above on UnsatisfiedLinkError.
+
+  static native boolean J_batchSupported();
+
+  // like J_assingVar, but the num array with size entries is created from buffer
+  static native long J_assingVarBuffer(
+      long oct, int k, ByteBuffer buffer, int size, boolean dest);
+
+  // like J_intervAssingVar, but the num array with size entries is created from buffer
+  static native long J_intervAssingVarBuffer(
+      long oct, int k, ByteBuffer buffer, int size, boolean dest);
+
+  // adds nb constraints, each given by four numbers (type, x, y, c) as for J_addBinConstraints
+  static native long J_addBinConstraintsBuffer(long oct, int nb, ByteBuffer buffer, boolean dest);
+
+  // writes upper and lower bound of the variables first, ..., first + count - 1 into buffer
+  static native void J_get_bounds_buffer(long oct, int first, int count, ByteBuffer buffer);
+
+  /* Closure */
+  // Available only in newer builds of the library, check for UnsatisfiedLinkError as above.
+
+  // returns the closure kernel selected for this CPU (0 = scalar, 1 = SSE2, 2 = AVX2)
+  static native int J_closureKernel();
+
+  // returns a new closed octagon equal to oct, computed with the vectorized closure kernels
+  static native long J_close(long oct);
+
   // TODO implement rest of the functions
 
   static native void J_print(long oct); // void oct_print (const oct_t* m)
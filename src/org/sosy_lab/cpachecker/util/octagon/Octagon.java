@@ -12,11 +12,16 @@ import java.lang.ref.Reference;
 import java.lang.ref.ReferenceQueue;
 import java.util.ArrayList;
 import java.util.List;
+import org.checkerframework.checker.nullness.qual.Nullable;
 
 public class Octagon {
 
   private final long octId;
   private final OctagonManager manager;
+
+  /** The closure of this octagon, computed lazily by {@link OctagonManager#close(Octagon)}. */
+  private @Nullable Octagon closed = null;
+
   private static List<OctagonPhantomReference> phantomReferences = new ArrayList<>();
   private static ReferenceQueue<Octagon> referenceQueue = new ReferenceQueue<>();
 
@@ -41,6 +46,14 @@ public class Octagon {
     return octId;
   }
 
+  @Nullable Octagon getClosed() {
+    return closed;
+  }
+
+  void setClosed(Octagon pClosed) {
+    closed = pClosed;
+  }
+
   public OctagonManager getManager() {
     return manager;
   }
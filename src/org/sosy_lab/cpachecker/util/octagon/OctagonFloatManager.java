@@ -8,8 +8,6 @@
 
 package org.sosy_lab.cpachecker.util.octagon;
 
-import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_get_bounds;
-import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_num_clear_n;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_num_get_float;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_num_infty;
 
@@ -20,7 +18,15 @@ import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 public class OctagonFloatManager extends OctagonManager {
 
   public OctagonFloatManager() {
-    super("JOct_float");
+    this(false);
+  }
+
+  /**
+   * @param pMemoizeClosure whether the closure of an octagon is also kept in its Java object,
+   *     which avoids a native call for every request
+   */
+  public OctagonFloatManager(boolean pMemoizeClosure) {
+    super("JOct_float", pMemoizeClosure);
   }
 
   @Override
@@ -34,53 +40,38 @@ public class OctagonFloatManager extends OctagonManager {
       return str.toString();
     }
 
-    NumArray lower = init_num_t(1);
-    NumArray upper = init_num_t(1);
-
+    NumBuffer bounds = getBounds(oct, 0, map.size());
     for (int i = 0; i < map.size(); i++) {
       str.append(" ").append(map.get(i)).append(" -> [");
-      J_get_bounds(oct.getOctId(), i, upper.getArray(), lower.getArray());
-      if (J_num_infty(lower.getArray(), 0)) {
+      if (bounds.isInfinite(2 * i + 1)) {
         str.append("-INFINITY, ");
       } else {
-        str.append(J_num_get_float(lower.getArray(), 0) * -1).append(", ");
+        str.append(bounds.getFloat(2 * i + 1) * -1).append(", ");
       }
-      if (J_num_infty(upper.getArray(), 0)) {
+      if (bounds.isInfinite(2 * i)) {
         str.append("INFINITY]\n");
       } else {
-        str.append(J_num_get_float(upper.getArray(), 0)).append("]\n");
+        str.append(bounds.getFloat(2 * i)).append("]\n");
       }
     }
-    J_num_clear_n(lower.getArray(), 1);
-    J_num_clear_n(upper.getArray(), 1);
     return str.toString();
   }
 
   @Override
   public OctagonInterval getVariableBounds(Octagon oct, int id) {
-    NumArray lower = init_num_t(1);
-    NumArray upper = init_num_t(1);
     assert id < dimension(oct);
-    J_get_bounds(oct.getOctId(), id, upper.getArray(), lower.getArray());
-    boolean lowerInfinite = J_num_infty(lower.getArray(), 0);
-    boolean upperInfinite = J_num_infty(upper.getArray(), 0);
+    NumBuffer bounds = getBounds(oct, id, 1);
+    double upper = bounds.isInfinite(0) ? Double.POSITIVE_INFINITY : bounds.getFloat(0);
+    double lower = bounds.isInfinite(1) ? Double.NEGATIVE_INFINITY : bounds.getFloat(1) * -1;
+    return new OctagonInterval(lower, upper);
+  }
 
-    OctagonInterval retVal;
-    if (lowerInfinite && upperInfinite) {
-      retVal = new OctagonInterval(Double.NEGATIVE_INFINITY, Double.POSITIVE_INFINITY);
-    } else if (lowerInfinite) {
-      retVal = new OctagonInterval(Double.NEGATIVE_INFINITY, J_num_get_float(upper.getArray(), 0));
-    } else if (upperInfinite) {
-      retVal =
-          new OctagonInterval(J_num_get_float(lower.getArray(), 0) * -1, Double.POSITIVE_INFINITY);
+  @Override
+  void putNum(NumBuffer pBuffer, NumArray pNum) {
+    if (J_num_infty(pNum.getArray(), 0)) {
+      pBuffer.putInfinity();
     } else {
-      retVal =
-          new OctagonInterval(
-              J_num_get_float(lower.getArray(), 0) * -1, J_num_get_float(upper.getArray(), 0));
+      pBuffer.putFloat(J_num_get_float(pNum.getArray(), 0));
     }
-
-    J_num_clear_n(lower.getArray(), 1);
-    J_num_clear_n(upper.getArray(), 1);
-    return retVal;
   }
 }
@@ -9,21 +9,29 @@
 package org.sosy_lab.cpachecker.util.octagon;
 
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_addBinConstraints;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_addBinConstraintsBuffer;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_addConstraint;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_addDimenensionAndEmbed;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_addDimenensionAndProject;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_assingVar;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_assingVarBuffer;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_batchSupported;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_close;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_closureKernel;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_copy;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_dimension;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_empty;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_forget;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_free;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_full_copy;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_get_bounds;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_get_bounds_buffer;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_init;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_init_n;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intersection;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervAddConstraint;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervAssingVar;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervAssingVarBuffer;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervSubstituteVar;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_isEmpty;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_isEmptyLazy;
@@ -53,6 +61,8 @@ import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_universe;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_widening;
 
 import com.google.common.collect.BiMap;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import org.sosy_lab.common.NativeLibraries;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
@@ -61,15 +71,62 @@ public abstract class OctagonManager {
 
   private static boolean libraryLoaded = false;
 
+  /** Whether the loaded library provides the batched operations (older builds do not). */
+  private static boolean batchSupported = false;
+
+  /**
+   * Whether the loaded library provides the vectorized closure. If so, it is used for all
+   * operations that would otherwise close their arguments internally.
+   */
+  private static boolean closureSupported = false;
+
+  /**
+   * Whether the closure of an octagon is kept in the {@link Octagon} object. The native library
+   * caches the closure of an octagon anyway, this only avoids a native call and a new wrapper
+   * object for every request.
+   */
+  private final boolean memoizeClosure;
+
+  /** Per-thread direct buffer for passing {@link NumBuffer}s to the native batched operations. */
+  private static final ThreadLocal<ByteBuffer> directBuffer =
+      ThreadLocal.withInitial(
+          () ->
+              ByteBuffer.allocateDirect(64 * NumBuffer.ENTRY_SIZE).order(ByteOrder.nativeOrder()));
+
   @SuppressWarnings("StaticAssignmentInConstructor")
-  protected OctagonManager(String libraryName) {
+  protected OctagonManager(String libraryName, boolean pMemoizeClosure) {
+    memoizeClosure = pMemoizeClosure;
     if (!libraryLoaded) {
       libraryLoaded = true;
       NativeLibraries.loadLibrary(libraryName);
       J_init();
+      batchSupported = isBatchSupported();
+      closureSupported = isClosureSupported();
     }
   }
 
+  private static boolean isClosureSupported() {
+    try {
+      return J_closureKernel() >= 0;
+    } catch (UnsatisfiedLinkError e) {
+      return false;
+    }
+  }
+
+  private static boolean isBatchSupported() {
+    try {
+      return J_batchSupported();
+    } catch (UnsatisfiedLinkError e) {
+      return false;
+    }
+  }
+
+  private static ByteBuffer toDirectBuffer(NumBuffer pNumbers) {
+    ByteBuffer buffer = pNumbers.writeTo(directBuffer.get());
+    directBuffer.set(buffer);
+    return buffer;
+  }
+
   /* num handling function*/
 
   /* allocate new space for num array and init*/
@@ -150,9 +207,31 @@ public abstract class OctagonManager {
     return J_nbconstraints(oct.getOctId());
   }
 
+  /**
+   * Get the strong closure of the octagon, which represents the same set of values. The closure
+   * is computed only once per octagon and cached by the library. If the library does not provide
+   * the vectorized closure, the octagon itself is returned and the library closes it internally
+   * where necessary.
+   */
+  public final Octagon close(Octagon oct) {
+    if (!closureSupported) {
+      return oct;
+    }
+    Octagon closed = oct.getClosed();
+    if (closed == null) {
+      closed = new Octagon(J_close(oct.getOctId()), this);
+      // a closed octagon is its own closure, this costs no additional memory
+      closed.setClosed(closed);
+      if (memoizeClosure) {
+        oct.setClosed(closed);
+      }
+    }
+    return closed;
+  }
+
   /* Test Functions */
   public final boolean isEmpty(Octagon oct) {
-    return J_isEmpty(oct.getOctId());
+    return J_isEmpty(close(oct).getOctId());
   }
 
   public final int isEmptyLazy(Octagon oct) {
@@ -164,7 +243,7 @@ public abstract class OctagonManager {
   }
 
   public final boolean isIncludedIn(Octagon oct1, Octagon oct2) {
-    return J_isIncludedIn(oct1.getOctId(), oct2.getOctId());
+    return J_isIncludedIn(close(oct1).getOctId(), oct2.getOctId());
   }
 
   public final int isIncludedInLazy(Octagon oct1, Octagon oct2) {
@@ -172,7 +251,7 @@ public abstract class OctagonManager {
   }
 
   public final boolean isEqual(Octagon oct1, Octagon oct2) {
-    return J_isEqual(oct1.getOctId(), oct2.getOctId());
+    return J_isEqual(close(oct1).getOctId(), close(oct2).getOctId());
   }
 
   public final int isEqualLazy(Octagon oct1, Octagon oct2) {
@@ -189,10 +268,11 @@ public abstract class OctagonManager {
   }
 
   public final Octagon union(Octagon oct1, Octagon oct2) {
-    return new Octagon(J_union(oct1.getOctId(), oct2.getOctId(), false), this);
+    return new Octagon(J_union(close(oct1).getOctId(), close(oct2).getOctId(), false), this);
   }
 
-  /* int widening = 0 -> OCT_WIDENING_FAST
+  /* The widening must not use closed arguments, otherwise it might not terminate.
+   * int widening = 0 -> OCT_WIDENING_FAST
    * int widening = 1 ->  OCT_WIDENING_ZERO
    * int widening = 2 -> OCT_WIDENING_UNIT*/
   public final Octagon widening(Octagon oct1, Octagon oct2) {
@@ -217,6 +297,46 @@ public abstract class OctagonManager {
         J_addBinConstraints(oct.getOctId(), noOfConstraints, array.getArray(), false), this);
   }
 
+  /**
+   * Assign the linear combination given by {@code values} to variable {@code k}. The values are
+   * passed to the octagon library with a single native call.
+   */
+  public final Octagon assignVar(Octagon oct, int k, NumBuffer values) {
+    if (batchSupported) {
+      return new Octagon(
+          J_assingVarBuffer(oct.getOctId(), k, toDirectBuffer(values), values.size(), false),
+          this);
+    }
+    NumArray array = values.toNumArray(this, 0, values.size());
+    try {
+      return assingVar(oct, k, array);
+    } finally {
+      num_clear_n(array, values.size());
+    }
+  }
+
+  /**
+   * Add constraints to the octagon with a single native call. Every constraint consists of four
+   * entries in {@code constraints}: type, first variable, second variable, and constant (see
+   * {@link OctWrapper#J_addBinConstraints}).
+   */
+  public final Octagon addBinConstraints(Octagon oct, NumBuffer constraints) {
+    assert constraints.size() % 4 == 0 : "incomplete constraint in buffer";
+    int count = constraints.size() / 4;
+    if (batchSupported) {
+      return new Octagon(
+          J_addBinConstraintsBuffer(oct.getOctId(), count, toDirectBuffer(constraints), false),
+          this);
+    }
+    Octagon result = oct;
+    for (int i = 0; i < count; i++) {
+      NumArray array = constraints.toNumArray(this, i * 4, 4);
+      result = addBinConstraint(result, 1, array);
+      num_clear_n(array, 4);
+    }
+    return result;
+  }
+
   public final Octagon substituteVar(Octagon oct, int x, NumArray array) {
     return new Octagon(J_substituteVar(oct.getOctId(), x, array.getArray(), false), this);
   }
@@ -229,6 +349,21 @@ public abstract class OctagonManager {
     return new Octagon(J_intervAssingVar(oct.getOctId(), k, array.getArray(), false), this);
   }
 
+  /** Like {@link #assignVar(Octagon, int, NumBuffer)} with upper and lower bound per variable. */
+  public final Octagon intervAssignVar(Octagon oct, int k, NumBuffer values) {
+    if (batchSupported) {
+      return new Octagon(
+          J_intervAssingVarBuffer(oct.getOctId(), k, toDirectBuffer(values), values.size(), false),
+          this);
+    }
+    NumArray array = values.toNumArray(this, 0, values.size());
+    try {
+      return intervAssingVar(oct, k, array);
+    } finally {
+      num_clear_n(array, values.size());
+    }
+  }
+
   public final Octagon intervSubstituteVar(Octagon oct, int x, NumArray array) {
     return new Octagon(J_intervSubstituteVar(oct.getOctId(), x, array.getArray(), false), this);
   }
@@ -250,6 +385,34 @@ public abstract class OctagonManager {
     return new Octagon(J_removeDimension(oct.getOctId(), k, false), this);
   }
 
+  /**
+   * Get the bounds of {@code count} variables starting at index {@code first}. The result contains
+   * the upper bound and the negated lower bound for each variable, in this order.
+   */
+  protected final NumBuffer getBounds(Octagon oct, int first, int count) {
+    if (batchSupported) {
+      ByteBuffer buffer = NumBuffer.ensureCapacity(directBuffer.get(), 2 * count);
+      directBuffer.set(buffer);
+      J_get_bounds_buffer(close(oct).getOctId(), first, count, buffer);
+      return NumBuffer.readFrom(buffer, 2 * count);
+    }
+    long closed = close(oct).getOctId();
+    NumBuffer result = new NumBuffer(2 * count);
+    NumArray upper = init_num_t(1);
+    NumArray lower = init_num_t(1);
+    for (int i = first; i < first + count; i++) {
+      J_get_bounds(closed, i, upper.getArray(), lower.getArray());
+      putNum(result, upper);
+      putNum(result, lower);
+    }
+    num_clear_n(upper, 1);
+    num_clear_n(lower, 1);
+    return result;
+  }
+
+  /** Append the number to the buffer, the representation depends on the library. */
+  abstract void putNum(NumBuffer buffer, NumArray num);
+
   public final void printNum(NumArray arr, int size) {
     J_printNum(arr.getArray(), size);
   }
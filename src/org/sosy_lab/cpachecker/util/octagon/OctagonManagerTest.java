@@ -9,9 +9,11 @@
 package org.sosy_lab.cpachecker.util.octagon;
 
 import static com.google.common.truth.Truth.assertThat;
+import static com.google.common.truth.TruthJUnit.assume;
 
 import org.junit.BeforeClass;
 import org.junit.Test;
+import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 
 public class OctagonManagerTest {
 
@@ -39,4 +41,68 @@ public class OctagonManagerTest {
     assertThat(manager.num_get_int(num, 0)).isEqualTo(3);
     assertThat(manager.num_get_float(num, 0)).isWithin(0).of(3.3);
   }
+
+  @Test
+  public void testAssignVar() {
+    // x1 := 0; x0 := x1 + 5
+    Octagon oct = manager.universe(2);
+    oct = manager.assignVar(oct, 1, new NumBuffer(3).putInt(0).putInt(0).putInt(0));
+    oct = manager.assignVar(oct, 0, new NumBuffer(3).putInt(0).putInt(1).putFloat(5));
+    OctagonInterval bounds = manager.getVariableBounds(oct, 0);
+    assertThat(bounds.getLow().getValue().doubleValue()).isWithin(0).of(5);
+    assertThat(bounds.getHigh().getValue().doubleValue()).isWithin(0).of(5);
+  }
+
+  @Test
+  public void testAddBinConstraints() {
+    // x0 <= 3 and -x1 <= 1, added with a single call
+    NumBuffer constraints =
+        new NumBuffer(8)
+            .putInt(0)
+            .putInt(0)
+            .putInt(-1)
+            .putFloat(3)
+            .putInt(1)
+            .putInt(1)
+            .putInt(-1)
+            .putFloat(1);
+    Octagon oct = manager.addBinConstraints(manager.universe(2), constraints);
+
+    NumBuffer bounds = manager.getBounds(oct, 0, 2);
+    assertThat(bounds.getFloat(0)).isWithin(0).of(3);
+    assertThat(bounds.isInfinite(1)).isTrue();
+    assertThat(bounds.isInfinite(2)).isTrue();
+    assertThat(bounds.getFloat(3)).isWithin(0).of(1);
+  }
+
+  @Test
+  public void testClose() {
+    // x0 - x1 <= 2 and x1 <= 3 imply x0 <= 5
+    NumBuffer constraints =
+        new NumBuffer(8)
+            .putInt(3)
+            .putInt(0)
+            .putInt(1)
+            .putFloat(2)
+            .putInt(0)
+            .putInt(1)
+            .putInt(-1)
+            .putFloat(3);
+    Octagon oct = manager.addBinConstraints(manager.universe(2), constraints);
+    Octagon closed = manager.close(oct);
+
+    assertThat(manager.isEqual(oct, closed)).isTrue();
+    assertThat(manager.close(closed)).isSameInstanceAs(closed);
+    assertThat(manager.getBounds(closed, 0, 1).getFloat(0)).isWithin(0).of(5);
+
+    // libraries without the vectorized closure return the octagon itself
+    assume().that(closed).isNotSameInstanceAs(oct);
+    // without memoization, the closure is not kept in the octagon, but cached by the library
+    Octagon closedAgain = manager.close(oct);
+    assertThat(closedAgain).isNotSameInstanceAs(closed);
+    assertThat(closedAgain.getOctId()).isEqualTo(closed.getOctId());
+    OctagonManager memoizing = new OctagonFloatManager(true);
+    Octagon oct2 = memoizing.addBinConstraints(memoizing.universe(2), constraints);
+    assertThat(memoizing.close(oct2)).isSameInstanceAs(memoizing.close(oct2));
+  }
 }
@@ -0,0 +1,512 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
+import static org.sosy_lab.cpachecker.util.statistics.StatisticsWriter.writingStatisticsTo;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.collect.EnumMultiset;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.Multiset;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import com.google.errorprone.annotations.concurrent.GuardedBy;
+import java.io.IOException;
+import java.io.PrintStream;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentMap;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+
+/**
+ * Persistent storage for results of solver queries, such that a later run of CPAchecker on the same
+ * (or a slightly changed) program can reuse them instead of asking the solver again. Optionally,
+ * the results are also shared between all analyses in the same JVM, e.g., between the threads of a
+ * parallel portfolio or of parallel BAM.
+ *
+ * <p>The store is content-addressed: the key of a query is a SHA-256 hash of the kind of the query,
+ * of the name of the solver, and of the SMT-LIB serialization of all formulas of the query. Thus a
+ * result is reused exactly if the same query is posed again, regardless of where in the program it
+ * comes from. Sets of formulas are serialized in a canonical order. Because all formulas are
+ * exchanged as SMT-LIB strings and parsed by the receiving side, analyses with different solver
+ * contexts (but the same solver) can share their results without further translation.
+ *
+ * <p>Each analysis has its own instance of this class, because the serialization depends on the
+ * formula manager. The shared results are stored in a bounded concurrent map that is accessed
+ * without global locking, so lookups of different threads do not block each other. The map exists
+ * as long as at least one instance that uses it is open.
+ *
+ * <p>The file is a sequence of records (marker, key, length of value, value as UTF-8), all integers
+ * big-endian. It is read completely at startup, and new results are appended immediately. All
+ * instances in the same JVM append to the same file through one channel, one record at a time,
+ * such that records are never interleaved. A truncated record at the end of the file is ignored.
+ */
+@Options(prefix = "solver.persistentCache")
+public final class PersistentQueryCache implements AutoCloseable {
+
+  private static final int RECORD_MARKER = 0x53514331; // "SQC1"
+  private static final int HASH_BYTES = 32; // SHA-256
+  private static final int RECORD_HEADER_BYTES = Integer.BYTES + HASH_BYTES + Integer.BYTES;
+  private static final int DUMP_CACHE_SIZE = 16;
+
+  @Option(
+      secure = true,
+      name = "file",
+      description =
+          "File for storing results of solver queries across several runs of CPAchecker. If the"
+              + " file exists, it is read at startup, and queries that are not in the in-memory"
+              + " caches of the solver and of the predicate abstraction are looked up in it. New"
+              + " results are appended to the file. Leave empty to disable the persistent cache.")
+  @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
+  private @Nullable Path file = null;
+
+  @Option(
+      secure = true,
+      name = "shared",
+      description =
+          "Share the results of solver queries between all analyses that run in the same JVM,"
+              + " e.g., in parallel portfolios or with parallel BAM. Formulas are exchanged as"
+              + " SMT-LIB strings, such that each analysis can keep its own solver context. Can"
+              + " be combined with a persistent file.")
+  private boolean shared = false;
+
+  @Option(
+      secure = true,
+      name = "sharedSize",
+      description =
+          "Maximal number of results that are shared in the JVM with"
+              + " solver.persistentCache.shared, the least recently used results are evicted"
+              + " first. The analysis that creates the shared store determines its size.")
+  @IntegerOption(min = 1)
+  private int sharedSize = 100_000;
+
+  /** Guards {@link #sharedStore} and {@link #OPEN_FILES}, as well as the users of both. */
+  private static final Object SHARED_LOCK = new Object();
+
+  /** Results shared by all open instances with {@link #shared} enabled. */
+  @GuardedBy("SHARED_LOCK")
+  private static @Nullable SharedStore sharedStore = null;
+
+  /** Persistent files used by open instances, such that each file is written by one channel. */
+  @GuardedBy("SHARED_LOCK")
+  private static final Map<Path, CacheFile> OPEN_FILES = new HashMap<>();
+
+  private static final class SharedStore {
+    private final ConcurrentMap<HashCode, String> entries;
+
+    /** Number of entries that were loaded from each persistent file into this store. */
+    @GuardedBy("this")
+    private final Map<Path, Integer> loadedFiles = new HashMap<>();
+
+    @GuardedBy("SHARED_LOCK")
+    private int users = 0;
+
+    private SharedStore(int pSize) {
+      entries = CacheBuilder.newBuilder().maximumSize(pSize).<HashCode, String>build().asMap();
+    }
+  }
+
+  private static final class CacheFile {
+    private final Path path;
+
+    @GuardedBy("this")
+    private @Nullable FileChannel output = null;
+
+    @GuardedBy("SHARED_LOCK")
+    private int users = 0;
+
+    private CacheFile(Path pPath) {
+      path = pPath;
+    }
+
+    /** Append a record, the lock prevents interleaving with records of other instances. */
+    synchronized void append(ByteBuffer pRecord) throws IOException {
+      if (output == null) {
+        output =
+            FileChannel.open(
+                path,
+                StandardOpenOption.CREATE,
+                StandardOpenOption.WRITE,
+                StandardOpenOption.APPEND);
+      }
+      while (pRecord.hasRemaining()) {
+        output.write(pRecord);
+      }
+    }
+
+    synchronized void close() throws IOException {
+      if (output != null) {
+        output.close();
+        output = null;
+      }
+    }
+  }
+
+  /** The different kinds of queries, which are kept apart in the key and in the statistics. */
+  public enum QueryKind {
+    UNSAT("Satisfiability checks"),
+    ABSTRACTION("Predicate abstractions"),
+    PREDICATE_VALUE("Cartesian predicate values"),
+    ;
+
+    private final String description;
+
+    QueryKind(String pDescription) {
+      description = pDescription;
+    }
+  }
+
+  private final LogManager logger;
+  private final FormulaManagerView fmgr;
+  private final String namespace;
+
+  private final Map<HashCode, String> entries;
+  private final @Nullable SharedStore store;
+  private final @Nullable CacheFile cacheFile;
+  private boolean closed = false;
+
+  // recently serialized formulas, because the same formula is often part of several queries
+  private final Map<BooleanFormula, String> recentDumps =
+      new LinkedHashMap<>(DUMP_CACHE_SIZE, 0.75f, true) {
+        private static final long serialVersionUID = 1L;
+
+        @Override
+        protected boolean removeEldestEntry(Map.Entry<BooleanFormula, String> pEldest) {
+          return size() > DUMP_CACHE_SIZE;
+        }
+      };
+
+  // stats
+  private final Timer loadTimer = new Timer();
+  private final Timer lookupTimer = new Timer();
+  private final Timer storeTimer = new Timer();
+  private int loadedEntries = 0;
+  private final Multiset<QueryKind> lookups = EnumMultiset.create(QueryKind.class);
+  private final Multiset<QueryKind> hits = EnumMultiset.create(QueryKind.class);
+  private final Multiset<QueryKind> stores = EnumMultiset.create(QueryKind.class);
+
+  PersistentQueryCache(
+      Configuration pConfig, LogManager pLogger, FormulaManagerView pFmgr, String pSolverName)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    fmgr = pFmgr;
+    namespace = pSolverName;
+
+    synchronized (SHARED_LOCK) {
+      if (shared) {
+        if (sharedStore == null) {
+          sharedStore = new SharedStore(sharedSize);
+        }
+        sharedStore.users++;
+        store = sharedStore;
+      } else {
+        store = null;
+      }
+      if (file != null) {
+        cacheFile = OPEN_FILES.computeIfAbsent(normalize(file), CacheFile::new);
+        cacheFile.users++;
+      } else {
+        cacheFile = null;
+      }
+    }
+    entries = store != null ? store.entries : new HashMap<>();
+
+    if (file != null && Files.isRegularFile(file)) {
+      loadTimer.start();
+      try {
+        if (store == null) {
+          Map<HashCode, String> loaded = load(file);
+          entries.putAll(loaded);
+          loadedEntries = loaded.size();
+        } else {
+          loadedEntries = loadIntoSharedStore(store, file);
+        }
+        logger.log(Level.FINE, "Loaded persistent solver cache with", loadedEntries, "entries");
+      } catch (IOException e) {
+        // a broken cache must never break the analysis
+        logger.logUserException(
+            Level.WARNING, e, "Could not read persistent solver cache, ignoring it");
+      } finally {
+        loadTimer.stop();
+      }
+    }
+  }
+
+  @VisibleForTesting
+  int getLoadedEntries() {
+    return loadedEntries;
+  }
+
+  boolean isEnabled() {
+    return file != null || shared;
+  }
+
+  private static Path normalize(Path pFile) {
+    return pFile.toAbsolutePath().normalize();
+  }
+
+  /**
+   * Load a file into the shared store unless another instance already did, and return the number
+   * of entries loaded from it.
+   */
+  private int loadIntoSharedStore(SharedStore pStore, Path pFile) throws IOException {
+    synchronized (pStore) {
+      Integer count = pStore.loadedFiles.get(normalize(pFile));
+      if (count == null) {
+        Map<HashCode, String> loaded = load(pFile);
+        pStore.entries.putAll(loaded);
+        count = loaded.size();
+        pStore.loadedFiles.put(normalize(pFile), count);
+      }
+      return count;
+    }
+  }
+
+  /** Read all complete records of the file. */
+  private Map<HashCode, String> load(Path pFile) throws IOException {
+    Map<HashCode, String> loaded = new HashMap<>();
+    ByteBuffer buffer = ByteBuffer.wrap(Files.readAllBytes(pFile));
+    while (buffer.remaining() >= RECORD_HEADER_BYTES) {
+      if (buffer.getInt() != RECORD_MARKER) {
+        logger.log(Level.WARNING, "Persistent solver cache", pFile, "is corrupt, ignoring rest");
+        break;
+      }
+      byte[] key = new byte[HASH_BYTES];
+      buffer.get(key);
+      int length = buffer.getInt();
+      if (length < 0 || length > buffer.remaining()) {
+        break; // truncated by an aborted run
+      }
+      byte[] value = new byte[length];
+      buffer.get(value);
+      loaded.put(HashCode.fromBytes(key), new String(value, UTF_8));
+    }
+    return loaded;
+  }
+
+  private String dump(BooleanFormula pFormula) {
+    return recentDumps.computeIfAbsent(pFormula, f -> fmgr.dumpFormula(f).toString());
+  }
+
+  /**
+   * Compute the key of a query, which consists of some formulas whose order is relevant and some
+   * formulas whose order is irrelevant.
+   */
+  private HashCode computeKey(
+      QueryKind pKind, List<BooleanFormula> pOrdered, Collection<BooleanFormula> pUnordered) {
+    Hasher hasher =
+        Hashing.sha256().newHasher().putString(namespace, UTF_8).putString(pKind.name(), UTF_8);
+    List<String> dumps = new ArrayList<>(pOrdered.size() + pUnordered.size());
+    pOrdered.forEach(f -> dumps.add(dump(f)));
+    // use a canonical order for the rest
+    pUnordered.stream().map(this::dump).sorted().forEachOrdered(dumps::add);
+    hasher.putInt(pOrdered.size()).putInt(pUnordered.size());
+    for (String dump : dumps) {
+      // the length prevents ambiguities between different splits of the same characters
+      hasher.putInt(dump.length()).putString(dump, UTF_8);
+    }
+    return hasher.hash();
+  }
+
+  private synchronized @Nullable String get(
+      QueryKind pKind, List<BooleanFormula> pOrdered, Collection<BooleanFormula> pUnordered) {
+    if (entries.isEmpty()) {
+      return null;
+    }
+    lookupTimer.start();
+    try {
+      lookups.add(pKind);
+      String value = entries.get(computeKey(pKind, pOrdered, pUnordered));
+      if (value != null) {
+        hits.add(pKind);
+      }
+      return value;
+    } finally {
+      lookupTimer.stop();
+    }
+  }
+
+  private synchronized void put(
+      QueryKind pKind,
+      List<BooleanFormula> pOrdered,
+      Collection<BooleanFormula> pUnordered,
+      String pValue) {
+    storeTimer.start();
+    try {
+      HashCode key = computeKey(pKind, pOrdered, pUnordered);
+      if (pValue.equals(entries.put(key, pValue))) {
+        return; // already known, maybe from another analysis
+      }
+      stores.add(pKind);
+      if (file == null || cacheFile == null) {
+        return;
+      }
+      byte[] value = pValue.getBytes(UTF_8);
+      ByteBuffer record = ByteBuffer.allocate(RECORD_HEADER_BYTES + value.length);
+      record.putInt(RECORD_MARKER).put(key.asBytes()).putInt(value.length).put(value).flip();
+      cacheFile.append(record);
+    } catch (IOException e) {
+      logger.logUserException(
+          Level.WARNING, e, "Could not write persistent solver cache, disabling it");
+      file = null;
+    } finally {
+      storeTimer.stop();
+    }
+  }
+
+  /**
+   * Look up whether the conjunction of the given formulas was found to be unsatisfiable in a
+   * previous run or by another analysis. Returns null if this is unknown.
+   */
+  public @Nullable Boolean isUnsat(Collection<BooleanFormula> pConjuncts) {
+    String value = get(QueryKind.UNSAT, ImmutableList.of(), pConjuncts);
+    return value == null ? null : Boolean.valueOf(value);
+  }
+
+  /** Store whether the conjunction of the given formulas is unsatisfiable. */
+  public void storeUnsat(Collection<BooleanFormula> pConjuncts, boolean pIsUnsat) {
+    if (isEnabled()) {
+      put(QueryKind.UNSAT, ImmutableList.of(), pConjuncts, Boolean.toString(pIsUnsat));
+    }
+  }
+
+  /**
+   * Look up the abstraction of a formula with the given (instantiated) predicates from a previous
+   * run, and return it as uninstantiated formula. The abstraction type is part of the key. Returns
+   * null if the abstraction is not known or cannot be parsed.
+   */
+  public @Nullable BooleanFormula getAbstraction(
+      BooleanFormula pFormula, Collection<BooleanFormula> pPredicates, String pAbstractionType) {
+    String value = get(QueryKind.ABSTRACTION, ImmutableList.of(pFormula), pPredicates);
+    if (value == null || !value.startsWith(pAbstractionType + "\n")) {
+      return null;
+    }
+    try {
+      return fmgr.parse(value.substring(pAbstractionType.length() + 1));
+    } catch (IllegalArgumentException e) {
+      logger.logDebugException(e, "Could not parse abstraction from persistent solver cache");
+      return null;
+    }
+  }
+
+  /** Store the uninstantiated abstraction of a formula with the given predicates. */
+  public void storeAbstraction(
+      BooleanFormula pFormula,
+      Collection<BooleanFormula> pPredicates,
+      String pAbstractionType,
+      BooleanFormula pAbstraction) {
+    if (isEnabled()) {
+      put(
+          QueryKind.ABSTRACTION,
+          ImmutableList.of(pFormula),
+          pPredicates,
+          pAbstractionType + "\n" + fmgr.dumpFormula(pAbstraction));
+    }
+  }
+
+  /**
+   * Look up the value of an (instantiated) predicate in the Cartesian abstraction of a formula from
+   * a previous run: -1 if the predicate is false, 1 if it is true, 0 if it is neither. Returns null
+   * if the value is unknown.
+   */
+  public @Nullable Byte getPredicateValue(BooleanFormula pFormula, BooleanFormula pPredicate) {
+    String value =
+        get(QueryKind.PREDICATE_VALUE, ImmutableList.of(pFormula, pPredicate), ImmutableList.of());
+    return value == null ? null : Byte.valueOf(value);
+  }
+
+  /** Store the value of a predicate in the Cartesian abstraction of a formula. */
+  public void storePredicateValue(BooleanFormula pFormula, BooleanFormula pPredicate, byte pValue) {
+    if (isEnabled()) {
+      put(
+          QueryKind.PREDICATE_VALUE,
+          ImmutableList.of(pFormula, pPredicate),
+          ImmutableList.of(),
+          Byte.toString(pValue));
+    }
+  }
+
+  /**
+   * Release the shared store and the persistent file. The last instance that uses them drops the
+   * shared results and closes the file.
+   */
+  @Override
+  public synchronized void close() {
+    if (closed) {
+      return;
+    }
+    closed = true;
+    synchronized (SHARED_LOCK) {
+      if (store != null && --store.users == 0 && sharedStore == store) {
+        sharedStore = null;
+      }
+      if (cacheFile != null && --cacheFile.users == 0) {
+        OPEN_FILES.remove(cacheFile.path);
+        try {
+          cacheFile.close();
+        } catch (IOException e) {
+          logger.logUserException(Level.WARNING, e, "Could not close persistent solver cache");
+        }
+      }
+    }
+  }
+
+  void printStatistics(PrintStream pOut) {
+    StatisticsWriter writer =
+        writingStatisticsTo(pOut)
+            .put("Persistent solver cache", file == null ? "shared in JVM" : file)
+            .beginLevel()
+            .put("Number of entries from previous runs", loadedEntries)
+            .put(
+                "Number of persistent cache hits",
+                hits.size() + " (" + toPercent(hits.size(), lookups.size()) + " of all lookups)")
+            .beginLevel();
+    for (QueryKind kind : QueryKind.values()) {
+      writer.put(
+          kind.description,
+          hits.count(kind)
+              + " of "
+              + lookups.count(kind)
+              + " ("
+              + toPercent(hits.count(kind), lookups.count(kind))
+              + ")");
+    }
+    writer
+        .endLevel()
+        .put("Number of stored entries", stores.size())
+        .put("Time for loading", loadTimer)
+        .put("Time for lookups", lookupTimer)
+        .put("Time for storing", storeTimer);
+  }
+}
@@ -0,0 +1,177 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import java.io.IOException;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.NumeralFormula.IntegerFormula;
+import org.sosy_lab.java_smt.api.SolverException;
+
+public class PersistentQueryCacheTest extends SolverViewBasedTest0 {
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private Path file;
+  private Configuration cacheConfig;
+
+  private BooleanFormula xGreater0;
+  private BooleanFormula xLess0;
+  private BooleanFormula yGreater0;
+
+  @Before
+  public void setUp() throws IOException, InvalidConfigurationException {
+    file = tempFolder.getRoot().toPath().resolve("queries.cache");
+    cacheConfig =
+        TestDataTools.configurationForTest()
+            .setOption("solver.persistentCache.file", file.toString())
+            .build();
+
+    IntegerFormula x = imgrv.makeVariable("x");
+    IntegerFormula y = imgrv.makeVariable("y");
+    IntegerFormula zero = imgrv.makeNumber(0);
+    xGreater0 = imgrv.greaterThan(x, zero);
+    xLess0 = imgrv.lessThan(x, zero);
+    yGreater0 = imgrv.greaterThan(y, zero);
+  }
+
+  private PersistentQueryCache createCache() throws InvalidConfigurationException {
+    return new PersistentQueryCache(cacheConfig, logger, mgrv, solverToUse().name());
+  }
+
+  @Test
+  public void testResultsOfPreviousRun()
+      throws InvalidConfigurationException, SolverException, InterruptedException {
+    try (PersistentQueryCache cache = createCache()) {
+      assertThat(cache.isEnabled()).isTrue();
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0, xLess0))).isNull();
+      cache.storeUnsat(ImmutableList.of(xGreater0, xLess0), true);
+      cache.storeUnsat(ImmutableList.of(xGreater0), false);
+      cache.storePredicateValue(xGreater0, yGreater0, (byte) 0);
+      cache.storeAbstraction(xGreater0, ImmutableList.of(xGreater0), "BOOLEAN", xGreater0);
+    }
+
+    try (PersistentQueryCache cache = createCache()) {
+      // the order of conjuncts is irrelevant
+      assertThat(cache.isUnsat(ImmutableList.of(xLess0, xGreater0))).isTrue();
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0))).isFalse();
+      assertThat(cache.isUnsat(ImmutableList.of(xLess0))).isNull();
+      assertThat(cache.getPredicateValue(xGreater0, yGreater0)).isEqualTo((byte) 0);
+      assertThat(cache.getPredicateValue(yGreater0, xGreater0)).isNull();
+      BooleanFormula abstraction =
+          cache.getAbstraction(xGreater0, ImmutableList.of(xGreater0), "BOOLEAN");
+      assertThat(abstraction).isNotNull();
+      assertThat(solver.isUnsat(bmgrv.xor(abstraction, xGreater0))).isTrue();
+      assertThat(cache.getAbstraction(xGreater0, ImmutableList.of(xGreater0), "CARTESIAN"))
+          .isNull();
+    }
+  }
+
+  @Test
+  public void testTruncatedFile() throws IOException, InvalidConfigurationException {
+    try (PersistentQueryCache cache = createCache()) {
+      cache.storeUnsat(ImmutableList.of(xGreater0, xLess0), true);
+      cache.storeUnsat(ImmutableList.of(xGreater0), false);
+    }
+    try (FileChannel channel = FileChannel.open(file, StandardOpenOption.WRITE)) {
+      channel.truncate(Files.size(file) - 1);
+    }
+
+    try (PersistentQueryCache cache = createCache()) {
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0, xLess0))).isTrue();
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0))).isNull();
+    }
+  }
+
+  @Test
+  public void testSharedBetweenAnalyses() throws InvalidConfigurationException {
+    Configuration sharedConfig =
+        TestDataTools.configurationForTest()
+            .setOption("solver.persistentCache.shared", "true")
+            .build();
+    try (PersistentQueryCache cache1 =
+            new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name());
+        PersistentQueryCache cache2 =
+            new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name())) {
+      assertThat(cache1.isEnabled()).isTrue();
+      cache1.storePredicateValue(xLess0, yGreater0, (byte) -1);
+      assertThat(cache2.getPredicateValue(xLess0, yGreater0)).isEqualTo((byte) -1);
+    }
+    assertThat(Files.exists(file)).isFalse();
+  }
+
+  @Test
+  public void testSharedStoreIsDroppedWithLastInstance() throws InvalidConfigurationException {
+    Configuration sharedConfig =
+        TestDataTools.configurationForTest()
+            .setOption("solver.persistentCache.shared", "true")
+            .build();
+    try (PersistentQueryCache cache =
+        new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name())) {
+      cache.storeUnsat(ImmutableList.of(xGreater0, xLess0), true);
+    }
+    try (PersistentQueryCache cache =
+        new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name())) {
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0, xLess0))).isNull();
+    }
+  }
+
+  @Test
+  public void testSharedStoreWithFile() throws InvalidConfigurationException {
+    try (PersistentQueryCache cache = createCache()) {
+      cache.storeUnsat(ImmutableList.of(xGreater0, xLess0), true);
+      cache.storeUnsat(ImmutableList.of(xGreater0), false);
+    }
+
+    Configuration sharedConfig =
+        TestDataTools.configurationForTest()
+            .setOption("solver.persistentCache.file", file.toString())
+            .setOption("solver.persistentCache.shared", "true")
+            .build();
+    try (PersistentQueryCache cache1 =
+            new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name());
+        PersistentQueryCache cache2 =
+            new PersistentQueryCache(sharedConfig, logger, mgrv, solverToUse().name())) {
+      // the file is loaded only once, but both instances report its entries
+      assertThat(cache1.getLoadedEntries()).isEqualTo(2);
+      assertThat(cache2.getLoadedEntries()).isEqualTo(2);
+      assertThat(cache2.isUnsat(ImmutableList.of(xGreater0, xLess0))).isTrue();
+    }
+  }
+
+  @Test
+  public void testInstancesAppendToSameFile() throws InvalidConfigurationException {
+    try (PersistentQueryCache cache1 = createCache();
+        PersistentQueryCache cache2 = createCache()) {
+      cache1.storeUnsat(ImmutableList.of(xGreater0, xLess0), true);
+      cache2.storeUnsat(ImmutableList.of(xGreater0), false);
+      cache1.storePredicateValue(xGreater0, yGreater0, (byte) 1);
+    }
+
+    try (PersistentQueryCache cache = createCache()) {
+      assertThat(cache.getLoadedEntries()).isEqualTo(3);
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0, xLess0))).isTrue();
+      assertThat(cache.isUnsat(ImmutableList.of(xGreater0))).isFalse();
+      assertThat(cache.getPredicateValue(xGreater0, yGreater0)).isEqualTo((byte) 1);
+    }
+  }
+}
@@ -14,6 +14,7 @@ import static org.sosy_lab.java_smt.api.SolverContext.ProverOptions.GENERATE_UNS
 
 import com.google.common.annotations.VisibleForTesting;
 import com.google.common.base.Verify;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
@@ -110,6 +111,9 @@ public final class Solver implements AutoCloseable {
   private final Map<Object, Map<ImmutableSet<BooleanFormula>, Boolean>> groupedUnsatCache =
       new HashMap<>();
 
+  /** Cache for results of previous runs and of other analyses, may be disabled. */
+  private final PersistentQueryCache persistentCache;
+
   private final LogManager logger;
 
   // stats
@@ -154,6 +158,7 @@ public final class Solver implements AutoCloseable {
 
     fmgr = new FormulaManagerView(solvingContext.getFormulaManager(), config, pLogger);
     bfmgr = fmgr.getBooleanFormulaManager();
+    persistentCache = new PersistentQueryCache(config, pLogger, fmgr, solver.name());
 
     if (checkUFs) {
       ufCheckingProverOptions = new UFCheckingProverOptions(config);
@@ -198,6 +203,7 @@ public final class Solver implements AutoCloseable {
 
     fmgr = new FormulaManagerView(pContext.getFormulaManager(), pConfig, pLogger);
     bfmgr = fmgr.getBooleanFormulaManager();
+    persistentCache = new PersistentQueryCache(pConfig, pLogger, fmgr, solver.name());
     logger = pLogger;
 
     if (checkUFs) {
@@ -264,6 +270,15 @@ public final class Solver implements AutoCloseable {
     return fmgr;
   }
 
+  /**
+   * Return the cache for results of solver queries from previous runs and other analyses in the
+   * same JVM, or null if it is disabled. Users of this solver can store the results of their own
+   * (more expensive) queries in it.
+   */
+  public @Nullable PersistentQueryCache getPersistentQueryCache() {
+    return persistentCache.isEnabled() ? persistentCache : null;
+  }
+
   /**
    * Return the underlying {@link FormulaManagerView} that can be used for creating and manipulating
    * formulas.
@@ -310,6 +325,9 @@ public final class Solver implements AutoCloseable {
               "Max time for allSat queries",
               stats.getMaxTimeOfAllSatQueries().formatAs(TimeUnit.SECONDS));
     }
+    if (persistentCache.isEnabled()) {
+      persistentCache.printStatistics(pOut);
+    }
   }
 
   /**
@@ -400,7 +418,13 @@ public final class Solver implements AutoCloseable {
 
     solverTime.start();
     try {
-      result = isUnsatUncached(f);
+      result = persistentCache.isUnsat(ImmutableList.of(f));
+      if (result != null) {
+        cachedSatChecks++;
+      } else {
+        result = isUnsatUncached(f);
+        persistentCache.storeUnsat(ImmutableList.of(f), result);
+      }
 
       unsatCache.put(f, result);
       return result;
@@ -457,6 +481,14 @@ public final class Solver implements AutoCloseable {
       stored = new HashMap<>(stored);
     }
 
+    Boolean persistentResult = persistentCache.isUnsat(lemmas);
+    if (persistentResult != null) {
+      cachedSatChecks++;
+      stored.put(ImmutableSet.copyOf(lemmas), persistentResult);
+      groupedUnsatCache.put(cacheKey, ImmutableMap.copyOf(stored));
+      return persistentResult;
+    }
+
     ProverOptions[] opts;
     if (cacheUnsatCores) {
       opts = new ProverOptions[] {GENERATE_UNSAT_CORE};
@@ -469,7 +501,9 @@ public final class Solver implements AutoCloseable {
       for (BooleanFormula lemma : lemmas) {
         pe.addConstraint(lemma);
       }
-      if (pe.isUnsat()) {
+      boolean isUnsat = pe.isUnsat();
+      persistentCache.storeUnsat(lemmas, isUnsat);
+      if (isUnsat) {
         if (cacheUnsatCores) {
           stored.put(ImmutableSet.copyOf(pe.getUnsatCore()), true);
         } else {
@@ -541,6 +575,8 @@ public final class Solver implements AutoCloseable {
    */
   @Override
   public void close() {
+    persistentCache.close();
+
     // Reliably close both formula managers and re-throw exceptions,
     // such that no exception gets lost and both managers get closed.
     // Taken from https://stackoverflow.com/questions/24705055/wrapping-multiple-autocloseables
@@ -72,6 +72,17 @@ public class SlicerFactory implements StatisticsProvider {
                 + " to true can decrease the size of the resulting slice.")
     private boolean partiallyRelevantEdges = true;
 
+    @Option(
+        secure = true,
+        name = "demandDrivenDependenceGraph",
+        description =
+            "Whether to build the dependence graph for static slicing only when the slicing"
+                + " criteria are known, and only for the functions that may be executed before"
+                + " one of them. Only the pointer analysis for the dependence graph is done up"
+                + " front. The dependence graph is built again if later slicing criteria need"
+                + " further functions.")
+    private boolean demandDrivenDependenceGraph = false;
+
     public SlicerOptions(Configuration pConfig) throws InvalidConfigurationException {
       pConfig.inject(this);
     }
@@ -91,6 +102,17 @@ public class SlicerFactory implements StatisticsProvider {
     stats = new ArrayList<>();
   }
 
+  private CSystemDependenceGraphBuilder createDependenceGraphBuilder(
+      LogManager pLogger, ShutdownNotifier pShutdownNotifier, Configuration pConfig, CFA pCfa)
+      throws CPAException, InvalidConfigurationException, InterruptedException {
+
+    final CSystemDependenceGraphBuilder depGraphBuilder =
+        new CSystemDependenceGraphBuilder(pCfa, pConfig, pLogger, pShutdownNotifier);
+    depGraphBuilder.collectStatistics(stats);
+    depGraphBuilder.prepare();
+    return depGraphBuilder;
+  }
+
   private CSystemDependenceGraph createDependenceGraph(
       LogManager pLogger, ShutdownNotifier pShutdownNotifier, Configuration pConfig, CFA pCfa)
       throws CPAException, InvalidConfigurationException, InterruptedException {
@@ -126,6 +148,15 @@ public class SlicerFactory implements StatisticsProvider {
     final SlicingType slicingType = options.getSlicingType();
     switch (slicingType) {
       case STATIC:
+        if (options.demandDrivenDependenceGraph) {
+          return new StaticSlicer(
+              extractor,
+              pLogger,
+              pShutdownNotifier,
+              pConfig,
+              createDependenceGraphBuilder(pLogger, pShutdownNotifier, pConfig, pCfa),
+              options.partiallyRelevantEdges);
+        }
         CSystemDependenceGraph dependenceGraph =
             createDependenceGraph(pLogger, pShutdownNotifier, pConfig, pCfa);
         return new StaticSlicer(
@@ -26,6 +26,7 @@ import java.util.Optional;
 import java.util.Set;
 import java.util.function.Function;
 import java.util.function.Predicate;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -46,6 +47,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.util.CFAUtils;
 import org.sosy_lab.cpachecker.util.dependencegraph.CSystemDependenceGraph;
+import org.sosy_lab.cpachecker.util.dependencegraph.CSystemDependenceGraphBuilder;
 import org.sosy_lab.cpachecker.util.dependencegraph.SystemDependenceGraph;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
@@ -64,7 +66,9 @@ import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
  */
 public class StaticSlicer extends AbstractSlicer implements StatisticsProvider {
 
-  private final CSystemDependenceGraph sdg;
+  // exactly one of these is set: either a fixed SDG, or a builder for SDGs for the given criteria
+  private final @Nullable CSystemDependenceGraph sdg;
+  private final @Nullable CSystemDependenceGraphBuilder sdgBuilder;
 
   private final StatCounter sliceCount = new StatCounter("Number of slicing procedures");
   private final StatTimer slicingTime = new StatTimer(StatKind.SUM, "Time needed for slicing");
@@ -90,15 +94,35 @@ public class StaticSlicer extends AbstractSlicer implements StatisticsProvider {
     }
 
     sdg = pSdg;
+    sdgBuilder = null;
     partiallyRelevantEdges = pPartiallyRelevantEdges;
   }
 
-  private Function<CFAEdge, Iterable<CSystemDependenceGraph.Node>>
-      createCfaEdgeToSdgNodesFunction() {
+  /**
+   * Creates a slicer that builds the dependence graph on demand for the slicing criteria of each
+   * slicing procedure, see {@link CSystemDependenceGraphBuilder#build(Collection)}.
+   */
+  StaticSlicer(
+      SlicingCriteriaExtractor pExtractor,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      Configuration pConfig,
+      CSystemDependenceGraphBuilder pSdgBuilder,
+      boolean pPartiallyRelevantEdges)
+      throws InvalidConfigurationException {
+    super(pExtractor, pLogger, pShutdownNotifier, pConfig);
+
+    sdg = null;
+    sdgBuilder = checkNotNull(pSdgBuilder);
+    partiallyRelevantEdges = pPartiallyRelevantEdges;
+  }
+
+  private static Function<CFAEdge, Iterable<CSystemDependenceGraph.Node>>
+      createCfaEdgeToSdgNodesFunction(CSystemDependenceGraph pSdg) {
 
     Multimap<CFAEdge, CSystemDependenceGraph.Node> nodesPerCfaNode = ArrayListMultimap.create();
 
-    for (CSystemDependenceGraph.Node node : sdg.getNodes()) {
+    for (CSystemDependenceGraph.Node node : pSdg.getNodes()) {
       Optional<CFAEdge> optCfaEdge = node.getStatement();
       if (optCfaEdge.isPresent()) {
         nodesPerCfaNode.put(optCfaEdge.orElseThrow(), node);
@@ -112,20 +136,22 @@ public class StaticSlicer extends AbstractSlicer implements StatisticsProvider {
   public Slice getSlice0(CFA pCfa, Collection<CFAEdge> pSlicingCriteria)
       throws InterruptedException {
 
-    slicingTime.start();
-
     Set<CFAEdge> criteriaEdges = new LinkedHashSet<>(pSlicingCriteria);
+    CSystemDependenceGraph dependenceGraph =
+        sdgBuilder != null ? sdgBuilder.build(criteriaEdges) : checkNotNull(sdg);
+
+    slicingTime.start();
 
     Set<CSystemDependenceGraph.Node> startNodes = new LinkedHashSet<>();
     Function<CFAEdge, Iterable<CSystemDependenceGraph.Node>> cfaEdgeToSdgNodes =
-        createCfaEdgeToSdgNodesFunction();
+        createCfaEdgeToSdgNodesFunction(dependenceGraph);
 
     for (CFAEdge criteriaEdge : criteriaEdges) {
       Iterables.addAll(startNodes, cfaEdgeToSdgNodes.apply(criteriaEdge));
     }
 
     Phase1Visitor phase1Visitor = new Phase1Visitor();
-    sdg.traverse(startNodes, sdg.createVisitOnceVisitor(phase1Visitor));
+    dependenceGraph.traverse(startNodes, dependenceGraph.createVisitOnceVisitor(phase1Visitor));
     Set<CFAEdge> relevantEdges = new LinkedHashSet<>(phase1Visitor.getRelevantEdges());
 
     startNodes.clear();
@@ -139,7 +165,7 @@ public class StaticSlicer extends AbstractSlicer implements StatisticsProvider {
     }
 
     Phase2Visitor phase2Visitor = new Phase2Visitor(relevantEdges);
-    sdg.traverse(startNodes, sdg.createVisitOnceVisitor(phase2Visitor));
+    dependenceGraph.traverse(startNodes, dependenceGraph.createVisitOnceVisitor(phase2Visitor));
     relevantEdges.addAll(phase2Visitor.getRelevantEdges());
 
     Set<CSystemDependenceGraph.Node> relevantSdgNodes =
@@ -147,7 +173,7 @@ public class StaticSlicer extends AbstractSlicer implements StatisticsProvider {
     final Slice slice =
         new SdgProgramSlice(
             pCfa,
-            sdg,
+            dependenceGraph,
             cfaEdgeToSdgNodes,
             ImmutableSet.copyOf(relevantSdgNodes),
             ImmutableSet.copyOf(criteriaEdges),
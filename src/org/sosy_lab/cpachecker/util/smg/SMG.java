@@ -13,7 +13,6 @@ import com.google.common.base.Preconditions;
 import com.google.common.base.Predicate;
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableList;
-import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.ImmutableSortedMap;
 import java.math.BigInteger;
@@ -71,13 +70,15 @@ public class SMG {
   private final PersistentMap<SMGObject, PersistentSet<SMGHasValueEdge>> hasValueEdges;
   private final PersistentMap<SMGValue, PersistentMap<SMGObject, Integer>>
       valuesToRegionsTheyAreSavedIn;
-  private final ImmutableMap<SMGValue, SMGPointsToEdge> pointsToEdges;
+  private final PersistentMap<SMGValue, SMGPointsToEdge> pointsToEdges;
 
   // Get all pointers (values that are pointers) and # of times pointing towards an object
   private final PersistentMap<SMGObject, PersistentMap<SMGValue, Integer>>
       objectsAndPointersPointingAtThem;
   private final BigInteger sizeOfPointer;
 
+  private int hashCache = 0;
+
   /** Creates a new, empty SMG */
   public SMG(BigInteger pSizeOfPointer) {
     hasValueEdges = PathCopyingPersistentTreeMap.of();
@@ -92,13 +93,10 @@ public class SMG {
     SMGPointsToEdge nullPointer =
         new SMGPointsToEdge(getNullObject(), BigInteger.ZERO, SMGTargetSpecifier.IS_REGION);
     pointsToEdges =
-        ImmutableMap.of(
-            SMGValue.zeroValue(),
-            nullPointer,
-            SMGValue.zeroFloatValue(),
-            nullPointer,
-            SMGValue.zeroDoubleValue(),
-            nullPointer);
+        PathCopyingPersistentTreeMap.<SMGValue, SMGPointsToEdge>of()
+            .putAndCopy(SMGValue.zeroValue(), nullPointer)
+            .putAndCopy(SMGValue.zeroFloatValue(), nullPointer)
+            .putAndCopy(SMGValue.zeroDoubleValue(), nullPointer);
     sizeOfPointer = pSizeOfPointer;
   }
 
@@ -107,7 +105,7 @@ public class SMG {
       PersistentMap<SMGValue, Integer> pSmgValues,
       PersistentMap<SMGObject, PersistentSet<SMGHasValueEdge>> pHasValueEdges,
       PersistentMap<SMGValue, PersistentMap<SMGObject, Integer>> pValuesToRegionsTheyAreSavedIn,
-      ImmutableMap<SMGValue, SMGPointsToEdge> pPointsToEdges,
+      PersistentMap<SMGValue, SMGPointsToEdge> pPointsToEdges,
       PersistentMap<SMGObject, PersistentMap<SMGValue, Integer>> pObjectsAndPointersPointingAtThem,
       BigInteger pSizeOfPointer) {
     smgObjects = pSmgObjects;
@@ -131,7 +129,7 @@ public class SMG {
         sizeOfPointer);
   }
 
-  private SMG of(ImmutableMap<SMGValue, SMGPointsToEdge> pPointsToEdges) {
+  private SMG of(PersistentMap<SMGValue, SMGPointsToEdge> pPointsToEdges) {
     return new SMG(
         smgObjects,
         smgValuesAndNestingLvl,
@@ -260,34 +258,15 @@ public class SMG {
     if (!pointsToEdges.containsKey(pValue)) {
       return this;
     }
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> builder = ImmutableMap.builder();
-    SMGObject target = null;
-    for (Entry<SMGValue, SMGPointsToEdge> entry : pointsToEdges.entrySet()) {
-      if (!entry.getKey().equals(pValue)) {
-        builder = builder.put(entry);
-      } else {
-        target = entry.getValue().pointsTo();
-      }
-    }
-    if (target != null) {
-      SMG newSMG = decrementPointerToObjectMap(pValue, target);
-      return new SMG(
-          newSMG.smgObjects,
-          newSMG.smgValuesAndNestingLvl,
-          newSMG.hasValueEdges,
-          newSMG.valuesToRegionsTheyAreSavedIn,
-          builder.buildOrThrow(),
-          newSMG.objectsAndPointersPointingAtThem,
-          newSMG.sizeOfPointer);
-    }
+    SMG newSMG = decrementPointerToObjectMap(pValue, pointsToEdges.get(pValue).pointsTo());
     return new SMG(
-        smgObjects,
-        smgValuesAndNestingLvl,
-        hasValueEdges,
-        valuesToRegionsTheyAreSavedIn,
-        builder.buildOrThrow(),
-        objectsAndPointersPointingAtThem,
-        sizeOfPointer);
+        newSMG.smgObjects,
+        newSMG.smgValuesAndNestingLvl,
+        newSMG.hasValueEdges,
+        newSMG.valuesToRegionsTheyAreSavedIn,
+        pointsToEdges.removeAndCopy(pValue),
+        newSMG.objectsAndPointersPointingAtThem,
+        newSMG.sizeOfPointer);
   }
 
   /**
@@ -369,13 +348,10 @@ public class SMG {
       throw new RuntimeException("A SMG-points-to-edge can have only 1 target!");
     }
 
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> pointsToEdgesBuilder = ImmutableMap.builder();
-    pointsToEdgesBuilder.putAll(pointsToEdges);
-    pointsToEdgesBuilder.put(source, edge);
     // Don't increment the pointer to target obj map, as this might add pointers that are not really
     // saved in an object yet. Increment when they are saved in an obj.
     // SMG newSMG = incrementPointerToObjectMap(source, edge.pointsTo());
-    SMG newSMG = of(pointsToEdgesBuilder.buildOrThrow());
+    SMG newSMG = of(pointsToEdges.putAndCopy(source, edge));
     return newSMG;
   }
 
@@ -497,38 +473,27 @@ public class SMG {
    * @return A modified copy of the SMG.
    */
   public SMG copyAndSetPTEdges(SMGPointsToEdge edge, SMGValue newSource) {
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> pointsToEdgesBuilder = ImmutableMap.builder();
     SMG newSMG = this;
     if (pointsToEdges.containsKey(newSource)) {
       // Replacing an existing pte. This only changes the association of the PTE to the value, not
       // the values.
-      for (Entry<SMGValue, SMGPointsToEdge> entry : pointsToEdges.entrySet()) {
-        if (!entry.getKey().equals(newSource)) {
-          pointsToEdgesBuilder.put(entry);
-        } else {
-          pointsToEdgesBuilder.put(newSource, edge);
-          // Check if the pte is actually used and increment PointerToObjectMap only for pointers
-          // existing in memory
-          for (int i = 0;
-              i
-                  < valuesToRegionsTheyAreSavedIn
-                      .getOrDefault(newSource, PathCopyingPersistentTreeMap.of())
-                      .size();
-              i++) {
-            newSMG =
-                newSMG.decrementPointerToObjectMap(
-                    newSource, pointsToEdges.get(newSource).pointsTo());
-            newSMG = newSMG.incrementPointerToObjectMap(newSource, edge.pointsTo());
-          }
-        }
+      // Check if the pte is actually used and increment PointerToObjectMap only for pointers
+      // existing in memory
+      for (int i = 0;
+          i
+              < valuesToRegionsTheyAreSavedIn
+                  .getOrDefault(newSource, PathCopyingPersistentTreeMap.of())
+                  .size();
+          i++) {
+        newSMG =
+            newSMG.decrementPointerToObjectMap(newSource, pointsToEdges.get(newSource).pointsTo());
+        newSMG = newSMG.incrementPointerToObjectMap(newSource, edge.pointsTo());
       }
     } else {
       // new pointer for this value, not necessarily new pointer towards the target
-      pointsToEdgesBuilder.putAll(pointsToEdges);
-      pointsToEdgesBuilder.put(newSource, edge);
       newSMG = incrementPointerToObjectMap(newSource, edge.pointsTo());
     }
-    return newSMG.of(pointsToEdgesBuilder.buildOrThrow());
+    return newSMG.of(pointsToEdges.putAndCopy(newSource, edge));
   }
 
   /**
@@ -826,7 +791,7 @@ public class SMG {
     if (!smgObjects.containsKey(objectToRemove) || !isValid(objectToRemove)) {
       return SMGAndSMGObjects.ofEmptyObjects(this);
     }
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> newPointers = ImmutableMap.builder();
+    PersistentMap<SMGValue, SMGPointsToEdge> newPointers = pointsToEdges;
     ImmutableSet.Builder<SMGObject> objectsToRemoveBuilder = ImmutableSet.builder();
     ImmutableSet.Builder<SMGValue> valuesToRemoveBuilder = ImmutableSet.builder();
     // We expect there to be very few, if any objects towards a 0+ element as we don't join
@@ -835,8 +800,7 @@ public class SMG {
     for (Entry<SMGValue, SMGPointsToEdge> pointsToEntry : pointsToEdges.entrySet()) {
       if (pointsToEntry.getValue().pointsTo().equals(objectToRemove)) {
         valuesToRemoveBuilder.add(pointsToEntry.getKey());
-      } else {
-        newPointers.put(pointsToEntry);
+        newPointers = newPointers.removeAndCopy(pointsToEntry.getKey());
       }
     }
 
@@ -862,7 +826,7 @@ public class SMG {
             newSMG.smgValuesAndNestingLvl,
             newSMG.hasValueEdges.removeAndCopy(objectToRemove),
             newSMG.valuesToRegionsTheyAreSavedIn,
-            newPointers.buildOrThrow(),
+            newPointers,
             newSMG.objectsAndPointersPointingAtThem,
             newSMG.sizeOfPointer);
     ImmutableSet<SMGObject> objectsToRemove = objectsToRemoveBuilder.build();
@@ -1440,37 +1404,6 @@ public class SMG {
         .map(Entry::getKey);
   }
 
-  /*
-   * Checks if there are valid heap objects that point to the given target object and might be lists (== size and fitting nfo).
-   */
-  public boolean hasPotentialListObjectsWithPointersToObject(
-      SMGObject targetObject, BigInteger suspectedNfo, Collection<SMGObject> heapObjects) {
-    for (Entry<SMGValue, SMGPointsToEdge> entry : pointsToEdges.entrySet()) {
-      if (targetObject.equals(entry.getValue().pointsTo())) {
-        SMGValue pointerValue = entry.getKey();
-        for (SMGObject heapObj : heapObjects) {
-          if (!isValid(heapObj)) {
-            continue;
-          }
-          for (SMGHasValueEdge hve : hasValueEdges.getOrDefault(heapObj, PersistentSet.of())) {
-            if (hve.hasValue() == pointerValue) {
-              if (heapObj.isSizeEqual(targetObject)) {
-                if (hve.getOffset().compareTo(suspectedNfo) == 0) {
-                  return false;
-                }
-                // maybePreviousObj -> potentialRoot might be a back pointer, this is fine however
-                // as we
-                // will eliminate those by traversing along the NFOs
-              }
-              // TODO: use solver to check for equal size?
-            }
-          }
-        }
-      }
-    }
-    return true;
-  }
-
   /**
    * Checks whether a given SMGObject is valid.
    *
@@ -1483,7 +1416,11 @@ public class SMG {
 
   @Override
   public int hashCode() {
-    return Objects.hash(hasValueEdges, smgObjects, pointsToEdges, smgValuesAndNestingLvl);
+    // SMGs are immutable, and states with equal SMGs are compared often
+    if (hashCache == 0) {
+      hashCache = Objects.hash(hasValueEdges, smgObjects, pointsToEdges, smgValuesAndNestingLvl);
+    }
+    return hashCache;
   }
 
   @Override
@@ -1491,7 +1428,9 @@ public class SMG {
     if (this == obj) {
       return true;
     }
+    // Sub-maps that are shared between the SMGs are compared by identity in Objects.equals()
     return obj instanceof SMG other
+        && hashCode() == other.hashCode()
         && Objects.equals(hasValueEdges, other.hasValueEdges)
         && Objects.equals(smgObjects, other.smgObjects)
         && Objects.equals(pointsToEdges, other.pointsToEdges)
@@ -2041,22 +1980,13 @@ public class SMG {
       return this;
     }
 
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> newPTEs = ImmutableMap.builder();
-    for (Entry<SMGValue, SMGPointsToEdge> ptrValuesAndPTE : pointsToEdges.entrySet()) {
-      SMGValue currentValue = ptrValuesAndPTE.getKey();
-      if (currentValue.equals(pValue)) {
-        newPTEs.put(
-            currentValue, ptrValuesAndPTE.getValue().copyAndSetTargetSpecifier(pSpecifierToSet));
-      } else {
-        newPTEs.put(ptrValuesAndPTE);
-      }
-    }
     return new SMG(
         smgObjects,
         smgValuesAndNestingLvl,
         hasValueEdges,
         valuesToRegionsTheyAreSavedIn,
-        newPTEs.buildOrThrow(),
+        pointsToEdges.putAndCopy(
+            pValue, pointsToEdges.get(pValue).copyAndSetTargetSpecifier(pSpecifierToSet)),
         objectsAndPointersPointingAtThem,
         sizeOfPointer);
   }
@@ -2087,7 +2017,6 @@ public class SMG {
             .stream()
             .filter(v -> getNestingLevel(v) == nestingLevelToChange)
             .collect(ImmutableSet.toImmutableSet());
-    ImmutableMap.Builder<SMGValue, SMGPointsToEdge> newPTEs = ImmutableMap.builder();
     // We assume that there is only 1 pointer (value) in the set above
     if (pointersTowardsTarget.isEmpty()) {
       return this;
@@ -2110,22 +2039,20 @@ public class SMG {
     // TODO: check if a pointer already exists and switch all values of the pointers to truly switch
     // to the other value
 
-    for (Entry<SMGValue, SMGPointsToEdge> ptrValuesAndPTE : pointsToEdges.entrySet()) {
-      SMGValue currentValue = ptrValuesAndPTE.getKey();
-      // pointersTowardsTargetNeedSwitching contains only the SMGValues that need switching
-      if (pointersTowardsTargetNeedSwitching.contains(currentValue)) {
-        newPTEs.put(
-            currentValue, ptrValuesAndPTE.getValue().copyAndSetTargetSpecifier(pSpecifierToSet));
-      } else {
-        newPTEs.put(ptrValuesAndPTE);
-      }
+    PersistentMap<SMGValue, SMGPointsToEdge> newPTEs = pointsToEdges;
+    // pointersTowardsTargetNeedSwitching contains only the SMGValues that need switching
+    for (SMGValue currentValue : pointersTowardsTargetNeedSwitching) {
+      newPTEs =
+          newPTEs.putAndCopy(
+              currentValue,
+              pointsToEdges.get(currentValue).copyAndSetTargetSpecifier(pSpecifierToSet));
     }
     return new SMG(
         smgObjects,
         smgValuesAndNestingLvl,
         hasValueEdges,
         valuesToRegionsTheyAreSavedIn,
-        newPTEs.buildOrThrow(),
+        newPTEs,
         objectsAndPointersPointingAtThem,
         sizeOfPointer);
   }
@@ -8,9 +8,12 @@
 
 package org.sosy_lab.cpachecker.util.smg.join;
 
+import com.google.common.collect.HashMultiset;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Multiset;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.Collections;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.Map.Entry;
@@ -23,6 +26,9 @@ public class NodeMapping {
   private final Map<SMGObject, SMGObject> objectMap = new HashMap<>();
   private final Map<SMGValue, SMGValue> valueMap = new HashMap<>();
 
+  // The targets of objectMap, such that matching objects does not need to search all mappings
+  private final Multiset<SMGObject> mappedObjects = HashMultiset.create();
+
   public SMGValue getMappedValue(SMGValue value) {
     return valueMap.get(value);
   }
@@ -36,7 +42,11 @@ public class NodeMapping {
   }
 
   public void addMapping(SMGObject o1, SMGObject o2) {
-    objectMap.put(o1, o2);
+    SMGObject oldTarget = objectMap.put(o1, o2);
+    if (oldTarget != null) {
+      mappedObjects.remove(oldTarget);
+    }
+    mappedObjects.add(o2);
   }
 
   /**
@@ -56,15 +66,18 @@ public class NodeMapping {
    * to update the mapping and not chain gets.
    */
   public void replaceObjectMapping(SMGObject oldTarget, SMGObject newTarget) {
+    if (!mappedObjects.contains(oldTarget)) {
+      return;
+    }
     for (Entry<SMGObject, SMGObject> entry : new ArrayList<>(objectMap.entrySet())) {
       if (entry.getValue().equals(oldTarget)) {
-        objectMap.put(entry.getKey(), newTarget);
+        addMapping(entry.getKey(), newTarget);
       }
     }
   }
 
   public boolean mappingExists(SMGObject pMappedObject) {
-    return objectMap.containsValue(pMappedObject);
+    return mappedObjects.contains(pMappedObject);
   }
 
   public boolean hasMapping(SMGValue pValue) {
@@ -76,7 +89,7 @@ public class NodeMapping {
   }
 
   public Collection<SMGObject> getMappedObjects() {
-    return ImmutableSet.copyOf(objectMap.values());
+    return ImmutableSet.copyOf(mappedObjects.elementSet());
   }
 
   public Collection<SMGValue> getMappedValues() {
@@ -84,7 +97,7 @@ public class NodeMapping {
   }
 
   public Map<SMGObject, SMGObject> getObjectMap() {
-    return objectMap;
+    return Collections.unmodifiableMap(objectMap);
   }
 
   public Map<SMGValue, SMGValue> getValueMap() {
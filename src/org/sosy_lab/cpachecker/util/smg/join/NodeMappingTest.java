@@ -0,0 +1,57 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.smg.join;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.Test;
+import org.sosy_lab.cpachecker.util.smg.graph.SMGObject;
+
+public class NodeMappingTest extends SMGJoinTest0 {
+
+  private final SMGObject srcObj1 = createRegion(mockType4bSize);
+  private final SMGObject srcObj2 = createRegion(mockType4bSize);
+  private final SMGObject destObj1 = createRegion(mockType4bSize);
+  private final SMGObject destObj2 = createRegion(mockType4bSize);
+
+  @Test
+  public void mappedObjectsTest() {
+    NodeMapping mapping = new NodeMapping();
+    mapping.addMapping(srcObj1, destObj1);
+    mapping.addMapping(srcObj2, destObj1);
+    assertThat(mapping.mappingExists(destObj1)).isTrue();
+    assertThat(mapping.mappingExists(destObj2)).isFalse();
+    assertThat(mapping.getMappedObjects()).containsExactly(destObj1);
+
+    // Overwriting a mapping removes the old target only if nothing else is mapped to it
+    mapping.addMapping(srcObj1, destObj2);
+    assertThat(mapping.mappingExists(destObj1)).isTrue();
+    assertThat(mapping.getMappedObjects()).containsExactly(destObj1, destObj2);
+    mapping.addMapping(srcObj2, destObj2);
+    assertThat(mapping.mappingExists(destObj1)).isFalse();
+    assertThat(mapping.getMappedObjects()).containsExactly(destObj2);
+  }
+
+  @Test
+  public void replaceObjectMappingTest() {
+    NodeMapping mapping = new NodeMapping();
+    mapping.addMapping(srcObj1, destObj1);
+    mapping.addMapping(srcObj2, destObj1);
+
+    mapping.replaceObjectMapping(destObj1, destObj2);
+    assertThat(mapping.getMappedObject(srcObj1)).isEqualTo(destObj2);
+    assertThat(mapping.getMappedObject(srcObj2)).isEqualTo(destObj2);
+    assertThat(mapping.mappingExists(destObj1)).isFalse();
+    assertThat(mapping.mappingExists(destObj2)).isTrue();
+
+    // Nothing is mapped to destObj1 anymore
+    mapping.replaceObjectMapping(destObj1, srcObj1);
+    assertThat(mapping.getMappedObjects()).containsExactly(destObj2);
+  }
+}
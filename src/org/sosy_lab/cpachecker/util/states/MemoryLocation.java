@@ -25,11 +25,14 @@ import org.sosy_lab.cpachecker.cfa.ast.ASimpleDeclaration;
 @Immutable
 public final class MemoryLocation implements Comparable<MemoryLocation>, Serializable {
 
-  private static final long serialVersionUID = -8910967707373729034L;
+  private static final long serialVersionUID = 4375214506712339473L;
   private final @Nullable String functionName;
   private final String identifier;
   private final @Nullable Long offset;
 
+  // Memory locations are used as keys in the maps of many abstract states
+  private final int hashCode;
+
   private MemoryLocation(
       @Nullable String pFunctionName, String pIdentifier, @Nullable Long pOffset) {
     checkNotNull(pIdentifier);
@@ -37,6 +40,7 @@ public final class MemoryLocation implements Comparable<MemoryLocation>, Seriali
     functionName = pFunctionName;
     identifier = pIdentifier;
     offset = pOffset;
+    hashCode = Objects.hash(functionName, identifier, offset);
   }
 
   @Override
@@ -47,6 +51,7 @@ public final class MemoryLocation implements Comparable<MemoryLocation>, Seriali
     }
 
     return other instanceof MemoryLocation otherLocation
+        && hashCode == otherLocation.hashCode
         && Objects.equals(functionName, otherLocation.functionName)
         && Objects.equals(identifier, otherLocation.identifier)
         && Objects.equals(offset, otherLocation.offset);
@@ -54,7 +59,7 @@ public final class MemoryLocation implements Comparable<MemoryLocation>, Seriali
 
   @Override
   public int hashCode() {
-    return Objects.hash(functionName, identifier, offset);
+    return hashCode;
   }
 
   /** Create an instance for the given declaration, which usually should be a variable. */
@@ -227,6 +232,9 @@ public final class MemoryLocation implements Comparable<MemoryLocation>, Seriali
 
   @Override
   public int compareTo(MemoryLocation other) {
+    if (this == other) {
+      return 0;
+    }
     return ComparisonChain.start()
         .compare(functionName, other.functionName, Ordering.natural().nullsFirst())
         .compare(identifier, other.identifier)
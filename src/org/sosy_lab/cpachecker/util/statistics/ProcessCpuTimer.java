@@ -0,0 +1,81 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import static com.google.common.base.Preconditions.checkState;
+
+import java.util.concurrent.TimeUnit;
+import javax.management.JMException;
+import org.sosy_lab.common.time.TimeSpan;
+import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.util.resources.ProcessCpuTime;
+
+/**
+ * Counterpart of {@link Timer} that measures the CPU time of the whole process, i.e., of all
+ * threads, instead of the wall time. Comparing both for the same intervals shows how well some work
+ * was parallelized. Note that the CPU time of unrelated threads (e.g., the garbage collector) is
+ * also counted.
+ *
+ * <p>This class is not thread-safe. It should be started and stopped by the thread that controls
+ * the measured work. If the process CPU time is not available on the current platform, nothing is
+ * measured and {@link #isAvailable()} returns false.
+ */
+public final class ProcessCpuTimer {
+
+  private static final long NOT_RUNNING = -1;
+
+  private long startTime = NOT_RUNNING;
+  private long sumTime = 0;
+  private boolean available = true;
+
+  public void start() {
+    checkState(startTime == NOT_RUNNING, "timer is already running");
+    startTime = read();
+  }
+
+  public void stop() {
+    checkState(startTime != NOT_RUNNING, "timer is not running");
+    long endTime = read();
+    if (available) {
+      sumTime += endTime - startTime;
+    }
+    startTime = NOT_RUNNING;
+  }
+
+  public boolean isRunning() {
+    return startTime != NOT_RUNNING;
+  }
+
+  /** Return whether the process CPU time could be read so far. */
+  public boolean isAvailable() {
+    return available;
+  }
+
+  /** Return the sum of all finished intervals. */
+  public TimeSpan getSumTime() {
+    return TimeSpan.of(sumTime, TimeUnit.NANOSECONDS);
+  }
+
+  private long read() {
+    if (!available) {
+      return 0;
+    }
+    try {
+      return ProcessCpuTime.read();
+    } catch (JMException e) {
+      available = false;
+      return 0;
+    }
+  }
+
+  @Override
+  public String toString() {
+    return available ? getSumTime().formatAs(TimeUnit.SECONDS) : "n/a";
+  }
+}
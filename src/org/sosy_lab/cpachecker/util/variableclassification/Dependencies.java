@@ -123,6 +123,11 @@ class Dependencies {
     partition.addEdge(edge, index);
   }
 
+  /** This function connects the edge with the partition of the variable, which must exist. */
+  public void addEdge(String var, CFAEdge edge, int index) {
+    getPartitionForVar(var).addEdge(edge, index);
+  }
+
   /**
    * This function adds one single variable to the partitions. This is the only method to create a
    * partition with only one element.
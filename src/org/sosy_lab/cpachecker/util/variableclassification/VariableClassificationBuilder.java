@@ -12,13 +12,19 @@ import static com.google.common.base.Preconditions.checkArgument;
 import static com.google.common.base.Preconditions.checkNotNull;
 import static org.sosy_lab.cpachecker.util.CFAUtils.leavingEdges;
 
+import com.google.common.annotations.VisibleForTesting;
 import com.google.common.base.Joiner;
+import com.google.common.base.Throwables;
 import com.google.common.collect.HashMultiset;
+import com.google.common.collect.ImmutableListMultimap;
 import com.google.common.collect.ImmutableMultimap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
+import com.google.common.collect.Multimaps;
 import com.google.common.collect.Multiset;
 import com.google.common.collect.Sets;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
@@ -26,14 +32,20 @@ import java.math.BigInteger;
 import java.nio.charset.Charset;
 import java.nio.file.Path;
 import java.util.Collection;
+import java.util.HashMap;
 import java.util.HashSet;
-import java.util.List;
-import java.util.Optional;
+import java.util.LinkedHashMap;
+import java.util.Map;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -42,41 +54,20 @@ import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.Language;
 import org.sosy_lab.cpachecker.cfa.ast.AReturnStatement;
-import org.sosy_lab.cpachecker.cfa.ast.AVariableDeclaration;
 import org.sosy_lab.cpachecker.cfa.ast.c.CAssignment;
 import org.sosy_lab.cpachecker.cfa.ast.c.CCastExpression;
 import org.sosy_lab.cpachecker.cfa.ast.c.CDeclaration;
 import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCall;
-import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallAssignmentStatement;
-import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallStatement;
 import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CInitializer;
-import org.sosy_lab.cpachecker.cfa.ast.c.CInitializerExpression;
 import org.sosy_lab.cpachecker.cfa.ast.c.CIntegerLiteralExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CParameterDeclaration;
-import org.sosy_lab.cpachecker.cfa.ast.c.CPointerExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CRightHandSide;
 import org.sosy_lab.cpachecker.cfa.ast.c.CSimpleDeclaration;
-import org.sosy_lab.cpachecker.cfa.ast.c.CStatement;
 import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression;
-import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression.UnaryOperator;
-import org.sosy_lab.cpachecker.cfa.ast.c.CVariableDeclaration;
 import org.sosy_lab.cpachecker.cfa.model.AStatementEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
 import org.sosy_lab.cpachecker.cfa.model.c.CAssumeEdge;
-import org.sosy_lab.cpachecker.cfa.model.c.CDeclarationEdge;
-import org.sosy_lab.cpachecker.cfa.model.c.CFunctionCallEdge;
-import org.sosy_lab.cpachecker.cfa.model.c.CFunctionReturnEdge;
-import org.sosy_lab.cpachecker.cfa.model.c.CReturnStatementEdge;
-import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
 import org.sosy_lab.cpachecker.cfa.types.c.CCompositeType;
-import org.sosy_lab.cpachecker.cfa.types.c.CSimpleType;
-import org.sosy_lab.cpachecker.cfa.types.c.CType;
-import org.sosy_lab.cpachecker.cfa.types.c.CTypes;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
@@ -105,6 +96,15 @@ public class VariableClassificationBuilder implements StatisticsProvider {
   @Option(secure = true, description = "Print some information about the variable classification.")
   private boolean printStatsOnStartup = false;
 
+  @Option(
+      secure = true,
+      description =
+          "The number of threads for collecting the variables of the functions in parallel (-1 for"
+              + " the number of available processors). The resulting classification is the same"
+              + " for any number of threads.")
+  @IntegerOption(min = -1)
+  private int threads = 1;
+
   /**
    * Use {@link FunctionEntryNode#getReturnVariable()} and {@link AReturnStatement#asAssignment()}
    * instead.
@@ -113,14 +113,8 @@ public class VariableClassificationBuilder implements StatisticsProvider {
 
   private static final String SCOPE_SEPARATOR = "::";
 
-  private final Set<String> allVars = new HashSet<>();
-
-  private final Set<String> nonIntBoolVars = new HashSet<>();
-  private final Set<String> nonIntEqVars = new HashSet<>();
-  private final Set<String> nonIntAddVars = new HashSet<>();
-  private final Set<String> intOverflowVars = new HashSet<>();
-
-  private final Dependencies dependencies = new Dependencies();
+  private final VariableCollector variables = new VariableCollector();
+  private boolean collectPerFunction = true;
 
   private @Nullable ImmutableSet<String> relevantVariables;
   private @Nullable ImmutableMultimap<CCompositeType, String> relevantFields;
@@ -185,10 +179,10 @@ public class VariableClassificationBuilder implements StatisticsProvider {
 
     // if a value is not boolean, all dependent vars are not boolean and viceversa
     stats.dependencyTimer.start();
-    dependencies.solve(nonIntBoolVars);
-    dependencies.solve(nonIntEqVars);
-    dependencies.solve(nonIntAddVars);
-    dependencies.solve(intOverflowVars);
+    variables.dependencies.solve(variables.nonIntBoolVars);
+    variables.dependencies.solve(variables.nonIntEqVars);
+    variables.dependencies.solve(variables.nonIntAddVars);
+    variables.dependencies.solve(variables.intOverflowVars);
     stats.dependencyTimer.stop();
 
     // Now build the opposites of each non-x-vars-collection.
@@ -201,7 +195,7 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     final Set<Partition> intAddPartitions = new HashSet<>();
 
     stats.hierarchyTimer.start();
-    for (final String var : allVars) {
+    for (final String var : variables.allVars) {
       // we have this hierarchy of classes for variables:
       //        IntBool < IntEqBool < IntAddEqBool < AllInt
       // we define and build:
@@ -210,17 +204,17 @@ public class VariableClassificationBuilder implements StatisticsProvider {
       //        IntAdd  = IntAddEqBool - IntEqBool
       //        Other   = IntAll - IntAddEqBool
 
-      if (!nonIntBoolVars.contains(var)) {
+      if (!variables.nonIntBoolVars.contains(var)) {
         intBoolVars.add(var);
-        intBoolPartitions.add(dependencies.getPartitionForVar(var));
+        intBoolPartitions.add(variables.dependencies.getPartitionForVar(var));
 
-      } else if (!nonIntEqVars.contains(var)) {
+      } else if (!variables.nonIntEqVars.contains(var)) {
         intEqualVars.add(var);
-        intEqualPartitions.add(dependencies.getPartitionForVar(var));
+        intEqualPartitions.add(variables.dependencies.getPartitionForVar(var));
 
-      } else if (!nonIntAddVars.contains(var)) {
+      } else if (!variables.nonIntAddVars.contains(var)) {
         intAddVars.add(var);
-        intAddPartitions.add(dependencies.getPartitionForVar(var));
+        intAddPartitions.add(variables.dependencies.getPartitionForVar(var));
       }
     }
     stats.hierarchyTimer.stop();
@@ -228,12 +222,12 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     // add last vars to dependencies,
     // this allows to get partitions for all vars,
     // otherwise only dependent vars are in the partitions
-    for (String var : allVars) {
-      dependencies.addVar(var);
+    for (String var : variables.allVars) {
+      variables.dependencies.addVar(var);
     }
 
     boolean hasRelevantNonIntAddVars =
-        !Sets.intersection(relevantVariables, nonIntAddVars).isEmpty();
+        !Sets.intersection(relevantVariables, variables.nonIntAddVars).isEmpty();
 
     stats.buildTimer.start();
     VariableClassification result =
@@ -242,16 +236,16 @@ public class VariableClassificationBuilder implements StatisticsProvider {
             intBoolVars,
             intEqualVars,
             intAddVars,
-            intOverflowVars,
+            variables.intOverflowVars,
             relevantVariables,
             addressedVariables,
             relevantFields,
             addressedFields,
-            dependencies.partitions,
+            variables.dependencies.partitions,
             intBoolPartitions,
             intEqualPartitions,
             intAddPartitions,
-            dependencies.edgeToPartition,
+            variables.dependencies.edgeToPartition,
             extractAssumedVariables(cfa.nodes()),
             extractAssignedVariables(cfa.nodes()));
     stats.buildTimer.stop();
@@ -270,11 +264,11 @@ public class VariableClassificationBuilder implements StatisticsProvider {
         w.append("\n\nIntAdd\n\n");
         w.append(intAddVars.toString());
         w.append("\n\nIntOverflow\n\n");
-        w.append(intOverflowVars.toString());
+        w.append(variables.intOverflowVars.toString());
         w.append("\n\nALL\n\n");
-        w.append(allVars.toString());
+        w.append(variables.allVars.toString());
         w.append("\n\nDEPENDENCIES\n\n");
-        w.append(dependencies.toString());
+        w.append(variables.dependencies.toString());
         w.append("\n\nRELEVANT VARS\n\n");
         w.append(relevantVariables.toString());
         w.append("\n\nRELEVANT FIELDS\n\n");
@@ -299,17 +293,28 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     return result;
   }
 
+  /**
+   * Build the classification with a single collector for all nodes, as it is done for a single
+   * thread, independently of the configured number of threads. This is only for comparing both in
+   * tests.
+   */
+  @VisibleForTesting
+  VariableClassification buildWithSingleCollector(CFA cfa) throws UnrecognizedCodeException {
+    collectPerFunction = false;
+    return build(cfa);
+  }
+
   private void dumpDomainTypeStatistics(Path pDomainTypeStatisticsFile, VariableClassification vc) {
     try (Writer w = IO.openOutputFile(pDomainTypeStatisticsFile, Charset.defaultCharset())) {
       Object[][] statMapping = {
         {"intBoolVars", vc.getIntBoolVars().size()},
         {"intEqualVars", vc.getIntEqualVars().size()},
         {"intAddVars", vc.getIntAddVars().size()},
-        {"allVars", allVars.size()},
+        {"allVars", variables.allVars.size()},
         {"intBoolVarsRelevant", countNumberOfRelevantVars(vc.getIntBoolVars())},
         {"intEqualVarsRelevant", countNumberOfRelevantVars(vc.getIntEqualVars())},
         {"intAddVarsRelevant", countNumberOfRelevantVars(vc.getIntAddVars())},
-        {"allVarsRelevant", countNumberOfRelevantVars(allVars)},
+        {"allVarsRelevant", countNumberOfRelevantVars(variables.allVars)},
       };
       // Write header
       for (int col = 0; col < statMapping.length; col++) {
@@ -335,7 +340,7 @@ public class VariableClassificationBuilder implements StatisticsProvider {
 
   private void dumpVariableTypeMapping(Path target, VariableClassification vc) {
     try (Writer w = IO.openOutputFile(target, Charset.defaultCharset())) {
-      for (String var : allVars) {
+      for (String var : variables.allVars) {
         int type = 0;
         if (vc.getIntBoolVars().contains(var)) {
           type += 1 + 2 + 4; // IntBool is subset of IntEqualBool and IntAddEqBool
@@ -380,7 +385,7 @@ public class VariableClassificationBuilder implements StatisticsProvider {
               "number of boolean vars:  " + numOfBooleans,
               "number of intEq vars:    " + numOfIntEquals,
               "number of intAdd vars:   " + numOfIntAdds,
-              "number of all vars:      " + allVars.size(),
+              "number of all vars:      " + variables.allVars.size(),
               "number of rel. vars:     " + relevantVariables.size(),
               "number of addr. vars:    " + addressedVariables.size(),
               "number of rel. fields:   " + relevantFields.size(),
@@ -388,7 +393,7 @@ public class VariableClassificationBuilder implements StatisticsProvider {
               "number of intBool partitions:  " + vc.getIntBoolPartitions().size(),
               "number of intEq partitions:    " + vc.getIntEqualPartitions().size(),
               "number of intAdd partitions:   " + vc.getIntAddPartitions().size(),
-              "number of all partitions:      " + dependencies.partitions.size(),
+              "number of all partitions:      " + variables.dependencies.partitions.size(),
             });
     str.append("\n---------------------------------\n");
 
@@ -401,19 +406,21 @@ public class VariableClassificationBuilder implements StatisticsProvider {
 
   /**
    * This function iterates over all edges of the cfa, collects all variables and orders them into
-   * different sets, i.e. nonBoolean and nonIntEuqalNumber.
+   * different sets, i.e. nonBoolean and nonIntEuqalNumber. Normally, the variables of each
+   * function are collected separately (in parallel if configured) and merged in the order of the
+   * functions, so the result does not depend on the number of threads.
    */
   private void collectVars(CFA cfa) throws UnrecognizedCodeException {
-    Collection<CFANode> nodes = cfa.nodes();
-    VarFieldDependencies varFieldDependencies = VarFieldDependencies.emptyDependencies();
-    for (CFANode node : nodes) {
-      for (CFAEdge edge : leavingEdges(node)) {
-        handleEdge(edge, cfa);
-        varFieldDependencies =
-            varFieldDependencies.withDependencies(
-                VariableAndFieldRelevancyComputer.handleEdge(cfa, edge));
+    int threadCount = collectPerFunction ? Math.min(getThreads(), cfa.getNumberOfFunctions()) : 1;
+    if (threadCount > 1) {
+      collectVarsPerFunction(cfa, threadCount);
+    } else {
+      for (CFANode node : cfa.nodes()) {
+        variables.collectVars(node, cfa);
       }
     }
+
+    VarFieldDependencies varFieldDependencies = variables.getVarFieldDependencies();
     addressedVariables = varFieldDependencies.computeAddressedVariables();
     addressedFields = varFieldDependencies.computeAddressedFields();
     final Pair<ImmutableSet<String>, ImmutableMultimap<CCompositeType, String>> relevant =
@@ -422,6 +429,65 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     relevantFields = relevant.getSecond();
   }
 
+  /**
+   * Collects the variables of each function separately in parallel. The changes of the
+   * dependencies are applied afterwards in the order of the nodes, because the partitions depend on
+   * this order, such that the result is exactly the same as with a single collector.
+   */
+  private void collectVarsPerFunction(CFA cfa, int threadCount) throws UnrecognizedCodeException {
+    ImmutableListMultimap<String, CFANode> nodesPerFunction =
+        Multimaps.index(cfa.nodes(), CFANode::getFunctionName);
+
+    ExecutorService executor =
+        Executors.newFixedThreadPool(
+            threadCount,
+            new ThreadFactoryBuilder()
+                .setDaemon(true) // for killing hanging threads at program exit
+                .setNameFormat("variable-classification-thread-%d")
+                .build());
+    Map<String, VariableCollector> collectors = new HashMap<>();
+    try {
+      Map<String, Future<VariableCollector>> futures = new LinkedHashMap<>();
+      for (Map.Entry<String, Collection<CFANode>> function : nodesPerFunction.asMap().entrySet()) {
+        futures.put(
+            function.getKey(), executor.submit(() -> collectVars(function.getValue(), cfa)));
+      }
+      for (Map.Entry<String, Future<VariableCollector>> future : futures.entrySet()) {
+        collectors.put(future.getKey(), Uninterruptibles.getUninterruptibly(future.getValue()));
+      }
+    } catch (ExecutionException e) {
+      Throwables.throwIfInstanceOf(e.getCause(), UnrecognizedCodeException.class);
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError("unexpected exception while collecting variables", e);
+    } finally {
+      executor.shutdownNow();
+    }
+
+    for (VariableCollector collector : collectors.values()) {
+      variables.addVariables(collector);
+    }
+    for (CFANode node : cfa.nodes()) {
+      variables.applyDependencyChanges(collectors.get(node.getFunctionName()), node);
+    }
+  }
+
+  /** Collects the variables of the given nodes, which are only read and thus can be shared. */
+  private static VariableCollector collectVars(Collection<CFANode> nodes, CFA cfa)
+      throws UnrecognizedCodeException {
+    VariableCollector collector = VariableCollector.recordingDependencies();
+    for (CFANode node : nodes) {
+      collector.collectVars(node, cfa);
+    }
+    return collector;
+  }
+
+  private int getThreads() {
+    if (threads == -1) {
+      return Runtime.getRuntime().availableProcessors();
+    }
+    return Math.max(threads, 1);
+  }
+
   /**
    * This method extracts all variables (i.e., their qualified name), that occur in an assumption.
    */
@@ -466,344 +532,6 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     return assignedVariables;
   }
 
-  /** switch to edgeType and handle all expressions, that could be part of the edge. */
-  private void handleEdge(CFAEdge edge, CFA cfa) throws UnrecognizedCodeException {
-    switch (edge.getEdgeType()) {
-      case AssumeEdge:
-        {
-          CExpression exp = ((CAssumeEdge) edge).getExpression();
-          CFANode pre = edge.getPredecessor();
-
-          VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
-          Set<String> vars = exp.accept(dcv);
-          if (vars != null) {
-            allVars.addAll(vars);
-            dependencies.addAll(vars, dcv.getValues(), edge, 0);
-          }
-
-          exp.accept(new BoolCollectingVisitor(pre, nonIntBoolVars));
-          exp.accept(new IntEqualCollectingVisitor(pre, nonIntEqVars));
-          exp.accept(new IntAddCollectingVisitor(pre, nonIntAddVars));
-          exp.accept(new IntOverflowCollectingVisitor(pre, intOverflowVars));
-
-          break;
-        }
-
-      case DeclarationEdge:
-        {
-          handleDeclarationEdge((CDeclarationEdge) edge);
-          break;
-        }
-
-      case StatementEdge:
-        {
-          final CStatement statement = ((CStatementEdge) edge).getStatement();
-
-          // normal assignment of variable, rightHandSide can be expression or (external)
-          // functioncall
-          if (statement instanceof CAssignment) {
-            handleAssignment(edge, (CAssignment) statement, cfa);
-
-            // pure external functioncall
-          } else if (statement instanceof CFunctionCallStatement) {
-            handleExternalFunctionCall(
-                edge,
-                ((CFunctionCallStatement) statement)
-                    .getFunctionCallExpression()
-                    .getParameterExpressions());
-          }
-
-          break;
-        }
-
-      case FunctionCallEdge:
-        {
-          handleFunctionCallEdge((CFunctionCallEdge) edge);
-          break;
-        }
-
-      case FunctionReturnEdge:
-        {
-          Optional<CVariableDeclaration> returnVar =
-              ((CFunctionReturnEdge) edge).getFunctionEntry().getReturnVariable();
-          if (returnVar.isPresent()) {
-            String scopedVarName = returnVar.orElseThrow().getQualifiedName();
-            dependencies.addVar(scopedVarName);
-            Partition partition = dependencies.getPartitionForVar(scopedVarName);
-            partition.addEdge(edge, 0);
-          }
-          break;
-        }
-
-      case ReturnStatementEdge:
-        {
-          // this is the 'x' from 'return (x);
-          // adding a new temporary FUNCTION_RETURN_VARIABLE, that is not global (-> false)
-          CReturnStatementEdge returnStatement = (CReturnStatementEdge) edge;
-          if (returnStatement.asAssignment().isPresent()) {
-            handleAssignment(edge, returnStatement.asAssignment().orElseThrow(), cfa);
-          }
-          break;
-        }
-
-      case BlankEdge:
-      case CallToReturnEdge:
-        // other cases are not interesting
-        break;
-
-      default:
-        throw new UnrecognizedCodeException("Unknown edgeType: " + edge.getEdgeType(), edge);
-    }
-  }
-
-  /**
-   * This function handles a declaration with an optional initializer. Only simple types are
-   * handled.
-   */
-  private void handleDeclarationEdge(final CDeclarationEdge edge) {
-    CDeclaration declaration = edge.getDeclaration();
-    if (!(declaration instanceof CVariableDeclaration)) {
-      return;
-    }
-
-    CVariableDeclaration vdecl = (CVariableDeclaration) declaration;
-    String varName = vdecl.getQualifiedName();
-    allVars.add(varName);
-
-    // "connect" the edge with its partition
-    Set<String> var = Sets.newHashSetWithExpectedSize(1);
-    var.add(varName);
-    dependencies.addAll(var, new HashSet<>(), edge, 0);
-
-    // only simple types (int, long) are allowed for booleans, ...
-    if (!(vdecl.getType() instanceof CSimpleType)) {
-      nonIntBoolVars.add(varName);
-      nonIntEqVars.add(varName);
-      nonIntAddVars.add(varName);
-    }
-
-    handleType(edge, vdecl.getType(), varName);
-
-    final CInitializer initializer = vdecl.getInitializer();
-
-    if (!(initializer instanceof CInitializerExpression)) {
-      return;
-    }
-
-    CExpression exp = ((CInitializerExpression) initializer).getExpression();
-    if (exp == null) {
-      return;
-    }
-
-    handleExpression(edge, exp, varName);
-  }
-
-  /** This function handles normal assignments of vars. */
-  private void handleAssignment(final CFAEdge edge, final CAssignment assignment, final CFA cfa)
-      throws UnrecognizedCodeException {
-    CRightHandSide rhs = assignment.getRightHandSide();
-    CExpression lhs = assignment.getLeftHandSide();
-    String function = isGlobal(lhs) ? null : edge.getPredecessor().getFunctionName();
-
-    // If we have a simple pointer, we handle it like a simple variable.
-    // This allows us to track dependencies between simple references.
-    String varName = scopeVar(function, lhs.toASTString());
-    if (lhs instanceof CPointerExpression && lhs.getExpressionType() instanceof CSimpleType) {
-      CExpression operand = ((CPointerExpression) lhs).getOperand();
-      if (operand instanceof CIdExpression) {
-        varName = scopeVar(function, operand.toASTString());
-      }
-    }
-
-    // only simple types (int, long) are allowed for booleans, ...
-    if (!(lhs instanceof CIdExpression && lhs.getExpressionType() instanceof CSimpleType)) {
-      nonIntBoolVars.add(varName);
-      nonIntEqVars.add(varName);
-      nonIntAddVars.add(varName);
-    }
-
-    dependencies.addVar(varName);
-
-    if (rhs instanceof CExpression) {
-      handleExpression(edge, ((CExpression) rhs), varName);
-
-    } else if (rhs instanceof CFunctionCallExpression func) {
-      // use FUNCTION_RETURN_VARIABLE for RIGHT SIDE
-      String functionName = func.getFunctionNameExpression().toASTString(); // TODO correct?
-
-      if (cfa.getAllFunctionNames().contains(functionName)) {
-        Optional<? extends AVariableDeclaration> returnVariable =
-            cfa.getFunctionHead(functionName).getReturnVariable();
-        if (!returnVariable.isPresent()) {
-          throw new UnrecognizedCodeException(
-              "Void function " + functionName + " used in assignment", edge, assignment);
-        }
-        String returnVar = returnVariable.get().getQualifiedName();
-        allVars.add(returnVar);
-        allVars.add(varName);
-        dependencies.add(returnVar, varName);
-
-      } else {
-        // external function
-        Partition partition = dependencies.getPartitionForVar(varName);
-        partition.addEdge(edge, -1); // negative value, because all positives are used for params
-      }
-
-      handleExternalFunctionCall(edge, func.getParameterExpressions());
-
-    } else {
-      throw new UnrecognizedCodeException("unhandled assignment", edge, assignment);
-    }
-  }
-
-  /**
-   * This function handles the call of an external function without an assignment of the result.
-   * example: "printf("%d", output);" or "assert(exp);"
-   */
-  private void handleExternalFunctionCall(final CFAEdge edge, final List<CExpression> params) {
-    for (int i = 0; i < params.size(); i++) {
-      final CExpression param = params.get(i);
-
-      /* special case: external functioncall with possible side-effect!
-       * this is the only statement, where a pointer-operation is allowed
-       * and the var can be boolean, intEqual or intAdd,
-       * because we know, the variable can have a random (unknown) value after the functioncall.
-       * example: "scanf("%d", &input);" */
-      if (param instanceof CUnaryExpression
-          && UnaryOperator.AMPER == ((CUnaryExpression) param).getOperator()
-          && ((CUnaryExpression) param).getOperand() instanceof CIdExpression) {
-        final CIdExpression id = (CIdExpression) ((CUnaryExpression) param).getOperand();
-        final String varName = id.getDeclaration().getQualifiedName();
-
-        dependencies.addVar(varName);
-        Partition partition = dependencies.getPartitionForVar(varName);
-        partition.addEdge(edge, i);
-
-      } else {
-        // "printf("%d", output);" or "assert(exp);"
-        // TODO do we need the edge? ignore it?
-
-        CFANode pre = edge.getPredecessor();
-        VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
-        Set<String> vars = param.accept(dcv);
-        if (vars != null) {
-          allVars.addAll(vars);
-          dependencies.addAll(vars, dcv.getValues(), edge, i);
-        }
-
-        param.accept(new BoolCollectingVisitor(pre, nonIntBoolVars));
-        param.accept(new IntEqualCollectingVisitor(pre, nonIntEqVars));
-        param.accept(new IntAddCollectingVisitor(pre, nonIntAddVars));
-        param.accept(new IntOverflowCollectingVisitor(pre, intOverflowVars));
-      }
-    }
-  }
-
-  /**
-   * This function puts each param in same partition than its arg. If there the functionresult is
-   * assigned, it is also handled.
-   */
-  private void handleFunctionCallEdge(CFunctionCallEdge edge) {
-
-    // overtake arguments from last functioncall into function,
-    // get args from functioncall and make them equal with params from functionstart
-    final List<CExpression> args = edge.getArguments();
-    final List<CParameterDeclaration> params = edge.getSuccessor().getFunctionParameters();
-
-    // functions can have more args than params used in the call
-    assert args.size() >= params.size();
-
-    for (int i = 0; i < params.size(); i++) {
-      CParameterDeclaration param = params.get(i);
-      String varName = param.getQualifiedName();
-
-      // only simple types (int, long) are allowed for booleans, ...
-      if (!(param.getType() instanceof CSimpleType)) {
-        nonIntBoolVars.add(varName);
-        nonIntEqVars.add(varName);
-        nonIntAddVars.add(varName);
-      }
-
-      // build name for param and evaluate it
-      // this variable is not global (->false)
-      handleExpression(edge, args.get(i), varName, i);
-    }
-
-    // create dependency for functionreturn
-    CFunctionCall statement = edge.getFunctionCall();
-    Optional<CVariableDeclaration> returnVar = edge.getSuccessor().getReturnVariable();
-    if (returnVar.isPresent()) {
-      String scopedRetVal = returnVar.orElseThrow().getQualifiedName();
-      if (statement instanceof CFunctionCallAssignmentStatement call) {
-        // a=f();
-        CExpression lhs = call.getLeftHandSide();
-        String function = isGlobal(lhs) ? null : edge.getPredecessor().getFunctionName();
-        String varName = scopeVar(function, lhs.toASTString());
-        allVars.add(scopedRetVal);
-        allVars.add(varName);
-        dependencies.add(scopedRetVal, varName);
-      } else if (statement instanceof CFunctionCallStatement) {
-        // f(); without assignment
-        // next line is not necessary, but we do it for completeness, TODO correct?
-        dependencies.addVar(scopedRetVal);
-      }
-    }
-  }
-
-  /** handle expressions contained in types */
-  private void handleType(CFAEdge edge, CType type, String varName) {
-    for (CExpression exp : CTypes.getArrayLengthExpressions(type)) {
-      handleExpression(edge, exp, varName);
-    }
-  }
-
-  /** evaluates an expression and adds containing vars to the sets. */
-  private void handleExpression(CFAEdge edge, CExpression exp, String varName) {
-    handleExpression(edge, exp, varName, 0);
-  }
-
-  /**
-   * evaluates an expression and adds containing vars to the sets. the id is the position of the
-   * expression in the edge, it is 0 for all edges except a FuntionCallEdge.
-   */
-  private void handleExpression(CFAEdge edge, CExpression exp, String varName, int id) {
-    CFANode pre = edge.getPredecessor();
-
-    VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
-    Set<String> vars = exp.accept(dcv);
-    if (vars == null) {
-      vars = Sets.newHashSetWithExpectedSize(1);
-    }
-
-    vars.add(varName);
-    allVars.addAll(vars);
-    dependencies.addAll(vars, dcv.getValues(), edge, id);
-
-    BoolCollectingVisitor bcv = new BoolCollectingVisitor(pre, nonIntBoolVars);
-    Set<String> possibleBoolean = exp.accept(bcv);
-    handleResult(varName, possibleBoolean, nonIntBoolVars);
-
-    IntEqualCollectingVisitor ncv = new IntEqualCollectingVisitor(pre, nonIntEqVars);
-    Set<String> possibleIntEqualVars = exp.accept(ncv);
-    handleResult(varName, possibleIntEqualVars, nonIntEqVars);
-
-    IntAddCollectingVisitor icv = new IntAddCollectingVisitor(pre, nonIntAddVars);
-    Set<String> possibleIntAddVars = exp.accept(icv);
-    handleResult(varName, possibleIntAddVars, nonIntAddVars);
-
-    IntOverflowCollectingVisitor iov = new IntOverflowCollectingVisitor(pre, intOverflowVars);
-    Set<String> possibleIntOverflowVars = exp.accept(iov);
-    handleResult(varName, possibleIntOverflowVars, intOverflowVars);
-  }
-
-  /** adds the variable to notPossibleVars, if possibleVars is null. */
-  private void handleResult(
-      String varName, Collection<String> possibleVars, Collection<String> notPossibleVars) {
-    if (possibleVars == null) {
-      notPossibleVars.add(varName);
-    }
-  }
-
   static String scopeVar(@Nullable final String function, final String var) {
     checkNotNull(var);
     return (function == null) ? var : (function + SCOPE_SEPARATOR + var);
@@ -0,0 +1,126 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.variableclassification;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.exceptions.ParserException;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class VariableClassificationBuilderTest {
+
+  private static final String[] PROGRAM = {
+    "int flag; int counter; int *p;",
+    "int inc(int x) { return x + 1; }",
+    "void toggle() { flag = !flag; }",
+    "void count(int n) { while (counter < n) { counter = inc(counter); } }",
+    "int main() { int a = 5; p = &a; toggle(); count(a); if (flag == 0) { *p = 3; } return 0; }"
+  };
+
+  private static VariableClassificationBuilder createBuilder(int pThreads)
+      throws InvalidConfigurationException {
+    return new VariableClassificationBuilder(
+        TestDataTools.configurationForTest()
+            .setOption("cfa.variableClassification.threads", String.valueOf(pThreads))
+            .build(),
+        LogManager.createTestLogManager());
+  }
+
+  private static VariableClassification build(CFA pCfa, int pThreads)
+      throws InvalidConfigurationException, UnrecognizedCodeException {
+    return createBuilder(pThreads).build(pCfa);
+  }
+
+  private static ImmutableList<String> describePartitions(VariableClassification pVc) {
+    return pVc.getPartitions().stream()
+        .map(partition -> partition.getVars() + " " + partition.getValues())
+        .collect(ImmutableList.toImmutableList());
+  }
+
+  /**
+   * Check that both classifications contain the same variables and the same partitions in the same
+   * order.
+   */
+  private static void assertEqualClassification(
+      CFA pCfa, VariableClassification pActual, VariableClassification pExpected) {
+    assertThat(pActual.getIntBoolVars()).isEqualTo(pExpected.getIntBoolVars());
+    assertThat(pActual.getIntEqualVars()).isEqualTo(pExpected.getIntEqualVars());
+    assertThat(pActual.getIntAddVars()).isEqualTo(pExpected.getIntAddVars());
+    assertThat(pActual.getIntOverflowVars()).isEqualTo(pExpected.getIntOverflowVars());
+    assertThat(pActual.getRelevantVariables()).isEqualTo(pExpected.getRelevantVariables());
+    assertThat(pActual.getAddressedVariables()).isEqualTo(pExpected.getAddressedVariables());
+    assertThat(describePartitions(pActual)).isEqualTo(describePartitions(pExpected));
+
+    for (CFAEdge edge : CFAUtils.allEdges(pCfa)) {
+      Partition partition = pExpected.getPartitionForEdge(edge);
+      if (partition == null) {
+        assertThat(pActual.getPartitionForEdge(edge)).isNull();
+      } else {
+        assertThat(pActual.getPartitionForEdge(edge).getVars()).isEqualTo(partition.getVars());
+        assertThat(pActual.getPartitionForEdge(edge).getEdges()).isEqualTo(partition.getEdges());
+      }
+    }
+  }
+
+  @Test
+  public void testParallelClassificationIsEqual()
+      throws InvalidConfigurationException,
+          ParserException,
+          UnrecognizedCodeException,
+          InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+
+    VariableClassification sequential = build(cfa, 1);
+    VariableClassification parallel = build(cfa, 4);
+
+    assertEqualClassification(cfa, parallel, sequential);
+  }
+
+  @Test
+  public void testPerFunctionClassificationIsEqualToSingleCollector()
+      throws InvalidConfigurationException,
+          ParserException,
+          UnrecognizedCodeException,
+          InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+
+    // a single collector for all nodes is how the classification was computed originally
+    VariableClassification original = createBuilder(1).buildWithSingleCollector(cfa);
+
+    assertEqualClassification(cfa, build(cfa, 1), original);
+    assertEqualClassification(cfa, build(cfa, 4), original);
+  }
+
+  @Test
+  public void testDependenciesAcrossFunctions()
+      throws InvalidConfigurationException,
+          ParserException,
+          UnrecognizedCodeException,
+          InterruptedException {
+    CFA cfa = TestDataTools.makeCFA(PROGRAM);
+    VariableClassification vc = build(cfa, 4);
+
+    // counter is passed to inc() and the result is assigned to counter, so the variables of
+    // different functions end up in a single partition
+    Partition partition =
+        vc.getPartitions().stream()
+            .filter(p -> p.getVars().contains("counter"))
+            .findFirst()
+            .orElseThrow();
+    assertThat(partition.getVars()).containsAtLeast("counter", "count::n", "inc::x");
+  }
+}
@@ -0,0 +1,500 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.variableclassification;
+
+import static com.google.common.base.Preconditions.checkState;
+import static org.sosy_lab.cpachecker.util.CFAUtils.leavingEdges;
+import static org.sosy_lab.cpachecker.util.variableclassification.VariableClassificationBuilder.isGlobal;
+import static org.sosy_lab.cpachecker.util.variableclassification.VariableClassificationBuilder.scopeVar;
+
+import com.google.common.collect.ArrayListMultimap;
+import com.google.common.collect.ListMultimap;
+import com.google.common.collect.Sets;
+import java.math.BigInteger;
+import java.util.Collection;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Optional;
+import java.util.Set;
+import java.util.function.Consumer;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.AVariableDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CAssignment;
+import org.sosy_lab.cpachecker.cfa.ast.c.CDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCall;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallAssignmentStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CInitializer;
+import org.sosy_lab.cpachecker.cfa.ast.c.CInitializerExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CParameterDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CPointerExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CRightHandSide;
+import org.sosy_lab.cpachecker.cfa.ast.c.CStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression.UnaryOperator;
+import org.sosy_lab.cpachecker.cfa.ast.c.CVariableDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CAssumeEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CDeclarationEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionCallEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionReturnEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CReturnStatementEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
+import org.sosy_lab.cpachecker.cfa.types.c.CSimpleType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.cfa.types.c.CTypes;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.variableclassification.VariableAndFieldRelevancyComputer.VarFieldDependencies;
+
+/**
+ * This class collects the variables of the edges of a CFA and orders them into different sets, i.e.
+ * nonBoolean and nonIntEqualNumber, and it tracks the dependencies between them.
+ *
+ * <p>The variables of several parts of a CFA (e.g., of different functions) can be collected
+ * independently of each other by collectors from {@link #recordingDependencies()} and combined
+ * afterwards with {@link #addVariables(VariableCollector)} and {@link
+ * #applyDependencyChanges(VariableCollector, CFANode)}. The result is exactly the same as if all
+ * edges had been handled by a single collector. A single collector is not thread-safe.
+ */
+final class VariableCollector {
+
+  final Set<String> allVars = new HashSet<>();
+
+  final Set<String> nonIntBoolVars = new HashSet<>();
+  final Set<String> nonIntEqVars = new HashSet<>();
+  final Set<String> nonIntAddVars = new HashSet<>();
+  final Set<String> intOverflowVars = new HashSet<>();
+
+  final Dependencies dependencies = new Dependencies();
+
+  private VarFieldDependencies varFieldDependencies = VarFieldDependencies.emptyDependencies();
+
+  /**
+   * The changes of the dependencies per node if they are only recorded, see {@link
+   * #recordingDependencies()}, otherwise null.
+   */
+  private final @Nullable ListMultimap<CFANode, Consumer<Dependencies>> dependencyChanges;
+
+  private @Nullable CFANode currentNode;
+
+  VariableCollector() {
+    dependencyChanges = null;
+  }
+
+  private VariableCollector(ListMultimap<CFANode, Consumer<Dependencies>> pDependencyChanges) {
+    dependencyChanges = pDependencyChanges;
+  }
+
+  /**
+   * Create a collector that does not change its own dependencies, but records the changes per node.
+   * The partitions depend on the order of the changes, so the changes of several such collectors
+   * can be applied to another collector in the order in which it would have handled the nodes.
+   */
+  static VariableCollector recordingDependencies() {
+    return new VariableCollector(ArrayListMultimap.create());
+  }
+
+  VarFieldDependencies getVarFieldDependencies() {
+    return varFieldDependencies;
+  }
+
+  /** This function handles all leaving edges of the given node. */
+  void collectVars(CFANode node, CFA cfa) throws UnrecognizedCodeException {
+    currentNode = node;
+    for (CFAEdge edge : leavingEdges(node)) {
+      handleEdge(edge, cfa);
+      varFieldDependencies =
+          varFieldDependencies.withDependencies(
+              VariableAndFieldRelevancyComputer.handleEdge(cfa, edge));
+    }
+  }
+
+  /**
+   * This function adds all variables of the other collector to this one, but not the dependencies
+   * (see {@link #applyDependencyChanges(VariableCollector, CFANode)}).
+   */
+  void addVariables(VariableCollector other) {
+    allVars.addAll(other.allVars);
+    nonIntBoolVars.addAll(other.nonIntBoolVars);
+    nonIntEqVars.addAll(other.nonIntEqVars);
+    nonIntAddVars.addAll(other.nonIntAddVars);
+    intOverflowVars.addAll(other.intOverflowVars);
+    varFieldDependencies = varFieldDependencies.withDependencies(other.varFieldDependencies);
+  }
+
+  /** This function applies the changes of the dependencies that the other collector recorded. */
+  void applyDependencyChanges(VariableCollector other, CFANode node) {
+    checkState(other.dependencyChanges != null, "collector does not record dependencies");
+    for (Consumer<Dependencies> change : other.dependencyChanges.get(node)) {
+      change.accept(dependencies);
+    }
+  }
+
+  private void changeDependencies(Consumer<Dependencies> change) {
+    if (dependencyChanges == null) {
+      change.accept(dependencies);
+    } else {
+      dependencyChanges.put(currentNode, change);
+    }
+  }
+
+  /** switch to edgeType and handle all expressions, that could be part of the edge. */
+  private void handleEdge(CFAEdge edge, CFA cfa) throws UnrecognizedCodeException {
+    switch (edge.getEdgeType()) {
+      case AssumeEdge:
+        {
+          CExpression exp = ((CAssumeEdge) edge).getExpression();
+          CFANode pre = edge.getPredecessor();
+
+          VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
+          Set<String> vars = exp.accept(dcv);
+          if (vars != null) {
+            allVars.addAll(vars);
+            Set<BigInteger> values = dcv.getValues();
+            changeDependencies(d -> d.addAll(vars, values, edge, 0));
+          }
+
+          exp.accept(new BoolCollectingVisitor(pre, nonIntBoolVars));
+          exp.accept(new IntEqualCollectingVisitor(pre, nonIntEqVars));
+          exp.accept(new IntAddCollectingVisitor(pre, nonIntAddVars));
+          exp.accept(new IntOverflowCollectingVisitor(pre, intOverflowVars));
+
+          break;
+        }
+
+      case DeclarationEdge:
+        {
+          handleDeclarationEdge((CDeclarationEdge) edge);
+          break;
+        }
+
+      case StatementEdge:
+        {
+          final CStatement statement = ((CStatementEdge) edge).getStatement();
+
+          // normal assignment of variable, rightHandSide can be expression or (external)
+          // functioncall
+          if (statement instanceof CAssignment) {
+            handleAssignment(edge, (CAssignment) statement, cfa);
+
+            // pure external functioncall
+          } else if (statement instanceof CFunctionCallStatement) {
+            handleExternalFunctionCall(
+                edge,
+                ((CFunctionCallStatement) statement)
+                    .getFunctionCallExpression()
+                    .getParameterExpressions());
+          }
+
+          break;
+        }
+
+      case FunctionCallEdge:
+        {
+          handleFunctionCallEdge((CFunctionCallEdge) edge);
+          break;
+        }
+
+      case FunctionReturnEdge:
+        {
+          Optional<CVariableDeclaration> returnVar =
+              ((CFunctionReturnEdge) edge).getFunctionEntry().getReturnVariable();
+          if (returnVar.isPresent()) {
+            String scopedVarName = returnVar.orElseThrow().getQualifiedName();
+            changeDependencies(
+                d -> {
+                  d.addVar(scopedVarName);
+                  d.addEdge(scopedVarName, edge, 0);
+                });
+          }
+          break;
+        }
+
+      case ReturnStatementEdge:
+        {
+          // this is the 'x' from 'return (x);
+          // adding a new temporary FUNCTION_RETURN_VARIABLE, that is not global (-> false)
+          CReturnStatementEdge returnStatement = (CReturnStatementEdge) edge;
+          if (returnStatement.asAssignment().isPresent()) {
+            handleAssignment(edge, returnStatement.asAssignment().orElseThrow(), cfa);
+          }
+          break;
+        }
+
+      case BlankEdge:
+      case CallToReturnEdge:
+        // other cases are not interesting
+        break;
+
+      default:
+        throw new UnrecognizedCodeException("Unknown edgeType: " + edge.getEdgeType(), edge);
+    }
+  }
+
+  /**
+   * This function handles a declaration with an optional initializer. Only simple types are
+   * handled.
+   */
+  private void handleDeclarationEdge(final CDeclarationEdge edge) {
+    CDeclaration declaration = edge.getDeclaration();
+    if (!(declaration instanceof CVariableDeclaration)) {
+      return;
+    }
+
+    CVariableDeclaration vdecl = (CVariableDeclaration) declaration;
+    String varName = vdecl.getQualifiedName();
+    allVars.add(varName);
+
+    // "connect" the edge with its partition
+    Set<String> var = Sets.newHashSetWithExpectedSize(1);
+    var.add(varName);
+    changeDependencies(d -> d.addAll(var, new HashSet<>(), edge, 0));
+
+    // only simple types (int, long) are allowed for booleans, ...
+    if (!(vdecl.getType() instanceof CSimpleType)) {
+      nonIntBoolVars.add(varName);
+      nonIntEqVars.add(varName);
+      nonIntAddVars.add(varName);
+    }
+
+    handleType(edge, vdecl.getType(), varName);
+
+    final CInitializer initializer = vdecl.getInitializer();
+
+    if (!(initializer instanceof CInitializerExpression)) {
+      return;
+    }
+
+    CExpression exp = ((CInitializerExpression) initializer).getExpression();
+    if (exp == null) {
+      return;
+    }
+
+    handleExpression(edge, exp, varName);
+  }
+
+  /** This function handles normal assignments of vars. */
+  private void handleAssignment(final CFAEdge edge, final CAssignment assignment, final CFA cfa)
+      throws UnrecognizedCodeException {
+    CRightHandSide rhs = assignment.getRightHandSide();
+    CExpression lhs = assignment.getLeftHandSide();
+    String function = isGlobal(lhs) ? null : edge.getPredecessor().getFunctionName();
+
+    // If we have a simple pointer, we handle it like a simple variable.
+    // This allows us to track dependencies between simple references.
+    String varName = scopeVar(function, lhs.toASTString());
+    if (lhs instanceof CPointerExpression && lhs.getExpressionType() instanceof CSimpleType) {
+      CExpression operand = ((CPointerExpression) lhs).getOperand();
+      if (operand instanceof CIdExpression) {
+        varName = scopeVar(function, operand.toASTString());
+      }
+    }
+
+    // only simple types (int, long) are allowed for booleans, ...
+    if (!(lhs instanceof CIdExpression && lhs.getExpressionType() instanceof CSimpleType)) {
+      nonIntBoolVars.add(varName);
+      nonIntEqVars.add(varName);
+      nonIntAddVars.add(varName);
+    }
+
+    final String assignedVar = varName;
+    changeDependencies(d -> d.addVar(assignedVar));
+
+    if (rhs instanceof CExpression) {
+      handleExpression(edge, ((CExpression) rhs), varName);
+
+    } else if (rhs instanceof CFunctionCallExpression func) {
+      // use FUNCTION_RETURN_VARIABLE for RIGHT SIDE
+      String functionName = func.getFunctionNameExpression().toASTString(); // TODO correct?
+
+      if (cfa.getAllFunctionNames().contains(functionName)) {
+        Optional<? extends AVariableDeclaration> returnVariable =
+            cfa.getFunctionHead(functionName).getReturnVariable();
+        if (!returnVariable.isPresent()) {
+          throw new UnrecognizedCodeException(
+              "Void function " + functionName + " used in assignment", edge, assignment);
+        }
+        String returnVar = returnVariable.get().getQualifiedName();
+        allVars.add(returnVar);
+        allVars.add(varName);
+        changeDependencies(d -> d.add(returnVar, assignedVar));
+
+      } else {
+        // external function
+        // negative value, because all positives are used for params
+        changeDependencies(d -> d.addEdge(assignedVar, edge, -1));
+      }
+
+      handleExternalFunctionCall(edge, func.getParameterExpressions());
+
+    } else {
+      throw new UnrecognizedCodeException("unhandled assignment", edge, assignment);
+    }
+  }
+
+  /**
+   * This function handles the call of an external function without an assignment of the result.
+   * example: "printf("%d", output);" or "assert(exp);"
+   */
+  private void handleExternalFunctionCall(final CFAEdge edge, final List<CExpression> params) {
+    for (int i = 0; i < params.size(); i++) {
+      final CExpression param = params.get(i);
+
+      /* special case: external functioncall with possible side-effect!
+       * this is the only statement, where a pointer-operation is allowed
+       * and the var can be boolean, intEqual or intAdd,
+       * because we know, the variable can have a random (unknown) value after the functioncall.
+       * example: "scanf("%d", &input);" */
+      if (param instanceof CUnaryExpression
+          && UnaryOperator.AMPER == ((CUnaryExpression) param).getOperator()
+          && ((CUnaryExpression) param).getOperand() instanceof CIdExpression) {
+        final CIdExpression id = (CIdExpression) ((CUnaryExpression) param).getOperand();
+        final String varName = id.getDeclaration().getQualifiedName();
+
+        final int index = i;
+        changeDependencies(
+            d -> {
+              d.addVar(varName);
+              d.addEdge(varName, edge, index);
+            });
+
+      } else {
+        // "printf("%d", output);" or "assert(exp);"
+        // TODO do we need the edge? ignore it?
+
+        CFANode pre = edge.getPredecessor();
+        VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
+        Set<String> vars = param.accept(dcv);
+        if (vars != null) {
+          allVars.addAll(vars);
+          Set<BigInteger> values = dcv.getValues();
+          final int index = i;
+          changeDependencies(d -> d.addAll(vars, values, edge, index));
+        }
+
+        param.accept(new BoolCollectingVisitor(pre, nonIntBoolVars));
+        param.accept(new IntEqualCollectingVisitor(pre, nonIntEqVars));
+        param.accept(new IntAddCollectingVisitor(pre, nonIntAddVars));
+        param.accept(new IntOverflowCollectingVisitor(pre, intOverflowVars));
+      }
+    }
+  }
+
+  /**
+   * This function puts each param in same partition than its arg. If there the functionresult is
+   * assigned, it is also handled.
+   */
+  private void handleFunctionCallEdge(CFunctionCallEdge edge) {
+
+    // overtake arguments from last functioncall into function,
+    // get args from functioncall and make them equal with params from functionstart
+    final List<CExpression> args = edge.getArguments();
+    final List<CParameterDeclaration> params = edge.getSuccessor().getFunctionParameters();
+
+    // functions can have more args than params used in the call
+    assert args.size() >= params.size();
+
+    for (int i = 0; i < params.size(); i++) {
+      CParameterDeclaration param = params.get(i);
+      String varName = param.getQualifiedName();
+
+      // only simple types (int, long) are allowed for booleans, ...
+      if (!(param.getType() instanceof CSimpleType)) {
+        nonIntBoolVars.add(varName);
+        nonIntEqVars.add(varName);
+        nonIntAddVars.add(varName);
+      }
+
+      // build name for param and evaluate it
+      // this variable is not global (->false)
+      handleExpression(edge, args.get(i), varName, i);
+    }
+
+    // create dependency for functionreturn
+    CFunctionCall statement = edge.getFunctionCall();
+    Optional<CVariableDeclaration> returnVar = edge.getSuccessor().getReturnVariable();
+    if (returnVar.isPresent()) {
+      String scopedRetVal = returnVar.orElseThrow().getQualifiedName();
+      if (statement instanceof CFunctionCallAssignmentStatement call) {
+        // a=f();
+        CExpression lhs = call.getLeftHandSide();
+        String function = isGlobal(lhs) ? null : edge.getPredecessor().getFunctionName();
+        String varName = scopeVar(function, lhs.toASTString());
+        allVars.add(scopedRetVal);
+        allVars.add(varName);
+        changeDependencies(d -> d.add(scopedRetVal, varName));
+      } else if (statement instanceof CFunctionCallStatement) {
+        // f(); without assignment
+        // next line is not necessary, but we do it for completeness, TODO correct?
+        changeDependencies(d -> d.addVar(scopedRetVal));
+      }
+    }
+  }
+
+  /** handle expressions contained in types */
+  private void handleType(CFAEdge edge, CType type, String varName) {
+    for (CExpression exp : CTypes.getArrayLengthExpressions(type)) {
+      handleExpression(edge, exp, varName);
+    }
+  }
+
+  /** evaluates an expression and adds containing vars to the sets. */
+  private void handleExpression(CFAEdge edge, CExpression exp, String varName) {
+    handleExpression(edge, exp, varName, 0);
+  }
+
+  /**
+   * evaluates an expression and adds containing vars to the sets. the id is the position of the
+   * expression in the edge, it is 0 for all edges except a FuntionCallEdge.
+   */
+  private void handleExpression(CFAEdge edge, CExpression exp, String varName, int id) {
+    CFANode pre = edge.getPredecessor();
+
+    VariablesCollectingVisitor dcv = new VariablesCollectingVisitor(pre);
+    Set<String> vars = exp.accept(dcv);
+    if (vars == null) {
+      vars = Sets.newHashSetWithExpectedSize(1);
+    }
+
+    vars.add(varName);
+    allVars.addAll(vars);
+    Set<String> dependentVars = vars;
+    Set<BigInteger> values = dcv.getValues();
+    changeDependencies(d -> d.addAll(dependentVars, values, edge, id));
+
+    BoolCollectingVisitor bcv = new BoolCollectingVisitor(pre, nonIntBoolVars);
+    Set<String> possibleBoolean = exp.accept(bcv);
+    handleResult(varName, possibleBoolean, nonIntBoolVars);
+
+    IntEqualCollectingVisitor ncv = new IntEqualCollectingVisitor(pre, nonIntEqVars);
+    Set<String> possibleIntEqualVars = exp.accept(ncv);
+    handleResult(varName, possibleIntEqualVars, nonIntEqVars);
+
+    IntAddCollectingVisitor icv = new IntAddCollectingVisitor(pre, nonIntAddVars);
+    Set<String> possibleIntAddVars = exp.accept(icv);
+    handleResult(varName, possibleIntAddVars, nonIntAddVars);
+
+    IntOverflowCollectingVisitor iov = new IntOverflowCollectingVisitor(pre, intOverflowVars);
+    Set<String> possibleIntOverflowVars = exp.accept(iov);
+    handleResult(varName, possibleIntOverflowVars, intOverflowVars);
+  }
+
+  /** adds the variable to notPossibleVars, if possibleVars is null. */
+  private void handleResult(
+      String varName, Collection<String> possibleVars, Collection<String> notPossibleVars) {
+    if (possibleVars == null) {
+      notPossibleVars.add(varName);
+    }
+  }
+}
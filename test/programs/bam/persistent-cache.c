@@ -0,0 +1,29 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+int add(int a, int b) {
+  return a + b;
+}
+
+int square(int x) {
+  int r = 0;
+  for (int i = 0; i < x; i++) {
+    r = add(r, x);
+  }
+  return r;
+}
+
+int main() {
+  int a = square(3);
+  int b = square(3);
+  if (a != b || a != 9) {
+ERROR:
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,36 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2024 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+extern int __VERIFIER_nondet_int(void);
+
+int inc(int x) {
+	if (__VERIFIER_nondet_int()) {
+		return x + 1;
+	}
+	return x;
+}
+
+int twice(int x) {
+	return inc(inc(x));
+}
+
+int main() {
+	int a = 0;
+	if (__VERIFIER_nondet_int()) {
+		a = inc(a);
+	} else {
+		a = twice(a);
+	}
+	if (__VERIFIER_nondet_int()) {
+		a = twice(a);
+	}
+	while (__VERIFIER_nondet_int()) {
+		a = inc(a);
+	}
+	return a;
+}